@@ -71,8 +71,10 @@
 
 #include <vtkMeshQuality.h>
 
-#include <set>
+#include <algorithm>
 #include <limits>
+#include <memory>
+#include <set>
 
 /*
                             AUXILIARY METHODS
@@ -85,7 +87,7 @@ namespace {
 
   inline gp_XYZ gpXYZ(const SMDS_MeshNode* aNode )
   {
-    return gp_XYZ(aNode->X(), aNode->Y(), aNode->Z() );
+    return SMESH_NodeXYZ( aNode ); // thread safe getting coords
   }
 
   inline double getAngle( const gp_XYZ& P1, const gp_XYZ& P2, const gp_XYZ& P3 )
@@ -309,6 +311,157 @@ bool NumericalFunctor::IsApplicable( long theElementId ) const
   return IsApplicable( myMesh->FindElement( theElementId ));
 }
 
+namespace
+{
+  //================================================================================
+  /*!
+   * \brief Return index of an interval a value belongs to. The i-th interval is
+   *        ( funValues[i], funValues[i+1] ]; the first one includes all values
+   *        less than funValues[1] and the last one, all values greater than funValues[n-1]
+   */
+  //================================================================================
+
+  inline size_t getInterval( const double value, const std::vector<double>& funValues )
+  {
+    return std::lower_bound( funValues.begin() + 1, funValues.end() - 1, value ) -
+      ( funValues.begin() + 1 );
+  }
+}
+
+#ifdef WITH_TBB
+
+#ifdef WIN32
+// See https://docs.microsoft.com/en-gb/cpp/porting/modifying-winver-and-win32-winnt?view=vs-2019
+// Windows 10 = 0x0A00  
+#define WINVER 0x0A00
+#define _WIN32_WINNT 0x0A00
+
+#endif
+
+#include <tbb/parallel_for.h>
+#include <tbb/enumerable_thread_specific.h>
+
+namespace
+{
+  // a functor and min/max of computed values per a thread
+  struct TLocalValueData
+  {
+    NumericalFunctorPtr myFunctor;
+    double              myMin = std::numeric_limits<double>::max();
+    double              myMax = std::numeric_limits<double>::lowest();
+  };
+  typedef tbb::enumerable_thread_specific< TLocalValueData > TLocalValueDatas;
+
+  //================================================================================
+  /*!
+   * \brief Compute values of elements by thread-safe copies of a functor
+   */
+  //================================================================================
+
+  struct GetValueParallel
+  {
+    const std::vector<smIdType>& myIDs;
+    std::vector<double>&         myValues;
+    const NumericalFunctor*      myFunctor;
+    TLocalValueDatas&            myLocalData;
+    GetValueParallel( const NumericalFunctor* fun, TLocalValueDatas& locData,
+                      const std::vector<smIdType>& ids, std::vector<double>& values )
+      : myIDs( ids ), myValues( values ), myFunctor( fun ), myLocalData( locData )
+    {}
+    void operator() ( const tbb::blocked_range<size_t>& r ) const
+    {
+      TLocalValueData& data = myLocalData.local();
+      if ( !data.myFunctor )
+        data.myFunctor.reset( myFunctor->clone() );
+      for ( size_t i = r.begin(); i != r.end(); ++i )
+      {
+        double value = data.myFunctor->GetValue( myIDs[ i ]);
+        myValues[ i ] = value;
+        data.myMin = Min( data.myMin, value );
+        data.myMax = Max( data.myMax, value );
+      }
+    }
+  };
+
+  // nb of values per interval, per a thread
+  typedef tbb::enumerable_thread_specific< std::vector<int> > TLocalNbEvents;
+
+  //================================================================================
+  /*!
+   * \brief Count values per interval
+   */
+  //================================================================================
+
+  struct CountParallel
+  {
+    const std::vector<double>& myValues;
+    const std::vector<double>& myFunValues;
+    TLocalNbEvents&            myLocalNbEvents;
+    CountParallel( const std::vector<double>& values, const std::vector<double>& funValues,
+                   TLocalNbEvents& locNbEvents )
+      : myValues( values ), myFunValues( funValues ), myLocalNbEvents( locNbEvents )
+    {}
+    void operator() ( const tbb::blocked_range<size_t>& r ) const
+    {
+      std::vector<int>& nbEvents = myLocalNbEvents.local();
+      nbEvents.resize( myFunValues.size() - 1, 0 );
+      for ( size_t i = r.begin(); i != r.end(); ++i )
+        ++nbEvents[ getInterval( myValues[ i ], myFunValues )];
+    }
+  };
+}
+
+#endif
+
+//================================================================================
+/*!
+ * \brief Return values of given elements and their min and max.
+ *        Values are computed in parallel if possible.
+ */
+//================================================================================
+
+void NumericalFunctor::getValues( const std::vector<smIdType>& elements,
+                                  std::vector<double>&         values,
+                                  double&                      minValue,
+                                  double&                      maxValue )
+{
+  values.resize( elements.size() );
+  minValue = std::numeric_limits<double>::max();
+  maxValue = std::numeric_limits<double>::lowest();
+  if ( elements.empty() )
+    return;
+
+#ifdef WITH_TBB
+  if ( elements.size() >= 100000 ) // else no sense in parallel work
+  {
+    GetValue( elements[0] ); // make this fully initialized for clone()
+    std::unique_ptr< NumericalFunctor > test( clone() );
+    if ( test )
+    {
+      TLocalValueDatas threadData;
+      threadData.local().myFunctor.reset( test.release() );
+
+      tbb::parallel_for ( tbb::blocked_range<size_t>( 0, elements.size() ),
+                          GetValueParallel( this, threadData, elements, values ));
+
+      for ( const TLocalValueData& data : threadData )
+      {
+        minValue = Min( minValue, data.myMin );
+        maxValue = Max( maxValue, data.myMax );
+      }
+      return;
+    }
+  }
+#endif
+
+  for ( size_t i = 0; i < elements.size(); ++i )
+  {
+    values[ i ] = GetValue( elements[ i ]);
+    minValue = Min( minValue, values[ i ]);
+    maxValue = Max( maxValue, values[ i ]);
+  }
+}
+
 //================================================================================
 /*!
  * \brief Return histogram of functor values
@@ -317,6 +470,7 @@ bool NumericalFunctor::IsApplicable( long theElementId ) const
  *  \param funValues - boundaries of intervals
  *  \param elements - elements to check vulue of; empty list means "of all"
  *  \param minmax - boundaries of diapason of values to divide into intervals
+ *  \param isLogarithmic - if true, boundaries of intervals are in logarithmic scale
  */
 //================================================================================
 
@@ -334,20 +488,24 @@ void NumericalFunctor::GetHistogram(int                          nbIntervals,
   nbEvents.resize( nbIntervals, 0 );
   funValues.resize( nbIntervals+1 );
 
-  // get all values sorted
-  std::multiset< double > values;
+  // get all values
+  std::vector< double > values;
+  double minValue, maxValue;
   if ( elements.empty() )
   {
+    std::vector<smIdType> allElements;
+    allElements.reserve( myMesh->GetMeshInfo().NbElements( GetType() ));
     SMDS_ElemIteratorPtr elemIt = myMesh->elementsIterator( GetType() );
     while ( elemIt->more() )
-      values.insert( GetValue( elemIt->next()->GetID() ));
+      allElements.push_back( elemIt->next()->GetID() );
+    getValues( allElements, values, minValue, maxValue );
   }
   else
   {
-    std::vector<smIdType>::const_iterator id = elements.begin();
-    for ( ; id != elements.end(); ++id )
-      values.insert( GetValue( *id ));
+    getValues( elements, values, minValue, maxValue );
   }
+  if ( values.empty() && !minmax )
+    return;
 
   if ( minmax )
   {
@@ -356,8 +514,8 @@ void NumericalFunctor::GetHistogram(int                          nbIntervals,
   }
   else
   {
-    funValues[0] = *values.begin();
-    funValues[nbIntervals] = *values.rbegin();
+    funValues[0] = minValue;
+    funValues[nbIntervals] = maxValue;
   }
   // case nbIntervals == 1
   if ( nbIntervals == 1 )
@@ -372,12 +530,11 @@ void NumericalFunctor::GetHistogram(int                          nbIntervals,
     nbEvents[0] = values.size();
     funValues[1] = funValues.back();
     funValues.resize( 2 );
+    return;
   }
-  // generic case
-  std::multiset< double >::iterator min = values.begin(), max;
-  for ( int i = 0; i < nbIntervals; ++i )
+  // generic case: find end values of intervals
+  for ( int i = 0; i < nbIntervals - 1; ++i )
   {
-    // find end value of i-th interval
     double r = (i+1) / double(nbIntervals);
     if (isLogarithmic && funValues.front() > 1e-07 && funValues.back() > 1e-07) {
       double logmin = log10(funValues.front());
@@ -387,18 +544,25 @@ void NumericalFunctor::GetHistogram(int                          nbIntervals,
     else {
       funValues[i+1] = funValues.front() * (1-r) + funValues.back() * r;
     }
+  }
 
-    // count values in the i-th interval if there are any
-    if ( min != values.end() && *min <= funValues[i+1] )
-    {
-      // find the first value out of the interval
-      max = values.upper_bound( funValues[i+1] ); // max is greater than funValues[i+1], or end()
-      nbEvents[i] = std::distance( min, max );
-      min = max;
-    }
+  // count values in intervals; values out of [min,max] are counted in end intervals
+#ifdef WITH_TBB
+  if ( values.size() >= 100000 ) // else no sense in parallel work
+  {
+    TLocalNbEvents threadNbEvents;
+    tbb::parallel_for ( tbb::blocked_range<size_t>( 0, values.size() ),
+                        CountParallel( values, funValues, threadNbEvents ));
+
+    for ( const std::vector<int>& nbEv : threadNbEvents )
+      for ( size_t i = 0; i < nbEv.size(); ++i )
+        nbEvents[i] += nbEv[i];
+    return;
   }
-  // add values larger than minmax[1]
-  nbEvents.back() += std::distance( min, values.end() );
+#endif
+
+  for ( size_t i = 0; i < values.size(); ++i )
+    ++nbEvents[ getInterval( values[ i ], funValues )];
 }
 
 //=======================================================================
@@ -3736,6 +3900,25 @@ double Comparator::GetMargin()
   return myMargin;
 }
 
+//================================================================================
+/*!
+ * \brief Make a thread-safe copy of a comparator by cloning its functor.
+ *        Delete theCopy and return null if the functor can't be cloned.
+ */
+//================================================================================
+
+Predicate* Comparator::cloneFunctor( Comparator* theCopy ) const
+{
+  NumericalFunctor* functorClone = myFunctor ? myFunctor->clone() : 0;
+  if ( !functorClone )
+  {
+    delete theCopy;
+    return 0;
+  }
+  theCopy->myFunctor.reset( functorClone );
+  return theCopy;
+}
+
 
 /*
   Class       : LessThan
@@ -3746,6 +3929,11 @@ bool LessThan::IsSatisfy( long theId )
   return myFunctor && myFunctor->GetValue( theId ) < myMargin;
 }
 
+Predicate* LessThan::clone() const
+{
+  return cloneFunctor( new LessThan( *this ));
+}
+
 
 /*
   Class       : MoreThan
@@ -3756,6 +3944,11 @@ bool MoreThan::IsSatisfy( long theId )
   return myFunctor && myFunctor->GetValue( theId ) > myMargin;
 }
 
+Predicate* MoreThan::clone() const
+{
+  return cloneFunctor( new MoreThan( *this ));
+}
+
 
 /*
   Class       : EqualTo
@@ -3770,6 +3963,11 @@ bool EqualTo::IsSatisfy( long theId )
   return myFunctor && fabs( myFunctor->GetValue( theId ) - myMargin ) < myToler;
 }
 
+Predicate* EqualTo::clone() const
+{
+  return cloneFunctor( new EqualTo( *this ));
+}
+
 void EqualTo::SetTolerance( double theToler )
 {
   myToler = theToler;
@@ -3795,6 +3993,16 @@ bool LogicalNOT::IsSatisfy( long theId )
   return myPredicate && !myPredicate->IsSatisfy( theId );
 }
 
+Predicate* LogicalNOT::clone() const
+{
+  Predicate* predicateClone = myPredicate ? myPredicate->clone() : 0;
+  if ( !predicateClone )
+    return 0;
+  LogicalNOT* notClone = new LogicalNOT( *this );
+  notClone->myPredicate.reset( predicateClone );
+  return notClone;
+}
+
 void LogicalNOT::SetMesh( const SMDS_Mesh* theMesh )
 {
   if ( myPredicate )
@@ -3831,6 +4039,29 @@ void LogicalBinary::SetMesh( const SMDS_Mesh* theMesh )
     myPredicate2->SetMesh( theMesh );
 }
 
+//================================================================================
+/*!
+ * \brief Make a thread-safe copy of a logical predicate by cloning its arguments.
+ *        Delete theCopy and return null if an argument can't be cloned.
+ */
+//================================================================================
+
+Predicate* LogicalBinary::clonePredicates( LogicalBinary* theCopy ) const
+{
+  Predicate* predicate1Clone = myPredicate1 ? myPredicate1->clone() : 0;
+  Predicate* predicate2Clone = myPredicate2 ? myPredicate2->clone() : 0;
+  if ( !predicate1Clone || !predicate2Clone )
+  {
+    delete predicate1Clone;
+    delete predicate2Clone;
+    delete theCopy;
+    return 0;
+  }
+  theCopy->myPredicate1.reset( predicate1Clone );
+  theCopy->myPredicate2.reset( predicate2Clone );
+  return theCopy;
+}
+
 void LogicalBinary::SetPredicate1( PredicatePtr thePredicate )
 {
   myPredicate1 = thePredicate;
@@ -3866,6 +4097,11 @@ bool LogicalAND::IsSatisfy( long theId )
     myPredicate2->IsSatisfy( theId );
 }
 
+Predicate* LogicalAND::clone() const
+{
+  return clonePredicates( new LogicalAND( *this ));
+}
+
 
 /*
   Class       : LogicalOR
@@ -3880,35 +4116,56 @@ bool LogicalOR::IsSatisfy( long theId )
     myPredicate2->IsSatisfy( theId ));
 }
 
+Predicate* LogicalOR::clone() const
+{
+  return clonePredicates( new LogicalOR( *this ));
+}
+
 
 /*
                               FILTER
 */
 
-// #ifdef WITH_TBB
-// #include <tbb/parallel_for.h>
-// #include <tbb/enumerable_thread_specific.h>
+#ifdef WITH_TBB
 
-// namespace Parallel
-// {
-//   typedef tbb::enumerable_thread_specific< TIdSequence > TIdSeq;
+namespace
+{
+  // a predicate per a thread
+  typedef tbb::enumerable_thread_specific< PredicatePtr > TLocalPredicates;
 
-//   struct Predicate
-//   {
-//     const SMDS_Mesh* myMesh;
-//     PredicatePtr     myPredicate;
-//     TIdSeq &         myOKIds;
-//     Predicate( const SMDS_Mesh* m, PredicatePtr p, TIdSeq & ids ):
-//       myMesh(m), myPredicate(p->Duplicate()), myOKIds(ids) {}
-//     void operator() ( const tbb::blocked_range<size_t>& r ) const
-//     {
-//       for ( size_t i = r.begin(); i != r.end(); ++i )
-//         if ( myPredicate->IsSatisfy( i ))
-//           myOKIds.local().push_back();
-//     }
-//   }
-// }
-// #endif
+  //================================================================================
+  /*!
+   * \brief Check elements by thread-safe copies of a predicate
+   */
+  //================================================================================
+
+  struct IsSatisfyParallel
+  {
+    const std::vector< const SMDS_MeshElement* >& myElems;
+    std::vector< char >&                           myIsElemOK;
+    PredicatePtr                                   myPredicate;
+    TLocalPredicates&                              myLocalPredicates;
+    IsSatisfyParallel( PredicatePtr mainPred, TLocalPredicates& locPred,
+                       const std::vector< const SMDS_MeshElement* >& elems, std::vector< char >& isOk )
+      : myElems( elems ), myIsElemOK( isOk ), myPredicate( mainPred ), myLocalPredicates( locPred )
+    {}
+    void operator() ( const tbb::blocked_range<size_t>& r ) const
+    {
+      PredicatePtr& pred = myLocalPredicates.local();
+      if ( !pred )
+      {
+        if ( r.begin() == 0 )
+          pred = myPredicate;
+        else
+          pred.reset( myPredicate->clone() );
+      }
+      for ( size_t i = r.begin(); i != r.end(); ++i )
+        myIsElemOK[ i ] = char( pred->IsSatisfy( myElems[ i ]->GetID() ));
+    }
+  };
+}
+
+#endif
 
 Filter::Filter()
 {}
@@ -3936,16 +4193,57 @@ void Filter::GetElementsId( const SMDS_Mesh*     theMesh,
   if ( !theElements )
     theElements = theMesh->elementsIterator( thePredicate->GetType() );
 
-  if ( theElements ) {
-    while ( theElements->more() ) {
-      const SMDS_MeshElement* anElem = theElements->next();
-      if ( thePredicate->GetType() == SMDSAbs_All ||
-           thePredicate->GetType() == anElem->GetType() )
-      {
-        long anId = anElem->GetID();
-        if ( thePredicate->IsSatisfy( anId ) )
-          theSequence.push_back( anId );
-      }
+  if ( !theElements )
+    return;
+
+#ifdef WITH_TBB
+
+  // check elements in parallel if the predicate can be cloned;
+  // elements are collected beforehand to keep their order in theSequence
+
+  std::vector< const SMDS_MeshElement* > elems;
+  while ( theElements->more() )
+  {
+    const SMDS_MeshElement* anElem = theElements->next();
+    if ( thePredicate->GetType() == SMDSAbs_All ||
+         thePredicate->GetType() == anElem->GetType() )
+      elems.push_back( anElem );
+  }
+  if ( elems.empty() )
+    return;
+
+  if ( elems.size() >= 10000 ) // else no sense in parallel work
+  {
+    thePredicate->IsSatisfy( elems[0]->GetID() ); // make thePredicate fully initialized for clone()
+    PredicatePtr clone( thePredicate->clone() );
+    if ( clone )
+    {
+      TLocalPredicates threadPredicates;
+      threadPredicates.local() = clone;
+
+      std::vector< char > isElemOK( elems.size() );
+      tbb::parallel_for ( tbb::blocked_range<size_t>( 0, elems.size() ),
+                          IsSatisfyParallel( thePredicate, threadPredicates, elems, isElemOK ));
+
+      theSequence.reserve( std::count( isElemOK.begin(), isElemOK.end(), char( true )));
+      for ( size_t i = 0; i < elems.size(); ++i )
+        if ( isElemOK[ i ])
+          theSequence.push_back( elems[ i ]->GetID() );
+      return;
+    }
+  }
+  theElements = SMESHUtils::elemSetIterator( elems );
+
+#endif
+
+  while ( theElements->more() ) {
+    const SMDS_MeshElement* anElem = theElements->next();
+    if ( thePredicate->GetType() == SMDSAbs_All ||
+         thePredicate->GetType() == anElem->GetType() )
+    {
+      long anId = anElem->GetID();
+      if ( thePredicate->IsSatisfy( anId ) )
+        theSequence.push_back( anId );
     }
   }
 }
@@ -4459,7 +4757,7 @@ bool ElementsOnSurface::isOnSurface( const SMDS_MeshNode* theNode )
   if ( mySurf.IsNull() )
     return false;
 
-  gp_Pnt aPnt( theNode->X(), theNode->Y(), theNode->Z() );
+  gp_Pnt aPnt = SMESH_NodeXYZ( theNode );
   //  double aToler2 = myToler * myToler;
 //   if ( mySurf->IsKind(STANDARD_TYPE(Geom_Plane)))
 //   {
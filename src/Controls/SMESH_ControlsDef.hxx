@@ -134,6 +134,7 @@ namespace SMESH{
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual double GetValue( long theElementId );
       virtual double GetValue(const TSequenceOfXYZ& /*thePoints*/) { return -1.0;};
+      virtual NumericalFunctor* clone() const { return 0; } // return a thread-safe copy of this
       void GetHistogram(int                            nbIntervals,
                         std::vector<int>&              nbEvents,
                         std::vector<double>&           funValues,
@@ -151,6 +152,11 @@ namespace SMESH{
       bool GetPoints(const ::smIdType theId, TSequenceOfXYZ& theRes) const;
       static bool GetPoints(const SMDS_MeshElement* theElem, TSequenceOfXYZ& theRes);
     protected:
+      void getValues(const std::vector<::smIdType>& elements,
+                     std::vector<double>&           values,
+                     double&                        minValue,
+                     double&                        maxValue);
+
       const SMDS_Mesh*        myMesh;
       const SMDS_MeshElement* myCurrElement;
       long                    myPrecision;
@@ -164,6 +170,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT Volume: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new Volume( *this ); }
       virtual double GetValue( long theElementId );
       //virtual double GetValue( const TSequenceOfXYZ& thePoints );
       virtual double GetBadRate( double Value, int nbNodes ) const;
@@ -177,6 +184,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT MaxElementLength2D: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new MaxElementLength2D( *this ); }
       virtual double GetValue( long theElementId );
       virtual double GetValue( const TSequenceOfXYZ& P );
       virtual double GetBadRate( double Value, int nbNodes ) const;
@@ -190,6 +198,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT MaxElementLength3D: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new MaxElementLength3D( *this ); }
       virtual double GetValue( long theElementId );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
@@ -202,6 +211,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT MinimumAngle: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new MinimumAngle( *this ); }
       virtual double GetValue( const TSequenceOfXYZ& thePoints );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
@@ -214,6 +224,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT AspectRatio: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new AspectRatio( *this ); }
       virtual double GetValue( long theElementId );
       virtual double GetValue( const TSequenceOfXYZ& thePoints );
       virtual double GetBadRate( double Value, int nbNodes ) const;
@@ -242,6 +253,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT Warping: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new Warping( *this ); }
       virtual double GetValue( const TSequenceOfXYZ& thePoints );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
@@ -258,6 +270,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT Warping3D: public virtual Warping {
     public:
+      virtual NumericalFunctor* clone() const { return new Warping3D( *this ); }
       virtual bool IsApplicable(const SMDS_MeshElement* element) const;
       virtual double GetValue(const TSequenceOfXYZ& thePoints);
       virtual double GetValue(long theId);
@@ -284,6 +297,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT Taper: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new Taper( *this ); }
       virtual double GetValue( const TSequenceOfXYZ& thePoints );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
@@ -296,6 +310,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT Skew: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new Skew( *this ); }
       virtual double GetValue( const TSequenceOfXYZ& thePoints );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
@@ -309,6 +324,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT Area: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new Area( *this ); }
       virtual double GetValue( const TSequenceOfXYZ& thePoints );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
@@ -321,6 +337,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT Length: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new Length( *this ); }
       virtual double GetValue( const TSequenceOfXYZ& thePoints );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
@@ -332,6 +349,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT Length2D: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new Length2D( *this ); }
       Length2D( SMDSAbs_ElementType type = SMDSAbs_Face );
       virtual bool   IsApplicable( const SMDS_MeshElement* element ) const;
       virtual double GetValue( const TSequenceOfXYZ& thePoints );
@@ -358,6 +376,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT Length3D: public virtual Length2D {
     public:
       Length3D();
+      virtual NumericalFunctor* clone() const { return new Length3D( *this ); }
     };
     typedef boost::shared_ptr<Length3D> Length3DPtr;
 
@@ -416,6 +435,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT BallDiameter: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new BallDiameter( *this ); }
       virtual double GetValue( long theElementId );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
@@ -427,6 +447,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT NodeConnectivityNumber: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new NodeConnectivityNumber( *this ); }
       virtual double GetValue( long theNodeId );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
@@ -438,6 +459,7 @@ namespace SMESH{
     */
     class SMESHCONTROLS_EXPORT ScaledJacobian: public virtual NumericalFunctor{
     public:
+      virtual NumericalFunctor* clone() const { return new ScaledJacobian( *this ); }
       virtual double GetValue( long theNodeId );
       virtual double GetBadRate( double Value, int nbNodes ) const;
       virtual SMDSAbs_ElementType GetType() const;
@@ -487,17 +509,17 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT CoincidentElements1D: public CoincidentElements {
     public:
       virtual SMDSAbs_ElementType GetType() const;
-      //virtual Predicate* clone() const { return new CoincidentElements1D( *this ); }
+      virtual Predicate* clone() const { return new CoincidentElements1D( *this ); }
     };
     class SMESHCONTROLS_EXPORT CoincidentElements2D: public CoincidentElements {
     public:
       virtual SMDSAbs_ElementType GetType() const;
-      //virtual Predicate* clone() const { return new CoincidentElements2D( *this ); }
+      virtual Predicate* clone() const { return new CoincidentElements2D( *this ); }
     };
     class SMESHCONTROLS_EXPORT CoincidentElements3D: public CoincidentElements {
     public:
       virtual SMDSAbs_ElementType GetType() const;
-      //virtual Predicate* clone() const { return new CoincidentElements3D( *this ); }
+      virtual Predicate* clone() const { return new CoincidentElements3D( *this ); }
     };
 
     /*
@@ -507,7 +529,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT FreeBorders: public virtual Predicate{
     public:
       FreeBorders();
-      //virtual Predicate* clone() const { return new FreeBorders( *this ); }
+      virtual Predicate* clone() const { return new FreeBorders( *this ); }
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theElementId );
       virtual SMDSAbs_ElementType GetType() const;
@@ -524,7 +546,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT BadOrientedVolume: public virtual Predicate{
     public:
       BadOrientedVolume();
-      //virtual Predicate* clone() const { return new BadOrientedVolume( *this ); }
+      virtual Predicate* clone() const { return new BadOrientedVolume( *this ); }
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theElementId );
       virtual SMDSAbs_ElementType GetType() const;
@@ -540,7 +562,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT ElemEntityType: public virtual Predicate{
       public:
       ElemEntityType();
-      //virtual Predicate*   clone() const { return new ElemEntityType( *this ); }
+      virtual Predicate*   clone() const { return new ElemEntityType( *this ); }
       virtual void         SetMesh( const SMDS_Mesh* theMesh );
       virtual bool         IsSatisfy( long theElementId );
       void                 SetType( SMDSAbs_ElementType theType );
@@ -579,7 +601,7 @@ namespace SMESH{
     {
     public:
       BareBorderFace():myMesh(0) {}
-      //virtual Predicate* clone() const { return new BareBorderFace( *this ); }
+      virtual Predicate* clone() const { return new BareBorderFace( *this ); }
       virtual void SetMesh( const SMDS_Mesh* theMesh ) { myMesh = theMesh; }
       virtual SMDSAbs_ElementType GetType() const      { return SMDSAbs_Face; }
       virtual bool IsSatisfy( long theElementId );
@@ -612,7 +634,7 @@ namespace SMESH{
     {
     public:
       OverConstrainedFace():myMesh(0) {}
-      //virtual Predicate* clone() const { return new OverConstrainedFace( *this ); }
+      virtual Predicate* clone() const { return new OverConstrainedFace( *this ); }
       virtual void SetMesh( const SMDS_Mesh* theMesh ) { myMesh = theMesh; }
       virtual SMDSAbs_ElementType GetType() const      { return SMDSAbs_Face; }
       virtual bool IsSatisfy( long theElementId );
@@ -628,7 +650,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT FreeEdges: public virtual Predicate{
     public:
       FreeEdges();
-      //virtual Predicate* clone() const { return new FreeEdges( *this ); }
+      virtual Predicate* clone() const { return new FreeEdges( *this ); }
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theElementId );
       virtual SMDSAbs_ElementType GetType() const;
@@ -656,7 +678,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT FreeNodes: public virtual Predicate{
     public:
       FreeNodes();
-      //virtual Predicate* clone() const { return new FreeNodes( *this ); }
+      virtual Predicate* clone() const { return new FreeNodes( *this ); }
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theNodeId );
       virtual SMDSAbs_ElementType GetType() const;
@@ -678,7 +700,7 @@ namespace SMESH{
     {
     public:
       RangeOfIds();
-      //virtual Predicate*            clone() const { return new RangeOfIds( *this ); }
+      virtual Predicate*            clone() const { return new RangeOfIds( *this ); }
       virtual void                  SetMesh( const SMDS_Mesh* theMesh );
       virtual bool                  IsSatisfy( long theNodeId );
       virtual SMDSAbs_ElementType   GetType() const;
@@ -717,6 +739,8 @@ namespace SMESH{
       double  GetMargin();
   
     protected:
+      Predicate* cloneFunctor( Comparator* theCopy ) const;
+
       double myMargin;
       NumericalFunctorPtr myFunctor;
     };
@@ -730,7 +754,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT LessThan: public virtual Comparator{
     public:
       virtual bool IsSatisfy( long theElementId );
-      //virtual Predicate* clone() const { return new LessThan( *this ); }
+      virtual Predicate* clone() const;
     };
   
   
@@ -741,7 +765,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT MoreThan: public virtual Comparator{
     public:
       virtual bool IsSatisfy( long theElementId );
-      //virtual Predicate* clone() const { return new MoreThan( *this ); }
+      virtual Predicate* clone() const;
     };
   
   
@@ -752,7 +776,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT EqualTo: public virtual Comparator{
     public:
       EqualTo();
-      //virtual Predicate* clone() const { return new EqualTo( *this ); }
+      virtual Predicate* clone() const;
       virtual bool IsSatisfy( long theElementId );
       virtual void SetTolerance( double theTol );
       virtual double GetTolerance();
@@ -770,7 +794,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT LogicalNOT: public virtual Predicate{
     public:
       LogicalNOT();
-      //virtual Predicate* clone() const { return new LogicalNOT( *this ); }
+      virtual Predicate* clone() const;
       virtual ~LogicalNOT();
       virtual bool IsSatisfy( long theElementId );
       virtual void SetMesh( const SMDS_Mesh* theMesh );
@@ -797,6 +821,8 @@ namespace SMESH{
       virtual SMDSAbs_ElementType GetType() const;
   
     protected:
+      Predicate* clonePredicates( LogicalBinary* theCopy ) const;
+
       PredicatePtr myPredicate1;
       PredicatePtr myPredicate2;
     };
@@ -810,7 +836,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT LogicalAND: public virtual LogicalBinary{
     public:
       virtual bool IsSatisfy( long theElementId );
-      //virtual Predicate* clone() const { return new LogicalAND( *this ); }
+      virtual Predicate* clone() const;
     };
   
   
@@ -821,7 +847,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT LogicalOR: public virtual LogicalBinary{
     public:
       virtual bool IsSatisfy( long theElementId );
-      //virtual Predicate* clone() const { return new LogicalOR( *this ); }
+      virtual Predicate* clone() const;
     };
   
   
@@ -1095,7 +1121,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT FreeFaces: public virtual Predicate{
     public:
       FreeFaces();
-      //virtual Predicate* clone() const { return new FreeFaces( *this ); }
+      virtual Predicate* clone() const { return new FreeFaces( *this ); }
       virtual void SetMesh( const SMDS_Mesh* theMesh );
       virtual bool IsSatisfy( long theElementId );
       virtual SMDSAbs_ElementType GetType() const;
@@ -1111,7 +1137,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT LinearOrQuadratic: public virtual Predicate{
     public:
       LinearOrQuadratic();
-      //virtual Predicate*  clone() const { return new LinearOrQuadratic( *this ); }
+      virtual Predicate*  clone() const { return new LinearOrQuadratic( *this ); }
       virtual void        SetMesh( const SMDS_Mesh* theMesh );
       virtual bool        IsSatisfy( long theElementId );
       void                SetType( SMDSAbs_ElementType theType );
@@ -1130,7 +1156,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT GroupColor: public virtual Predicate{
     public:
       GroupColor();
-      //virtual Predicate*  clone() const { return new GroupColor( *this ); }
+      virtual Predicate*  clone() const { return new GroupColor( *this ); }
       virtual void        SetMesh( const SMDS_Mesh* theMesh );
       virtual bool        IsSatisfy( long theElementId );
       void                SetType( SMDSAbs_ElementType theType );
@@ -1154,7 +1180,7 @@ namespace SMESH{
     class SMESHCONTROLS_EXPORT ElemGeomType: public virtual Predicate{
     public:
       ElemGeomType();
-      //virtual Predicate*   clone() const { return new ElemGeomType( *this ); }
+      virtual Predicate*   clone() const { return new ElemGeomType( *this ); }
       virtual void         SetMesh( const SMDS_Mesh* theMesh );
       virtual bool         IsSatisfy( long theElementId );
       void                 SetType( SMDSAbs_ElementType theType );
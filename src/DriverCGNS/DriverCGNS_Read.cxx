@@ -560,6 +560,37 @@ namespace
   }
 
   typedef SMDS_MeshElement* (* PAddElemFun) (cgsize_t* ids, SMESHDS_Mesh* mesh, int ID);
+
+  // number of nodes or elements created at once
+  const cgsize_t theBatchSize = 100000;
+
+  //================================================================================
+  /*!
+   * \brief Return SMDS type and order of nodes of a linear CGNS element type
+   *        whose elements are created at once
+   *  \param [out] smdsOrder - index of a CGNS node for each SMDS node
+   *  \return bool - false if elements of this type are created one by one
+   */
+  //================================================================================
+
+  bool getSMDSTypeAndOrder( CGNS_ENUMT( ElementType_t ) cgnsType,
+                            SMDSAbs_EntityType&         smdsType,
+                            std::vector<int>&           smdsOrder )
+  {
+    switch ( cgnsType )
+    {
+    case CGNS_ENUMV( NODE    ): smdsType = SMDSEntity_0D;         smdsOrder = { 0 };       break;
+    case CGNS_ENUMV( BAR_2   ): smdsType = SMDSEntity_Edge;       smdsOrder = { 0,1 };     break;
+    case CGNS_ENUMV( TRI_3   ): smdsType = SMDSEntity_Triangle;   smdsOrder = { 0,2,1 };   break;
+    case CGNS_ENUMV( QUAD_4  ): smdsType = SMDSEntity_Quadrangle; smdsOrder = { 0,3,2,1 }; break;
+    case CGNS_ENUMV( TETRA_4 ): smdsType = SMDSEntity_Tetra;      smdsOrder = { 0,2,1,3 }; break;
+    case CGNS_ENUMV( PYRA_5  ): smdsType = SMDSEntity_Pyramid;    smdsOrder = { 0,3,2,1,4 };   break;
+    case CGNS_ENUMV( PENTA_6 ): smdsType = SMDSEntity_Penta;      smdsOrder = { 0,2,1,3,5,4 }; break;
+    case CGNS_ENUMV( HEXA_8  ): smdsType = SMDSEntity_Hexa;       smdsOrder = { 0,3,2,1,4,7,6,5 }; break;
+    default: return false;
+    }
+    return true;
+  }
   
   //================================================================================
   /*!
@@ -775,8 +806,23 @@ Driver_Mesh::Status DriverCGNS_Read::Perform()
     // create nodes
     MESSAGE("  create nodes");
     try {
-      for ( int i = 0; i < nbNodes; ++i )
-        myMesh->AddNodeWithID( coords[0][i], coords[1][i], coords[2][i], i+1+zone._nodeIdShift );
+      vector<double>   xyz;
+      vector<smIdType> nodeIDs;
+      for ( int i0 = 0; i0 < nbNodes; i0 += theBatchSize )
+      {
+        const int nbInBatch = std::min( (int) theBatchSize, nbNodes - i0 );
+        xyz.resize( 3 * nbInBatch );
+        nodeIDs.resize( nbInBatch );
+        for ( int i = 0; i < nbInBatch; ++i )
+        {
+          xyz[ 3*i + 0 ] = coords[0][ i0 + i ];
+          xyz[ 3*i + 1 ] = coords[1][ i0 + i ];
+          xyz[ 3*i + 2 ] = coords[2][ i0 + i ];
+          nodeIDs[ i ]   = i0 + i + 1 + zone._nodeIdShift;
+        }
+        for ( int i = 0; i < nbInBatch; ) // skip nodes with already used IDs
+          i += FromSmIdType<int>( myMesh->AddNodesWithID( nbInBatch - i, &xyz[ 3*i ], &nodeIDs[ i ])) + 1;
+      }
     }
     catch ( std::exception& exc ) // expect std::bad_alloc
     {
@@ -896,6 +942,33 @@ Driver_Mesh::Status DriverCGNS_Read::Perform()
         vector<int> quantities;
         vector<const SMDS_MeshNode*> nodes, faceNodes;
 
+        SMDSAbs_EntityType smdsType;
+        vector<int>        smdsOrder;
+        if ( getSMDSTypeAndOrder( elemType, smdsType, smdsOrder ))
+        {
+          // create linear elements of one type at once
+          vector<smIdType> nodeIDs, elemIDs;
+          const cgsize_t nbElems = eDataSize / cgnsNbNodes;
+          for ( cgsize_t i0 = 0; i0 < nbElems; i0 += theBatchSize )
+          {
+            const cgsize_t nbInBatch = std::min( theBatchSize, nbElems - i0 );
+            nodeIDs.resize( nbInBatch * cgnsNbNodes );
+            elemIDs.resize( nbInBatch );
+            for ( cgsize_t i = 0; i < nbInBatch; ++i, pos += cgnsNbNodes )
+            {
+              zone.ReplaceNodes( &elemData[pos], cgnsNbNodes, zone._nodeIdShift );
+              for ( int iN = 0; iN < cgnsNbNodes; ++iN )
+                nodeIDs[ i * cgnsNbNodes + iN ] = ToSmIdType( elemData[ pos + smdsOrder[ iN ]]);
+              elemIDs[ i ] = elemID++;
+            }
+            for ( cgsize_t i = 0; i < nbInBatch; ) // skip elements which can't be created
+              i += FromSmIdType<cgsize_t>
+                ( myMesh->AddElementsWithID( smdsType, nbInBatch - i, &nodeIDs[ i * cgnsNbNodes ],
+                                             &elemIDs[ i ])) + 1;
+          }
+          pos = eDataSize;
+        }
+
         while ( pos < eDataSize )
         {
           CGNS_ENUMT( ElementType_t ) currentType = elemType;
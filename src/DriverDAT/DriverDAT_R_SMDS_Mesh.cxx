@@ -24,11 +24,14 @@
 
 #include "DriverDAT_R_SMDS_Mesh.h"
 #include "SMDS_Mesh.hxx"
+#include "SMESH_File.hxx"
 
 #include "utilities.h"
 
 #include <Basics_Utils.hxx>
 
+#include <vector>
+
 using namespace std;
 
 Driver_Mesh::Status DriverDAT_R_SMDS_Mesh::Perform()
@@ -39,30 +42,27 @@ Driver_Mesh::Status DriverDAT_R_SMDS_Mesh::Perform()
   int i, j;
   int nbNodes, nbCells;
   int intNumPoint;
-  float coordX, coordY, coordZ;
   int nbNoeuds;
   
   int intNumMaille, Degre;
   int ValElement;
-  int NoeudsMaille[20];
-  int NoeudMaille;
+  vector<int> NoeudsMaille( 20 );
+  vector<int> ints( 2 );
+  vector<double> coords( 3 );
   
   /****************************************************************************
    *                      OUVERTURE DU FICHIER EN LECTURE                      *
    ****************************************************************************/
-#if defined(WIN32) && defined(UNICODE)
-  std::wstring file2Read = Kernel_Utils::utf8_decode_s(myFile);
-  FILE* aFileId = _wfopen(file2Read.c_str(), L"r");
-#else
-  char *file2Read = (char *)myFile.c_str();
-  FILE* aFileId = fopen(file2Read, "r");
-#endif
-  if ( !aFileId ) {
-    fprintf(stderr, ">> ERREUR : ouverture du fichier %s \n", file2Read);
+  SMESH_File aFile( myFile );
+  if ( aFile.eof() ) {
+    fprintf(stderr, ">> ERREUR : ouverture du fichier %s \n", myFile.c_str());
     return DRS_FAIL;
   }
   
-  fscanf(aFileId, "%d %d\n", &nbNodes, &nbCells);
+  if ( !aFile.getInts( ints ))
+    return DRS_FAIL;
+  nbNodes = ints[0];
+  nbCells = ints[1];
   
   /****************************************************************************
    *                       LECTURE DES NOEUDS                                  *
@@ -71,9 +71,12 @@ Driver_Mesh::Status DriverDAT_R_SMDS_Mesh::Perform()
   fprintf(stdout, "(* NOEUDS DU MAILLAGE : *)\n");
   fprintf(stdout, "(************************)\n");
   
+  ints.resize( 1 );
   for (i = 0; i < nbNodes; i++){
-    fscanf(aFileId, "%d %e %e %e\n", &intNumPoint, &coordX, &coordY, &coordZ);
-    myMesh->AddNodeWithID(coordX, coordY, coordZ, intNumPoint);
+    if ( !aFile.getInts( ints ) || !aFile.getDoubles( coords ))
+      return DRS_FAIL;
+    intNumPoint = ints[0];
+    myMesh->AddNodeWithID(coords[0], coords[1], coords[2], intNumPoint);
   }
   
   fprintf(stdout, "%ld noeuds\n", static_cast< long >( myMesh->NbNodes() ));
@@ -87,14 +90,20 @@ Driver_Mesh::Status DriverDAT_R_SMDS_Mesh::Perform()
   fprintf(stdout, "%d elements\n", nbCells);
   
   for (i = 0; i < nbCells; i++) {
-    fscanf(aFileId, "%d %d", &intNumMaille, &ValElement);
+    ints.resize( 2 );
+    if ( !aFile.getInts( ints ))
+      return DRS_FAIL;
+    intNumMaille = ints[0];
+    ValElement   = ints[1];
     Degre = abs(ValElement / 100);
     nbNoeuds = ValElement - (Degre * 100);
     
     // Recuperation des noeuds de la maille
-    for (j = 0; j < nbNoeuds; j++) {
-      fscanf(aFileId, "%d", &NoeudMaille);
-      NoeudsMaille[j] = NoeudMaille;
+    ints.resize( nbNoeuds );
+    if ( !aFile.getInts( ints ))
+      return DRS_FAIL;
+    for (j = 0; j < nbNoeuds && j < (int) NoeudsMaille.size(); j++) {
+      NoeudsMaille[j] = ints[j];
     }
     
     // Analyse des cas de cellules
@@ -163,9 +172,5 @@ Driver_Mesh::Status DriverDAT_R_SMDS_Mesh::Perform()
                                 break;
     }
   }
-  /****************************************************************************
-   *                      FERMETURE DU FICHIER                      *
-   ****************************************************************************/
-  fclose(aFileId);
   return aResult;
 }
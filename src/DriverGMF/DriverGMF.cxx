@@ -25,6 +25,9 @@
 
 #include "DriverGMF.hxx"
 
+#include <algorithm>
+#include <cstring>
+
 #include <boost/filesystem.hpp>
 
 extern "C"
@@ -32,6 +35,12 @@ extern "C"
 #include "libmesh5.h"
 }
 
+namespace
+{
+  // number of lines read or written at once
+  const int theBlockSize = 100000;
+}
+
 namespace DriverGMF
 {
 
@@ -63,4 +72,129 @@ namespace DriverGMF
     }
     return false;
   }
+
+  //================================================================================
+  /*!
+   * \brief Prepare reading lines of a keyword
+   *  \param [in] gmfMeshID - the GMF mesh
+   *  \param [in] gmfKwd - the keyword
+   *  \param [in] nbLines - number of lines to read
+   *  \param [in] nbInt - number of integer fields in a line
+   *  \param [in] nbReal - number of real fields in a line
+   */
+  //================================================================================
+
+  BlockReader::BlockReader( int gmfMeshID, int gmfKwd, int nbLines, int nbInt, int nbReal )
+    : _gmfMeshID( gmfMeshID ), _gmfKwd( gmfKwd ), _nbLeft( nbLines ),
+      _nbInt( nbInt ), _nbReal( nbReal ), _nbRead( 0 ), _isTruncated( false ),
+      _iLine( 0 ), _nbLines( 0 )
+  {
+  }
+
+  //================================================================================
+  /*!
+   * \brief Read the next block of lines. Stop reading if the file is truncated
+   */
+  //================================================================================
+
+  void BlockReader::readBlock()
+  {
+    int nbToRead = std::min( _nbLeft, theBlockSize );
+    _ints.resize ( nbToRead * _nbInt );
+    _reals.resize( nbToRead * _nbReal );
+    int nbRead = GmfGetBlk( _gmfMeshID, _gmfKwd, nbToRead, _ints.data(), _reals.data() );
+    if ( nbRead < nbToRead )
+    {
+      _isTruncated = true;
+      _nbLeft = 0;
+      nbRead = std::max( nbRead, 0 );
+    }
+    else
+    {
+      _nbLeft -= nbToRead;
+    }
+    _nbRead += nbRead;
+    _nbLines = nbRead;
+    _iLine   = 0;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Return true if there is a line to read. A block of lines
+   *        is read from the file when all previously read lines are consumed
+   */
+  //================================================================================
+
+  bool BlockReader::More()
+  {
+    if ( _iLine == _nbLines && _nbLeft > 0 )
+      readBlock();
+    return _iLine < _nbLines;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Copy fields of the next line to ints and reals.
+   *        Return false if all lines are read or the file is truncated
+   */
+  //================================================================================
+
+  bool BlockReader::GetLine( int* ints, double* reals )
+  {
+    if ( !More() )
+      return false;
+    std::memcpy( ints, & _ints[ _iLine * _nbInt ], _nbInt * sizeof( int ));
+    if ( reals )
+      std::memcpy( reals, & _reals[ _iLine * _nbReal ], _nbReal * sizeof( double ));
+    ++_iLine;
+    return true;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Prepare writing lines of a keyword set by GmfSetKwd()
+   *  \param [in] gmfMeshID - the GMF mesh
+   *  \param [in] gmfKwd - the keyword
+   *  \param [in] nbInt - number of integer fields in a line
+   *  \param [in] nbReal - number of real fields in a line
+   */
+  //================================================================================
+
+  BlockWriter::BlockWriter( int gmfMeshID, int gmfKwd, int nbInt, int nbReal )
+    : _gmfMeshID( gmfMeshID ), _gmfKwd( gmfKwd ), _nbInt( nbInt ), _nbReal( nbReal ),
+      _nbLines( 0 )
+  {
+    _ints.reserve ( theBlockSize * _nbInt );
+    _reals.reserve( theBlockSize * _nbReal );
+  }
+
+  //================================================================================
+  /*!
+   * \brief Store a line, write stored lines if there are many of them
+   */
+  //================================================================================
+
+  void BlockWriter::AddLine( const int* ints, const double* reals )
+  {
+    _ints.insert( _ints.end(), ints, ints + _nbInt );
+    if ( _nbReal > 0 )
+      _reals.insert( _reals.end(), reals, reals + _nbReal );
+    if ( ++_nbLines == (size_t) theBlockSize )
+      Flush();
+  }
+
+  //================================================================================
+  /*!
+   * \brief Write stored lines
+   */
+  //================================================================================
+
+  void BlockWriter::Flush()
+  {
+    if ( _nbLines > 0 )
+      GmfSetBlk( _gmfMeshID, _gmfKwd, (int) _nbLines, _ints.data(), _reals.data() );
+    _ints.clear();
+    _reals.clear();
+    _nbLines = 0;
+  }
 }
@@ -26,7 +26,9 @@
 #ifndef __DriverGMF_HXX__
 #define __DriverGMF_HXX__
 
+#include <initializer_list>
 #include <string>
+#include <vector>
 
 namespace DriverGMF
 {
@@ -41,6 +43,54 @@ namespace DriverGMF
   };
 
   bool isExtensionCorrect( const std::string& fileName );
+
+  /*!
+   * \brief Reader of lines of a GMF keyword by blocks of lines.
+   *        The file must be positioned at the keyword by GmfGotoKwd().
+   *        If the file contains less lines than announced, reading stops
+   *        at the last read line and IsTruncated() returns true
+   */
+  class BlockReader
+  {
+  public:
+    BlockReader( int gmfMeshID, int gmfKwd, int nbLines, int nbInt, int nbReal = 0 );
+    // Return true if there is a line to read
+    bool More();
+    // Copy fields of the next line to ints and reals; return false if there is no more lines
+    bool GetLine( int* ints, double* reals = 0 );
+    // Return true if the file ends before all announced lines are read
+    bool IsTruncated() const { return _isTruncated; }
+    // Return number of lines read from the file
+    int  NbReadLines() const { return _nbRead; }
+  private:
+    void readBlock();
+    int                 _gmfMeshID, _gmfKwd, _nbLeft, _nbInt, _nbReal;
+    int                 _nbRead;
+    bool                _isTruncated;
+    size_t              _iLine, _nbLines;
+    std::vector<int>    _ints;
+    std::vector<double> _reals;
+  };
+
+  /*!
+   * \brief Writer of lines of a GMF keyword by blocks of lines.
+   *        Lines are written at the latest at destruction, so the writer must
+   *        be destroyed before the next GmfSetKwd()
+   */
+  class BlockWriter
+  {
+  public:
+    BlockWriter( int gmfMeshID, int gmfKwd, int nbInt, int nbReal = 0 );
+    ~BlockWriter() { Flush(); }
+    void AddLine( const int* ints, const double* reals = 0 );
+    void AddLine( std::initializer_list<int> ints ) { AddLine( ints.begin() ); }
+    void Flush();
+  private:
+    int                 _gmfMeshID, _gmfKwd, _nbInt, _nbReal;
+    size_t              _nbLines;
+    std::vector<int>    _ints;
+    std::vector<double> _reals;
+  };
 }
 
 #endif
@@ -40,6 +40,30 @@ extern "C"
 
 #include <stdarg.h>
 
+namespace
+{
+  // number of nodes or elements created at once
+  const size_t theBatchSize = 100000;
+
+  //================================================================================
+  /*!
+   * \brief Create nodes at once, skipping nodes with already used IDs
+   */
+  //================================================================================
+
+  void addNodes( SMESHDS_Mesh*          mesh,
+                 std::vector<double>&   coords,
+                 std::vector<smIdType>& nodeIDs )
+  {
+    const smIdType nbNodes = nodeIDs.size();
+    for ( smIdType i = 0; i < nbNodes; )
+      i += mesh->AddNodesWithID( nbNodes - i, &coords[ 3 * i ], &nodeIDs[ i ]) + 1;
+
+    coords.clear();
+    nodeIDs.clear();
+  }
+}
+
 // --------------------------------------------------------------------------------
 DriverGMF_Read::DriverGMF_Read():
   Driver_SMESHDS_Mesh(),
@@ -85,34 +109,36 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
   if ( nbNodes < 1 )
     return addMessage( "No nodes in the mesh", /*fatal=*/true );
 
+  if ( dim < 2 || dim > 3 )
+    return addMessage( SMESH_Comment("Wrong space dimension ") << dim, /*fatal=*/true );
+
   GmfGotoKwd(meshID, GmfVertices);
 
   int ref;
 
   const smIdType nodeIDShift = myMesh->GetMeshInfo().NbNodes();
-  if ( version != GmfFloat )
+  std::vector<double>   coords;
+  std::vector<smIdType> nodeIDs;
+  double xyz[3] = { 0., 0., 0. };
+  DriverGMF::BlockReader vertexReader( meshID, GmfVertices, nbNodes, /*nbInt=*/1, /*nbReal=*/dim );
+  for ( int i = 1; vertexReader.GetLine( &ref, xyz ); ++i )
   {
-    double x, y, z;
-    for ( int i = 1; i <= nbNodes; ++i )
-    {
-      GmfGetLin(meshID, GmfVertices, &x, &y, &z, &ref);
-      myMesh->AddNodeWithID( x,y,z, nodeIDShift + i);
-    }
-  }
-  else
-  {
-    float x, y, z;
-    for ( int i = 1; i <= nbNodes; ++i )
-    {
-      GmfGetLin(meshID, GmfVertices, &x, &y, &z, &ref);
-      myMesh->AddNodeWithID( x,y,z, nodeIDShift + i);
-    }
+    coords.insert( coords.end(), xyz, xyz + 3 );
+    nodeIDs.push_back( nodeIDShift + i );
+    if ( nodeIDs.size() == theBatchSize || !vertexReader.More() )
+      addNodes( myMesh, coords, nodeIDs );
   }
+  if ( vertexReader.IsTruncated() )
+    status = storeTruncated( "GmfVertices", vertexReader.NbReadLines(), nbNodes );
 
   // Read elements
 
   int iN[28]; // 28 - nb nodes in HEX27 (+ 1 for safety :)
 
+  // linear elements are created by batches
+  std::vector<smIdType> linNodes, linIDs;
+  Status linStatus;
+
   /* Read edges */
   const smIdType edgeIDShift = myMesh->GetMeshInfo().NbElements();
   if ( int nbEdges = GmfStatKwd(meshID, GmfEdges))
@@ -131,9 +157,9 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
     }
     // create edges
     GmfGotoKwd(meshID, GmfEdges);
-    for ( int i = 1; i <= nbEdges; ++i )
+    DriverGMF::BlockReader edgeReader( meshID, GmfEdges, nbEdges, 2+1 );
+    for ( int i = 1; edgeReader.GetLine( iN ); ++i )
     {
-      GmfGetLin(meshID, GmfEdges, &iN[0], &iN[1], &ref);
       const int midN = quadNodesAtEdges[ i ];
       if ( midN > 0 )
       {
@@ -143,10 +169,16 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
       }
       else
       {
-        if ( !myMesh->AddEdgeWithID( iN[0], iN[1], edgeIDShift + i ))
-          status = storeBadNodeIds( "GmfEdges",i, 2, iN[0], iN[1] );
+        linNodes.insert( linNodes.end(), &iN[0], &iN[2] );
+        linIDs.push_back( edgeIDShift + i );
       }
+      if ( linIDs.size() == theBatchSize || !edgeReader.More() )
+        if (( linStatus = addElements( "GmfEdges", SMDSEntity_Edge,
+                                       linNodes, linIDs, edgeIDShift )) != DRS_OK )
+          status = linStatus;
     }
+    if ( edgeReader.IsTruncated() )
+      status = storeTruncated( "GmfEdges", edgeReader.NbReadLines(), nbEdges );
   }
 
   /* Read triangles */
@@ -173,9 +205,9 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
     }
     // create triangles
     GmfGotoKwd(meshID, GmfTriangles);
-    for ( int i = 1; i <= nbTria; ++i )
+    DriverGMF::BlockReader triaReader( meshID, GmfTriangles, nbTria, 3+1 );
+    for ( int i = 1; triaReader.GetLine( iN ); ++i )
     {
-      GmfGetLin(meshID, GmfTriangles, &iN[0], &iN[1], &iN[2], &ref);
       std::vector<int>& midN = quadNodesAtTriangles[ i ];
       if ( midN.size() >= 3 )
       {
@@ -186,11 +218,17 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
       }
       else
       {
-        if ( !myMesh->AddFaceWithID( iN[0], iN[1], iN[2], triaIDShift + i ))
-          status = storeBadNodeIds( "GmfTriangles",i, 3, iN[0], iN[1], iN[2] );
+        linNodes.insert( linNodes.end(), &iN[0], &iN[3] );
+        linIDs.push_back( triaIDShift + i );
       }
       if ( !midN.empty() ) SMESHUtils::FreeVector( midN );
+      if ( linIDs.size() == theBatchSize || !triaReader.More() )
+        if (( linStatus = addElements( "GmfTriangles", SMDSEntity_Triangle,
+                                       linNodes, linIDs, triaIDShift )) != DRS_OK )
+          status = linStatus;
     }
+    if ( triaReader.IsTruncated() )
+      status = storeTruncated( "GmfTriangles", triaReader.NbReadLines(), nbTria );
   }
 
   /* Read quadrangles */
@@ -216,9 +254,9 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
     }
     // create quadrangles
     GmfGotoKwd(meshID, GmfQuadrilaterals);
-    for ( int i = 1; i <= nbQuad; ++i )
+    DriverGMF::BlockReader quadReader( meshID, GmfQuadrilaterals, nbQuad, 4+1 );
+    for ( int i = 1; quadReader.GetLine( iN ); ++i )
     {
-      GmfGetLin(meshID, GmfQuadrilaterals, &iN[0], &iN[1], &iN[2], &iN[3], &ref);
       std::vector<int>& midN = quadNodesAtQuadrilaterals[ i ];
       if ( midN.size() == 8-4 ) // QUAD8
       {
@@ -240,11 +278,17 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
       }
       else // QUAD4
       {
-        if ( !myMesh->AddFaceWithID( iN[0], iN[1], iN[2], iN[3], quadIDShift + i ))
-          status = storeBadNodeIds( "GmfQuadrilaterals",i, 4, iN[0], iN[1],iN[2], iN[3] );
+        linNodes.insert( linNodes.end(), &iN[0], &iN[4] );
+        linIDs.push_back( quadIDShift + i );
       }
       if ( !midN.empty() ) SMESHUtils::FreeVector( midN );
+      if ( linIDs.size() == theBatchSize || !quadReader.More() )
+        if (( linStatus = addElements( "GmfQuadrilaterals", SMDSEntity_Quadrangle,
+                                       linNodes, linIDs, quadIDShift )) != DRS_OK )
+          status = linStatus;
     }
+    if ( quadReader.IsTruncated() )
+      status = storeTruncated( "GmfQuadrilaterals", quadReader.NbReadLines(), nbQuad );
   }
 
   /* Read terahedra */
@@ -270,9 +314,9 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
     }
     // create tetrahedra
     GmfGotoKwd(meshID, GmfTetrahedra);
-    for ( int i = 1; i <= nbTet; ++i )
+    DriverGMF::BlockReader tetraReader( meshID, GmfTetrahedra, nbTet, 4+1 );
+    for ( int i = 1; tetraReader.GetLine( iN ); ++i )
     {
-      GmfGetLin(meshID, GmfTetrahedra, &iN[0], &iN[1], &iN[2], &iN[3], &ref);
       std::vector<int>& midN = quadNodesAtTetrahedra[ i ];
       if ( midN.size() >= 10-4 ) // TETRA10
       {
@@ -285,11 +329,18 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
       }
       else // TETRA4
       {
-        if ( !myMesh->AddVolumeWithID( iN[0], iN[2], iN[1], iN[3], tetIDShift + i ))
-          status = storeBadNodeIds( "GmfTetrahedra" ,i, 4, iN[0], iN[2], iN[1], iN[3] );
+        const smIdType nodes[4] = { iN[0], iN[2], iN[1], iN[3] };
+        linNodes.insert( linNodes.end(), nodes, nodes + 4 );
+        linIDs.push_back( tetIDShift + i );
       }
       if ( !midN.empty() ) SMESHUtils::FreeVector( midN );
+      if ( linIDs.size() == theBatchSize || !tetraReader.More() )
+        if (( linStatus = addElements( "GmfTetrahedra", SMDSEntity_Tetra,
+                                       linNodes, linIDs, tetIDShift )) != DRS_OK )
+          status = linStatus;
     }
+    if ( tetraReader.IsTruncated() )
+      status = storeTruncated( "GmfTetrahedra", tetraReader.NbReadLines(), nbTet );
   }
 
   /* Read pyramids */
@@ -297,12 +348,19 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
   if ( int nbPyr = GmfStatKwd(meshID, GmfPyramids))
   {
     GmfGotoKwd(meshID, GmfPyramids);
-    for ( int i = 1; i <= nbPyr; ++i )
+    DriverGMF::BlockReader pyraReader( meshID, GmfPyramids, nbPyr, 5+1 );
+    for ( int i = 1; pyraReader.GetLine( iN ); ++i )
     {
-      GmfGetLin(meshID, GmfPyramids, &iN[0], &iN[1], &iN[2], &iN[3], &iN[4], &ref);
-      if ( !myMesh->AddVolumeWithID( iN[3], iN[2], iN[1], iN[0], iN[4], pyrIDShift + i ))
-        status = storeBadNodeIds( "GmfPyramids",i, 5, iN[0], iN[1],iN[2], iN[3], iN[4] );
+      const smIdType nodes[5] = { iN[3], iN[2], iN[1], iN[0], iN[4] };
+      linNodes.insert( linNodes.end(), nodes, nodes + 5 );
+      linIDs.push_back( pyrIDShift + i );
+      if ( linIDs.size() == theBatchSize || !pyraReader.More() )
+        if (( linStatus = addElements( "GmfPyramids", SMDSEntity_Pyramid,
+                                       linNodes, linIDs, pyrIDShift )) != DRS_OK )
+          status = linStatus;
     }
+    if ( pyraReader.IsTruncated() )
+      status = storeTruncated( "GmfPyramids", pyraReader.NbReadLines(), nbPyr );
   }
 
   /* Read hexahedra */
@@ -334,10 +392,9 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
     }
     // create hexhedra
     GmfGotoKwd(meshID, GmfHexahedra);
-    for ( int i = 1; i <= nbHex; ++i )
+    DriverGMF::BlockReader hexaReader( meshID, GmfHexahedra, nbHex, 8+1 );
+    for ( int i = 1; hexaReader.GetLine( iN ); ++i )
     {
-      GmfGetLin(meshID, GmfHexahedra, &iN[0], &iN[1], &iN[2], &iN[3],
-                &iN[4], &iN[5], &iN[6], &iN[7], &ref);
       std::vector<int>& midN = quadNodesAtHexahedra[ i ];
       if ( midN.size() == 20-8 ) // HEXA20
       {
@@ -379,13 +436,18 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
       }
       else // HEXA8
       {
-        if ( !myMesh->AddVolumeWithID( iN[0], iN[3], iN[2], iN[1],
-                                       iN[4], iN[7], iN[6], iN[5], hexIDShift + i ) )
-          status = storeBadNodeIds( "GmfHexahedra" ,i, 8, iN[0], iN[3], iN[2], iN[1],
-                                    iN[4], iN[7], iN[6], iN[5] );
+        const smIdType nodes[8] = { iN[0], iN[3], iN[2], iN[1], iN[4], iN[7], iN[6], iN[5] };
+        linNodes.insert( linNodes.end(), nodes, nodes + 8 );
+        linIDs.push_back( hexIDShift + i );
       }
       if ( !midN.empty() ) SMESHUtils::FreeVector( midN );
+      if ( linIDs.size() == theBatchSize || !hexaReader.More() )
+        if (( linStatus = addElements( "GmfHexahedra", SMDSEntity_Hexa,
+                                       linNodes, linIDs, hexIDShift )) != DRS_OK )
+          status = linStatus;
     }
+    if ( hexaReader.IsTruncated() )
+      status = storeTruncated( "GmfHexahedra", hexaReader.NbReadLines(), nbHex );
   }
 
   /* Read prism */
@@ -393,13 +455,19 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
   if ( int nbPrism = GmfStatKwd(meshID, GmfPrisms))
   {
     GmfGotoKwd(meshID, GmfPrisms);
-    for ( int i = 1; i <= nbPrism; ++i )
+    DriverGMF::BlockReader prismReader( meshID, GmfPrisms, nbPrism, 6+1 );
+    for ( int i = 1; prismReader.GetLine( iN ); ++i )
     {
-      GmfGetLin(meshID, GmfPrisms, &iN[0], &iN[1], &iN[2], &iN[3], &iN[4], &iN[5], &ref);
-      if ( !myMesh->AddVolumeWithID( iN[0], iN[2], iN[1], iN[3], iN[5], iN[4], prismIDShift + i))
-        status = storeBadNodeIds( "GmfPrisms",i,
-                                  6, iN[0], iN[1],iN[2], iN[3], iN[4], iN[5] );
+      const smIdType nodes[6] = { iN[0], iN[2], iN[1], iN[3], iN[5], iN[4] };
+      linNodes.insert( linNodes.end(), nodes, nodes + 6 );
+      linIDs.push_back( prismIDShift + i );
+      if ( linIDs.size() == theBatchSize || !prismReader.More() )
+        if (( linStatus = addElements( "GmfPrisms", SMDSEntity_Penta,
+                                       linNodes, linIDs, prismIDShift )) != DRS_OK )
+          status = linStatus;
     }
+    if ( prismReader.IsTruncated() )
+      status = storeTruncated( "GmfPrisms", prismReader.NbReadLines(), nbPrism );
   }
 
   // Read some entities into groups
@@ -441,11 +509,11 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
         myMesh->AddGroup( group );
 
         GmfGotoKwd(meshID, gmfKwd);
-        for ( int i = 0; i < nb; ++i )
-        {
-          GmfGetLin(meshID, gmfKwd, &iN[0] );
+        DriverGMF::BlockReader reader( meshID, gmfKwd, nb, 1 );
+        while ( reader.GetLine( iN ))
           group->Add( shift + iN[0] );
-        }
+        if ( reader.IsTruncated() )
+          status = storeTruncated( names[i], reader.NbReadLines(), nb );
       }
     }
   }
@@ -484,11 +552,11 @@ Driver_Mesh::Status DriverGMF_Read::Perform()
         myMesh->AddGroup( group );
 
         GmfGotoKwd(meshID, gmfKwd);
-        for ( int i = 0; i < nb; ++i )
-        {
-          GmfGetLin(meshID, gmfKwd, &iN[0] );
+        DriverGMF::BlockReader reader( meshID, gmfKwd, nb, 1 );
+        while ( reader.GetLine( iN ))
           group->Add( shift + iN[0] );
-        }
+        if ( reader.IsTruncated() )
+          status = storeTruncated( names[i], reader.NbReadLines(), nb );
       }
     }
   }
@@ -511,18 +579,40 @@ Driver_Mesh::Status DriverGMF_Read::storeBadNodeIds(const char* gmfKwd, int elem
   if ( myStatus != DRS_OK )
     return myStatus;
 
-  SMESH_Comment msg;
+  std::vector<smIdType> nodeIDs( nb );
 
   va_list VarArg;
   va_start(VarArg, nb);
 
+  for ( int i = 0; i < nb; ++i )
+    nodeIDs[i] = va_arg(VarArg, int );
+
+  va_end(VarArg);
+
+  return storeBadNodeIds( gmfKwd, elemNb, nodeIDs.data(), nb );
+}
+
+//================================================================================
+/*!
+ * \brief Store a message about invalid IDs of nodes
+ */
+//================================================================================
+
+Driver_Mesh::Status DriverGMF_Read::storeBadNodeIds(const char*     gmfKwd,
+                                                    int             elemNb,
+                                                    const smIdType* nodeIDs,
+                                                    int             nb)
+{
+  if ( myStatus != DRS_OK )
+    return myStatus;
+
+  SMESH_Comment msg;
+
   for ( int i = 0; i < nb; ++i )
   {
-    int id = va_arg(VarArg, int );
-    if ( !myMesh->FindNode( id ))
-      msg << " " << id;
+    if ( !myMesh->FindNode( nodeIDs[i] ))
+      msg << " " << nodeIDs[i];
   }
-  va_end(VarArg);
 
   if ( !msg.empty() )
   {
@@ -538,6 +628,60 @@ Driver_Mesh::Status DriverGMF_Read::storeBadNodeIds(const char* gmfKwd, int elem
   return DRS_OK;
 }
 
+//================================================================================
+/*!
+ * \brief Store a message about a keyword having less lines than announced
+ */
+//================================================================================
+
+Driver_Mesh::Status DriverGMF_Read::storeTruncated(const char* gmfKwd, int nbRead, int nbLines)
+{
+  if ( myStatus == DRS_FAIL )
+    return myStatus;
+
+  return addMessage( SMESH_Comment("Truncated file: only ") << nbRead << " of "
+                     << nbLines << " lines of " << gmfKwd << " are read",
+                     /*fatal=*/true );
+}
+
+//================================================================================
+/*!
+ * \brief Create linear elements of one type at once and clear the given vectors
+ *  \param [in] gmfKwd - GMF keyword of elements, used in messages
+ *  \param [in] type - type of elements
+ *  \param [in,out] nodeIDs - IDs of nodes of all elements
+ *  \param [in,out] elemIDs - IDs of elements
+ *  \param [in] idShift - difference between element ID and element index in the file
+ *  \return Status - DRS_OK if all elements are created
+ */
+//================================================================================
+
+Driver_Mesh::Status DriverGMF_Read::addElements(const char*            gmfKwd,
+                                                SMDSAbs_EntityType     type,
+                                                std::vector<smIdType>& nodeIDs,
+                                                std::vector<smIdType>& elemIDs,
+                                                smIdType               idShift)
+{
+  Status status = DRS_OK;
+
+  const int      nbNodes = SMDS_MeshCell::NbNodes( type );
+  const smIdType nbElems = elemIDs.size();
+  for ( smIdType i = 0; i < nbElems; )
+  {
+    i += myMesh->AddElementsWithID( type, nbElems - i, &nodeIDs[ i * nbNodes ], &elemIDs[ i ]);
+    if ( i < nbElems ) // i-th element is not created
+    {
+      status = storeBadNodeIds( gmfKwd, FromSmIdType<int>( elemIDs[ i ] - idShift ),
+                                &nodeIDs[ i * nbNodes ], nbNodes );
+      ++i;
+    }
+  }
+  nodeIDs.clear();
+  elemIDs.clear();
+
+  return status;
+}
+
 //================================================================================
 /*!
  * \brief Return number of mesh entities in a file
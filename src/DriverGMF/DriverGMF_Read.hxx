@@ -30,6 +30,7 @@
 #include "SMESH_DriverGMF.hxx"
 
 #include "Driver_SMESHDS_Mesh.h"
+#include "SMDSAbs_ElementType.hxx"
 
 #include <vector>
 #include <string>
@@ -65,6 +66,14 @@ public:
  private:
 
   Status storeBadNodeIds(const char* gmfKwd, int elemNb, int nb, ...);
+  Status storeBadNodeIds(const char* gmfKwd, int elemNb, const smIdType* nodeIDs, int nb);
+  Status storeTruncated(const char* gmfKwd, int nbRead, int nbLines);
+
+  Status addElements(const char*            gmfKwd,
+                     SMDSAbs_EntityType     type,
+                     std::vector<smIdType>& nodeIDs,
+                     std::vector<smIdType>& elemIDs,
+                     smIdType               idShift);
 
   bool _makeRequiredGroups;
   bool _makeFaultGroups;
@@ -43,15 +43,16 @@ extern "C"
 
 #include <vector>
 
-#define BEGIN_ELEM_WRITE( SMDSEntity, GmfKwd, elem )                    \
+#define BEGIN_ELEM_WRITE( SMDSEntity, GmfKwd, elem, nbNodes )           \
   elemIt = elementIterator( SMDSEntity );                               \
   if ( elemIt->more() )                                                 \
   {                                                                     \
   GmfSetKwd(meshID, GmfKwd, myMesh->GetMeshInfo().NbElements( SMDSEntity )); \
+  DriverGMF::BlockWriter writer( meshID, GmfKwd, nbNodes + 1 );         \
   for ( int gmfID = 1; elemIt->more(); ++gmfID )                        \
   {                                                                     \
   const SMDS_MeshElement* elem = elemIt->next();                        \
-  GmfSetLin(meshID, GmfKwd,
+  writer.AddLine({
 
 #define BEGIN_EXTRA_VERTICES_WRITE( SMDSGeom, LinType, GmfKwd, elem )   \
   elemIt = elementIterator( SMDSGeom );                                 \
@@ -69,11 +70,11 @@ extern "C"
   GmfSetLin(meshID, GmfKwd, gmfID, elem->NbNodes() - elem->NbCornerNodes(),
 
 #define END_ELEM_WRITE( elem )                  \
-  elem->getshapeId() );                         \
+  elem->getshapeId() });                        \
   }}
 
 #define END_ELEM_WRITE_ADD_TO_MAP( elem, e2id )            \
-  elem->getshapeId() );                                    \
+  elem->getshapeId() });                                   \
   e2id.insert( e2id.end(), std::make_pair( elem, gmfID )); \
   }}
 
@@ -116,18 +117,23 @@ Driver_Mesh::Status DriverGMF_Write::Perform()
 
   DriverGMF::MeshCloser aMeshCloser( meshID ); // An object closing GMF mesh at destruction
 
-  // nodes
-  std::map< const SMDS_MeshNode* , int > node2IdMap;
-  smIdType iN = 0, nbNodes = myMesh->NbNodes();
+  // nodes; gmf IDs of nodes are stored at indices equal to node IDs
+  std::vector< int > gmfNodeIDs( myMesh->MaxNodeID() + 1, 0 );
+  int iN = 0;
+  smIdType nbNodes = myMesh->NbNodes();
   GmfSetKwd( meshID, GmfVertices, nbNodes );
-  double xyz[3];
-  SMDS_NodeIteratorPtr nodeIt = myMesh->nodesIterator();
-  while ( nodeIt->more() )
   {
-    const SMDS_MeshNode* n = nodeIt->next();
-    n->GetXYZ( xyz );
-    GmfSetLin( meshID, GmfVertices, xyz[0], xyz[1], xyz[2], n->getshapeId() );
-    node2IdMap.insert( node2IdMap.end(), std::make_pair( n, ++iN ));
+    DriverGMF::BlockWriter vertexWriter( meshID, GmfVertices, /*nbInt=*/1, /*nbReal=*/3 );
+    double xyz[3];
+    SMDS_NodeIteratorPtr nodeIt = myMesh->nodesIterator();
+    while ( nodeIt->more() )
+    {
+      const SMDS_MeshNode* n = nodeIt->next();
+      n->GetXYZ( xyz );
+      int shapeID = n->getshapeId();
+      vertexWriter.AddLine( &shapeID, xyz );
+      gmfNodeIDs[ n->GetID() ] = ++iN;
+    }
   }
   if ( iN != nbNodes )
     return addMessage("Wrong nb of nodes returned by nodesIterator", /*fatal=*/true);
@@ -138,126 +144,126 @@ Driver_Mesh::Status DriverGMF_Write::Perform()
 
   // edges
   TElem2IDMap edge2IDMap;
-  BEGIN_ELEM_WRITE( SMDSGeom_EDGE, GmfEdges, edge )
-    node2IdMap[ edge->GetNode( 0 )],
-    node2IdMap[ edge->GetNode( 1 )],
+  BEGIN_ELEM_WRITE( SMDSGeom_EDGE, GmfEdges, edge, 2 )
+    gmfNodeIDs[ edge->GetNode( 0 )->GetID() ],
+    gmfNodeIDs[ edge->GetNode( 1 )->GetID() ],
     END_ELEM_WRITE_ADD_TO_MAP( edge, edge2IDMap );
 
   // nodes of quadratic edges
   BEGIN_EXTRA_VERTICES_WRITE( SMDSGeom_EDGE, SMDSEntity_Edge,
                               GmfExtraVerticesAtEdges, edge )
-    node2IdMap[ edge->GetNode( 2 )]
+    gmfNodeIDs[ edge->GetNode( 2 )->GetID() ]
     END_EXTRA_VERTICES_WRITE();
 
   // triangles
   TElem2IDMap tria2IDMap;
-  BEGIN_ELEM_WRITE( SMDSGeom_TRIANGLE, GmfTriangles, tria )
-    node2IdMap[ tria->GetNode( 0 )],
-    node2IdMap[ tria->GetNode( 1 )],
-    node2IdMap[ tria->GetNode( 2 )],
+  BEGIN_ELEM_WRITE( SMDSGeom_TRIANGLE, GmfTriangles, tria, 3 )
+    gmfNodeIDs[ tria->GetNode( 0 )->GetID() ],
+    gmfNodeIDs[ tria->GetNode( 1 )->GetID() ],
+    gmfNodeIDs[ tria->GetNode( 2 )->GetID() ],
     END_ELEM_WRITE_ADD_TO_MAP( tria, tria2IDMap );
 
   // nodes of quadratic triangles
   BEGIN_EXTRA_VERTICES_WRITE( SMDSGeom_TRIANGLE, SMDSEntity_Triangle,
                               GmfExtraVerticesAtTriangles, tria )
-    node2IdMap[ tria->GetNode( 3 )],
-    node2IdMap[ tria->GetNode( 4 )],
-    node2IdMap[ tria->GetNode( 5 )],
-    node2IdMap[ tria->GetNodeWrap( 6 )] // for TRIA7
+    gmfNodeIDs[ tria->GetNode( 3 )->GetID() ],
+    gmfNodeIDs[ tria->GetNode( 4 )->GetID() ],
+    gmfNodeIDs[ tria->GetNode( 5 )->GetID() ],
+    gmfNodeIDs[ tria->GetNodeWrap( 6 )->GetID() ] // for TRIA7
     END_EXTRA_VERTICES_WRITE();
 
   // quadrangles
   TElem2IDMap quad2IDMap;
-  BEGIN_ELEM_WRITE( SMDSGeom_QUADRANGLE, GmfQuadrilaterals, quad )
-    node2IdMap[ quad->GetNode( 0 )],
-    node2IdMap[ quad->GetNode( 1 )],
-    node2IdMap[ quad->GetNode( 2 )],
-    node2IdMap[ quad->GetNode( 3 )],
+  BEGIN_ELEM_WRITE( SMDSGeom_QUADRANGLE, GmfQuadrilaterals, quad, 4 )
+    gmfNodeIDs[ quad->GetNode( 0 )->GetID() ],
+    gmfNodeIDs[ quad->GetNode( 1 )->GetID() ],
+    gmfNodeIDs[ quad->GetNode( 2 )->GetID() ],
+    gmfNodeIDs[ quad->GetNode( 3 )->GetID() ],
     END_ELEM_WRITE_ADD_TO_MAP( quad, quad2IDMap );
 
   // nodes of quadratic quadrangles
   BEGIN_EXTRA_VERTICES_WRITE( SMDSGeom_QUADRANGLE, SMDSEntity_Quadrangle,
                               GmfExtraVerticesAtQuadrilaterals, quad )
-    node2IdMap[ quad->GetNode( 4 )],
-    node2IdMap[ quad->GetNode( 5 )],
-    node2IdMap[ quad->GetNode( 6 )],
-    node2IdMap[ quad->GetNode( 7 )],
-    node2IdMap[ quad->GetNodeWrap( 8 )] // for QUAD9
+    gmfNodeIDs[ quad->GetNode( 4 )->GetID() ],
+    gmfNodeIDs[ quad->GetNode( 5 )->GetID() ],
+    gmfNodeIDs[ quad->GetNode( 6 )->GetID() ],
+    gmfNodeIDs[ quad->GetNode( 7 )->GetID() ],
+    gmfNodeIDs[ quad->GetNodeWrap( 8 )->GetID() ] // for QUAD9
     END_EXTRA_VERTICES_WRITE();
 
   // terahedra
-  BEGIN_ELEM_WRITE( SMDSGeom_TETRA, GmfTetrahedra, tetra )
-    node2IdMap[ tetra->GetNode( 0 )],
-    node2IdMap[ tetra->GetNode( 2 )],
-    node2IdMap[ tetra->GetNode( 1 )],
-    node2IdMap[ tetra->GetNode( 3 )],
+  BEGIN_ELEM_WRITE( SMDSGeom_TETRA, GmfTetrahedra, tetra, 4 )
+    gmfNodeIDs[ tetra->GetNode( 0 )->GetID() ],
+    gmfNodeIDs[ tetra->GetNode( 2 )->GetID() ],
+    gmfNodeIDs[ tetra->GetNode( 1 )->GetID() ],
+    gmfNodeIDs[ tetra->GetNode( 3 )->GetID() ],
     END_ELEM_WRITE( tetra );
 
   // nodes of quadratic terahedra
   BEGIN_EXTRA_VERTICES_WRITE( SMDSGeom_TETRA, SMDSEntity_Tetra,
                               GmfExtraVerticesAtTetrahedra, tetra )
-    node2IdMap[ tetra->GetNode( 6 )],
-    node2IdMap[ tetra->GetNode( 5 )],
-    node2IdMap[ tetra->GetNode( 4 )],
-    node2IdMap[ tetra->GetNode( 7 )],
-    node2IdMap[ tetra->GetNode( 9 )],
-    node2IdMap[ tetra->GetNode( 8 )]
-    //node2IdMap[ tetra->GetNodeWrap( 10 )], // for TETRA11
+    gmfNodeIDs[ tetra->GetNode( 6 )->GetID() ],
+    gmfNodeIDs[ tetra->GetNode( 5 )->GetID() ],
+    gmfNodeIDs[ tetra->GetNode( 4 )->GetID() ],
+    gmfNodeIDs[ tetra->GetNode( 7 )->GetID() ],
+    gmfNodeIDs[ tetra->GetNode( 9 )->GetID() ],
+    gmfNodeIDs[ tetra->GetNode( 8 )->GetID() ]
+    //gmfNodeIDs[ tetra->GetNodeWrap( 10 )->GetID() ], // for TETRA11
     END_EXTRA_VERTICES_WRITE();
 
   // pyramids
-  BEGIN_ELEM_WRITE( SMDSEntity_Pyramid, GmfPyramids, pyra )
-    node2IdMap[ pyra->GetNode( 3 )],
-    node2IdMap[ pyra->GetNode( 2 )],
-    node2IdMap[ pyra->GetNode( 1 )],
-    node2IdMap[ pyra->GetNode( 0 )],
-    node2IdMap[ pyra->GetNode( 4 )],
+  BEGIN_ELEM_WRITE( SMDSEntity_Pyramid, GmfPyramids, pyra, 5 )
+    gmfNodeIDs[ pyra->GetNode( 3 )->GetID() ],
+    gmfNodeIDs[ pyra->GetNode( 2 )->GetID() ],
+    gmfNodeIDs[ pyra->GetNode( 1 )->GetID() ],
+    gmfNodeIDs[ pyra->GetNode( 0 )->GetID() ],
+    gmfNodeIDs[ pyra->GetNode( 4 )->GetID() ],
     END_ELEM_WRITE( pyra );
 
   // hexahedra
-  BEGIN_ELEM_WRITE( SMDSGeom_HEXA, GmfHexahedra, hexa )
-    node2IdMap[ hexa->GetNode( 0 )],
-    node2IdMap[ hexa->GetNode( 3 )],
-    node2IdMap[ hexa->GetNode( 2 )],
-    node2IdMap[ hexa->GetNode( 1 )],
-    node2IdMap[ hexa->GetNode( 4 )],
-    node2IdMap[ hexa->GetNode( 7 )],
-    node2IdMap[ hexa->GetNode( 6 )],
-    node2IdMap[ hexa->GetNode( 5 )],
+  BEGIN_ELEM_WRITE( SMDSGeom_HEXA, GmfHexahedra, hexa, 8 )
+    gmfNodeIDs[ hexa->GetNode( 0 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 3 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 2 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 1 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 4 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 7 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 6 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 5 )->GetID() ],
     END_ELEM_WRITE( hexa );
 
   // nodes of quadratic hexahedra
   BEGIN_EXTRA_VERTICES_WRITE( SMDSGeom_HEXA, SMDSEntity_Hexa,
                               GmfExtraVerticesAtHexahedra, hexa )
-    node2IdMap[ hexa->GetNode( 11 )], // HEXA20
-    node2IdMap[ hexa->GetNode( 10 )],
-    node2IdMap[ hexa->GetNode(  9 )],
-    node2IdMap[ hexa->GetNode(  8 )],
-    node2IdMap[ hexa->GetNode( 15 )],
-    node2IdMap[ hexa->GetNode( 14 )],
-    node2IdMap[ hexa->GetNode( 13 )],
-    node2IdMap[ hexa->GetNode( 12 )],
-    node2IdMap[ hexa->GetNode( 16 )],
-    node2IdMap[ hexa->GetNode( 19 )],
-    node2IdMap[ hexa->GetNodeWrap( 18 )], // + HEXA27
-    node2IdMap[ hexa->GetNodeWrap( 17 )],
-    node2IdMap[ hexa->GetNodeWrap( 20 )],
-    node2IdMap[ hexa->GetNodeWrap( 24 )],
-    node2IdMap[ hexa->GetNodeWrap( 23 )],
-    node2IdMap[ hexa->GetNodeWrap( 22 )],
-    node2IdMap[ hexa->GetNodeWrap( 21 )],
-    node2IdMap[ hexa->GetNodeWrap( 25 )],
-    node2IdMap[ hexa->GetNodeWrap( 26 )]
+    gmfNodeIDs[ hexa->GetNode( 11 )->GetID() ], // HEXA20
+    gmfNodeIDs[ hexa->GetNode( 10 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode(  9 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode(  8 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 15 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 14 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 13 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 12 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 16 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNode( 19 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNodeWrap( 18 )->GetID() ], // + HEXA27
+    gmfNodeIDs[ hexa->GetNodeWrap( 17 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNodeWrap( 20 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNodeWrap( 24 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNodeWrap( 23 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNodeWrap( 22 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNodeWrap( 21 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNodeWrap( 25 )->GetID() ],
+    gmfNodeIDs[ hexa->GetNodeWrap( 26 )->GetID() ]
     END_EXTRA_VERTICES_WRITE();
 
   // prism
-  BEGIN_ELEM_WRITE( SMDSEntity_Penta, GmfPrisms, prism )
-    node2IdMap[ prism->GetNode( 0 )],
-    node2IdMap[ prism->GetNode( 2 )],
-    node2IdMap[ prism->GetNode( 1 )],
-    node2IdMap[ prism->GetNode( 3 )],
-    node2IdMap[ prism->GetNode( 5 )],
-    node2IdMap[ prism->GetNode( 4 )],
+  BEGIN_ELEM_WRITE( SMDSEntity_Penta, GmfPrisms, prism, 6 )
+    gmfNodeIDs[ prism->GetNode( 0 )->GetID() ],
+    gmfNodeIDs[ prism->GetNode( 2 )->GetID() ],
+    gmfNodeIDs[ prism->GetNode( 1 )->GetID() ],
+    gmfNodeIDs[ prism->GetNode( 3 )->GetID() ],
+    gmfNodeIDs[ prism->GetNode( 5 )->GetID() ],
+    gmfNodeIDs[ prism->GetNode( 4 )->GetID() ],
     END_ELEM_WRITE( prism );
 
 
@@ -321,20 +327,21 @@ Driver_Mesh::Status DriverGMF_Write::Perform()
 
       // write the group
       GmfSetKwd( meshID, gmfKwd, nbOkElems );
+      DriverGMF::BlockWriter writer( meshID, gmfKwd, /*nbInt=*/1 );
       elemIt = group->GetElements();
       if ( elem2IDMap )
         for ( ; elemIt->more(); )
         {
           const SMDS_MeshElement* elem = elemIt->next();
           if ( elem->GetEntityType() == smdsEntity )
-            GmfSetLin( meshID, gmfKwd, (*elem2IDMap)[ elem ] );
+            writer.AddLine({ (int) (*elem2IDMap)[ elem ] });
         }
       else
         for ( int gmfID = 1; elemIt->more(); ++gmfID)
         {
           const SMDS_MeshElement* elem = elemIt->next();
           if ( elem->GetEntityType() == smdsEntity )
-            GmfSetLin( meshID, gmfKwd, gmfID );
+            writer.AddLine({ gmfID });
         }
 
     } // loop on groups
@@ -949,6 +949,200 @@ void GmfSetLin(int MshIdx, int KwdCod, ...)
 }
 
 
+/*----------------------------------------------------------*/
+/* Count integer and real fields of a line of a regular kwd */
+/* return 0 if lines are of variable size                   */
+/*----------------------------------------------------------*/
+
+static int CntFld(KwdSct *kwd, int *NmbInt, int *NmbDbl)
+{
+        int i;
+
+        *NmbInt = *NmbDbl = 0;
+
+        if(kwd->typ != RegKwd)
+                return(0);
+
+        for(i=0;i<kwd->SolSiz;i++)
+                if(kwd->fmt[i] == 'i')
+                        (*NmbInt)++;
+                else if(kwd->fmt[i] == 'r')
+                        (*NmbDbl)++;
+                else
+                        return(0);
+
+        return(1);
+}
+
+
+/*----------------------------------------------------------*/
+/* Read several lines of the current kwd at once:           */
+/* integer fields go to IntTab and real ones to DblTab      */
+/* return the number of lines read                          */
+/*----------------------------------------------------------*/
+
+int GmfGetBlk(int MshIdx, int KwdCod, int NmbLin, int *IntTab, double *DblTab)
+{
+        int i, j, k, NmbInt, NmbDbl, LinSiz;
+        float FltVal;
+        unsigned char swp, *blk, *wrd;
+        GmfMshSct *msh;
+        KwdSct *kwd;
+
+        if( (MshIdx < 1) || (MshIdx > MaxMsh) || (KwdCod < 1) || (KwdCod > GmfMaxKwd) || (NmbLin < 1) )
+                return(0);
+
+        msh = GmfMshTab[ MshIdx ];
+        kwd = &msh->KwdTab[ KwdCod ];
+
+        if(!CntFld(kwd, &NmbInt, &NmbDbl))
+                return(0);
+
+        if(msh->typ & Asc)
+        {
+                for(i=0;i<NmbLin;i++)
+                        for(j=0;j<kwd->SolSiz;j++)
+                                if(kwd->fmt[j] == 'i')
+                                {
+                                        if(fscanf(msh->hdl, "%d", IntTab++) != 1)
+                                                return(i);
+                                }
+                                else if(fscanf(msh->hdl, "%lf", DblTab++) != 1)
+                                        return(i);
+
+                return(NmbLin);
+        }
+
+        /* Read all the lines at once and decode them */
+
+        LinSiz = kwd->NmbWrd * WrdSiz;
+
+        if(!(blk = malloc((size_t)NmbLin * LinSiz)))
+                return(0);
+
+        NmbLin = fread(blk, LinSiz, NmbLin, msh->hdl);
+        wrd = blk;
+
+        for(i=0;i<NmbLin;i++)
+                for(j=0;j<kwd->SolSiz;j++)
+                        if( (kwd->fmt[j] == 'r') && (msh->ver >= 2) )
+                        {
+                                if(msh->cod != 1)
+                                        for(k=0;k<4;k++)
+                                        {
+                                                swp = wrd[7-k];
+                                                wrd[7-k] = wrd[k];
+                                                wrd[k] = swp;
+                                        }
+
+                                memcpy(DblTab++, wrd, 8);
+                                wrd += 8;
+                        }
+                        else
+                        {
+                                if(msh->cod != 1)
+                                        for(k=0;k<2;k++)
+                                        {
+                                                swp = wrd[3-k];
+                                                wrd[3-k] = wrd[k];
+                                                wrd[k] = swp;
+                                        }
+
+                                if(kwd->fmt[j] == 'i')
+                                        memcpy(IntTab++, wrd, 4);
+                                else
+                                {
+                                        memcpy(&FltVal, wrd, 4);
+                                        *(DblTab++) = FltVal;
+                                }
+                                wrd += 4;
+                        }
+
+        free(blk);
+
+        return(NmbLin);
+}
+
+
+/*----------------------------------------------------------*/
+/* Write several lines of the current kwd at once:          */
+/* integer fields are taken from IntTab and real ones from  */
+/* DblTab, return the number of lines written               */
+/*----------------------------------------------------------*/
+
+int GmfSetBlk(int MshIdx, int KwdCod, int NmbLin, const int *IntTab, const double *DblTab)
+{
+        int i, j, NmbInt, NmbDbl, LinSiz;
+        float FltVal;
+        unsigned char *blk, *wrd;
+        GmfMshSct *msh;
+        KwdSct *kwd;
+
+        if( (MshIdx < 1) || (MshIdx > MaxMsh) || (KwdCod < 1) || (KwdCod > GmfMaxKwd) || (NmbLin < 1) )
+                return(0);
+
+        msh = GmfMshTab[ MshIdx ];
+        kwd = &msh->KwdTab[ KwdCod ];
+
+        if(!CntFld(kwd, &NmbInt, &NmbDbl))
+                return(0);
+
+        if(msh->typ & Asc)
+        {
+                for(i=0;i<NmbLin;i++)
+                {
+                        for(j=0;j<kwd->SolSiz;j++)
+                                if(kwd->fmt[j] == 'i')
+                                        fprintf(msh->hdl, "%d ", *(IntTab++));
+                                else if(msh->ver == 1)
+                                        fprintf(msh->hdl, "%g ", (float)*(DblTab++));
+                                else
+                                        fprintf(msh->hdl, "%.15g ", *(DblTab++));
+
+                        fprintf(msh->hdl, "\n");
+                }
+
+                return(NmbLin);
+        }
+
+        /* Flush lines written by GmfSetLin() and write all the lines at once */
+
+        RecBlk(msh, msh->buf, 0);
+
+        LinSiz = kwd->NmbWrd * WrdSiz;
+
+        if(!(blk = malloc((size_t)NmbLin * LinSiz)))
+                return(0);
+
+        wrd = blk;
+
+        for(i=0;i<NmbLin;i++)
+                for(j=0;j<kwd->SolSiz;j++)
+                        if(kwd->fmt[j] == 'i')
+                        {
+                                memcpy(wrd, IntTab++, 4);
+                                wrd += 4;
+                        }
+                        else if(msh->ver == 1)
+                        {
+                                FltVal = (float)*(DblTab++);
+                                memcpy(wrd, &FltVal, 4);
+                                wrd += 4;
+                        }
+                        else
+                        {
+                                memcpy(wrd, DblTab++, 8);
+                                wrd += 8;
+                        }
+
+        NmbLin = fwrite(blk, LinSiz, NmbLin, msh->hdl);
+
+        free(blk);
+
+        return(NmbLin);
+}
+
+
 /*----------------------------------------------------------*/
 /* Private procedure for transmesh : copy a whole line          */
 /*----------------------------------------------------------*/
@@ -140,6 +140,8 @@ MESHDriverGMF_EXPORT extern int GmfGotoKwd(int, int);
 MESHDriverGMF_EXPORT extern int GmfSetKwd(int, int, ...);
 MESHDriverGMF_EXPORT extern void GmfGetLin(int, int, ...);
 MESHDriverGMF_EXPORT extern void GmfSetLin(int, int, ...);
+MESHDriverGMF_EXPORT extern int GmfGetBlk(int, int, int, int *, double *);
+MESHDriverGMF_EXPORT extern int GmfSetBlk(int, int, int, const int *, const double *);
 
 
 /*----------------------------------------------------------*/
@@ -27,7 +27,10 @@
 //
 #include "DriverMED_Family.h"
 
-#include <sstream>      
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <unordered_map>
 
 using namespace std;
 
@@ -135,11 +138,115 @@ DriverMED_Family
   return myElements.empty(); 
 }
 
+namespace
+{
+  //================================================================================
+  /*!
+   * \brief A group or a sub-mesh of a certain element type, source of families
+   */
+  //================================================================================
+
+  struct TFamilySource
+  {
+    SMDSAbs_ElementType myType;
+    std::string         myName;
+    int                 myGroupAttributVal;
+
+    TFamilySource( SMDSAbs_ElementType type, const std::string& name, int attrVal )
+      : myType( type ), myName( name ), myGroupAttributVal( attrVal ) {}
+  };
+
+  //================================================================================
+  /*!
+   * \brief Membership of nodes and elements in family sources.
+   *
+   * Each element refers to a set of sources it belongs to; the sets are
+   * created on the fly when an element is added to a next source. Indices of
+   * the sets of nodes and elements are stored in arrays indexed by node and
+   * element IDs. Then each used set gives one family.
+   */
+  //================================================================================
+
+  class TMembership
+  {
+    std::vector< std::vector< int > >      mySets;     // sorted source indices; #0 is empty
+    std::unordered_map< uint64_t, int >    myNextSet;  // ( set, source ) -> set
+    std::pair< uint64_t, int >             myLastNext; // last used item of myNextSet
+
+  public:
+
+    std::vector< int > myNodeSets, myElemSets; // set indices by node and element IDs
+    std::vector< const SMDS_MeshElement* > myNodes, myElems; // elements by IDs if needed
+    bool myStoreElements;
+
+    TMembership( bool storeElements ): mySets( 1 ), myLastNext( ~uint64_t(0), 0 ),
+                                       myStoreElements( storeElements ) {}
+
+    size_t NbSets() const { return mySets.size(); }
+
+    const std::vector< int >& GetSources( int iSet ) const { return mySets[ iSet ]; }
+
+    //! Add an element to a source
+    void Add( const SMDS_MeshElement* theElem, int theSource )
+    {
+      const bool isNode = ( theElem->GetType() == SMDSAbs_Node );
+      std::vector< int >& sets = isNode ? myNodeSets : myElemSets;
+
+      size_t id = theElem->GetID();
+      if ( id >= sets.size() )
+      {
+        sets.resize( id + 1, 0 );
+        if ( myStoreElements )
+          ( isNode ? myNodes : myElems ).resize( id + 1, 0 );
+      }
+      if ( myStoreElements )
+        ( isNode ? myNodes : myElems )[ id ] = theElem;
+
+      int & iSet = sets[ id ];
+      if ( !mySets[ iSet ].empty() && mySets[ iSet ].back() == theSource )
+        return; // already added
+
+      uint64_t key = ( uint64_t( iSet ) << 32 ) | uint32_t( theSource );
+      if ( key != myLastNext.first )
+      {
+        auto it2isNew = myNextSet.insert( std::make_pair( key, (int) mySets.size() ));
+        if ( it2isNew.second )
+        {
+          std::vector< int > sources = mySets[ iSet ];
+          sources.push_back( theSource );
+          mySets.push_back( std::move( sources ));
+        }
+        myLastNext = *it2isNew.first;
+      }
+      iSet = myLastNext.second;
+    }
+  };
+
+  //================================================================================
+  /*!
+   * \brief Return group attribute value storing group color
+   */
+  //================================================================================
+
+  int groupAttributVal( SMESHDS_GroupBase* theGroup )
+  {
+    Quantity_Color aColor = theGroup->GetColor();
+    int aR = int( aColor.Red()   * 255 );
+    int aG = int( aColor.Green() * 255 );
+    int aB = int( aColor.Blue()  * 255 );
+    return (int)( aR*1000000 + aG*1000 + aB );
+  }
+}
+
 //=============================================================================
 /*!
  *  Split each group from list <aGroups> on some parts (families)
  *  on the basis of the elements membership in other groups from this list.
  *  Resulting families have no common elements.
+ *
+ *  All nodes and elements are visited once per group or sub-mesh they belong to;
+ *  each one gets a set of groups and sub-meshes it belongs to and each set
+ *  makes a family.
  */
 //=============================================================================
 DriverMED_FamilyPtrList 
@@ -152,7 +259,9 @@ DriverMED_Family
                const bool doGroupOfVolumes,
                const bool doGroupOf0DElems,
                const bool doGroupOfBalls,
-               const bool doAllInGroups)
+               const bool doAllInGroups,
+               std::vector<int>* theNodeFamilyIds,
+               std::vector<int>* theElemFamilyIds)
 {
   DriverMED_FamilyPtrList aFamilies;
 
@@ -169,43 +278,52 @@ DriverMED_Family
   int aNodeFamId = FIRST_NODE_FAMILY;
   int aElemFamId = FIRST_ELEM_FAMILY;
 
-  // Process sub-meshes
+  const bool toFillIds = ( theNodeFamilyIds && theElemFamilyIds );
+
+  vector< TFamilySource > aSources;
+  TMembership             aMembership( !toFillIds );
+
+  // Process sub-meshes; a sub-mesh gives a source per element type
   while ( theSubMeshes->more() )
   {
-    SMESHDS_SubMesh* aSubMesh = const_cast< SMESHDS_SubMesh* >( theSubMeshes->next() );
-    const int anId = aSubMesh->GetID();
+    const SMESHDS_SubMesh* aSubMesh = theSubMeshes->next();
     if ( aSubMesh->IsComplexSubmesh() )
       continue; // submesh containing other submeshs
-    DriverMED_FamilyPtrList aSMFams = SplitByType(aSubMesh,anId);
-    DriverMED_FamilyPtrList::iterator aSMFamsIter = aSMFams.begin();
-    for (; aSMFamsIter != aSMFams.end(); aSMFamsIter++)
+
+    char submeshGrpName[ 30 ];
+    sprintf( submeshGrpName, "SubMesh %d", aSubMesh->GetID() );
+
+    SMDS_NodeIteratorPtr aNodesIter = aSubMesh->GetNodes();
+    if ( aNodesIter->more() )
     {
-      DriverMED_FamilyPtr aFam2 = (*aSMFamsIter);
-      DriverMED_FamilyPtrList::iterator aFamsIter = aFamilies.begin();
-      while (aFamsIter != aFamilies.end())
+      aSources.push_back( TFamilySource( SMDSAbs_Node, submeshGrpName, 0 ));
+      while ( aNodesIter->more() )
+        aMembership.Add( aNodesIter->next(), aSources.size() - 1 );
+    }
+
+    int aSourceOfType[ SMDSAbs_NbElementTypes ];
+    std::fill( aSourceOfType, aSourceOfType + SMDSAbs_NbElementTypes, -1 );
+
+    SMDS_ElemIteratorPtr anElemsIter = aSubMesh->GetElements();
+    while ( anElemsIter->more() )
+    {
+      const SMDS_MeshElement* anElem = anElemsIter->next();
+      switch ( anElem->GetType() )
+      {
+      case SMDSAbs_Edge:
+      case SMDSAbs_Face:
+      case SMDSAbs_Volume:
       {
-        DriverMED_FamilyPtr aFam1 = *aFamsIter;
-        DriverMED_FamilyPtrList::iterator aCurrIter = aFamsIter++;
-        if (aFam1->myType == aFam2->myType)
+        int & iSource = aSourceOfType[ anElem->GetType() ];
+        if ( iSource < 0 )
         {
-          DriverMED_FamilyPtr aCommon (new DriverMED_Family);
-          aFam1->Split(aFam2, aCommon);
-          if (!aCommon->IsEmpty())
-          {
-            aFamilies.push_back(aCommon);
-          }
-          if (aFam1->IsEmpty())
-          {
-            aFamilies.erase(aCurrIter);
-          }
-          if (aFam2->IsEmpty()) 
-            break;
+          iSource = aSources.size();
+          aSources.push_back( TFamilySource( anElem->GetType(), submeshGrpName, 0 ));
         }
+        aMembership.Add( anElem, iSource );
+        break;
       }
-      // The rest elements of family
-      if (!aFam2->IsEmpty())
-      {
-        aFamilies.push_back(aFam2);
+      default:;
       }
     }
   }
@@ -214,36 +332,41 @@ DriverMED_Family
   SMESHDS_GroupBasePtrList::const_iterator aGroupsIter = theGroups.begin();
   for (; aGroupsIter != theGroups.end(); aGroupsIter++)
   {
-    DriverMED_FamilyPtr aFam2 (new DriverMED_Family);
-    aFam2->Init(*aGroupsIter);
+    SMESHDS_GroupBase* aGroup = *aGroupsIter;
+    SMDS_ElemIteratorPtr elemIt = aGroup->GetElements();
+    if ( !elemIt->more() )
+      continue;
+
+    aSources.push_back( TFamilySource( aGroup->GetType(), aGroup->GetStoreName(),
+                                       groupAttributVal( aGroup )));
+    while ( elemIt->more() )
+      aMembership.Add( elemIt->next(), aSources.size() - 1 );
+  }
 
-    DriverMED_FamilyPtrList::iterator aFamsIter = aFamilies.begin();
-    while (aFamsIter != aFamilies.end())
-    {
-      DriverMED_FamilyPtr aFam1 = *aFamsIter;
-      DriverMED_FamilyPtrList::iterator aCurrIter = aFamsIter++;
-      if (aFam1->myType == aFam2->myType)
-      {
-        DriverMED_FamilyPtr aCommon (new DriverMED_Family);
-        aFam1->Split(aFam2, aCommon);
-        if (!aCommon->IsEmpty())
-        {
-          aCommon->SetGroupAttributVal(0);
-          aFamilies.push_back(aCommon);
-        }
-        if (aFam1->IsEmpty())
-        {
-          aFamilies.erase(aCurrIter);
-        }
-        if (aFam2->IsEmpty()) 
-          break;
-      }
-    }
-    // The rest elements of group
-    if (!aFam2->IsEmpty())
-    {
-      aFamilies.push_back(aFam2);
-    }
+  // Make a family of each set of sources including some elements
+
+  vector< int > aNbElemsInSet( aMembership.NbSets(), 0 );
+  for ( size_t i = 0; i < aMembership.myNodeSets.size(); ++i )
+    ++aNbElemsInSet[ aMembership.myNodeSets[ i ]];
+  for ( size_t i = 0; i < aMembership.myElemSets.size(); ++i )
+    ++aNbElemsInSet[ aMembership.myElemSets[ i ]];
+
+  vector< DriverMED_FamilyPtr > aFamilyOfSet( aMembership.NbSets() );
+  for ( size_t iSet = 1; iSet < aMembership.NbSets(); ++iSet )
+  {
+    if ( aNbElemsInSet[ iSet ] == 0 )
+      continue;
+    const vector< int >& aSetSources = aMembership.GetSources( iSet );
+
+    DriverMED_FamilyPtr aFam( new DriverMED_Family );
+    aFam->myType = aSources[ aSetSources[0] ].myType;
+    for ( size_t i = 0; i < aSetSources.size(); ++i )
+      aFam->myGroupNames.insert( aSources[ aSetSources[ i ]].myName );
+    if ( aSetSources.size() == 1 )
+      aFam->myGroupAttributVal = aSources[ aSetSources[0] ].myGroupAttributVal;
+
+    aFamilyOfSet[ iSet ] = aFam;
+    aFamilies.push_back( aFam );
   }
 
   DriverMED_FamilyPtrList::iterator aFamsIter = aFamilies.begin();
@@ -274,6 +397,30 @@ DriverMED_Family
     }
   }
 
+  // Store family IDs of nodes and elements or elements of families
+  if ( toFillIds )
+  {
+    vector< int >* setsAndIds[2][2] = {{ & aMembership.myNodeSets, theNodeFamilyIds },
+                                       { & aMembership.myElemSets, theElemFamilyIds }};
+    for ( auto & sets2ids : setsAndIds )
+    {
+      vector< int >& anIds = *sets2ids[0];
+      for ( size_t i = 0; i < anIds.size(); ++i )
+        if ( anIds[ i ] > 0 )
+          anIds[ i ] = aFamilyOfSet[ anIds[ i ]]->GetId();
+      sets2ids[1]->swap( anIds );
+    }
+  }
+  else
+  {
+    for ( size_t i = 0; i < aMembership.myNodeSets.size(); ++i )
+      if ( aMembership.myNodeSets[ i ] > 0 )
+        aFamilyOfSet[ aMembership.myNodeSets[ i ]]->AddElement( aMembership.myNodes[ i ]);
+    for ( size_t i = 0; i < aMembership.myElemSets.size(); ++i )
+      if ( aMembership.myElemSets[ i ] > 0 )
+        aFamilyOfSet[ aMembership.myElemSets[ i ]]->AddElement( aMembership.myElems[ i ]);
+  }
+
   // Create families for elements, not belonging to any group
   if (doGroupOfNodes)
   {
@@ -365,150 +512,6 @@ DriverMED_Family
   return aFamilies;
 }
 
-//=============================================================================
-/*!
- *  Initialize the tool by SMESHDS_GroupBase
- */
-//=============================================================================
-void DriverMED_Family::Init (SMESHDS_GroupBase* theGroup)
-{
-  // Elements
-  myElements.clear();
-  SMDS_ElemIteratorPtr elemIt = theGroup->GetElements();
-  while (elemIt->more())
-  {
-    myElements.insert( myElements.end(), elemIt->next() );
-  }
-
-  // Type
-  myType = theGroup->GetType();
-
-  // Groups list
-  myGroupNames.clear();
-  myGroupNames.insert(string(theGroup->GetStoreName()));
-
-  Quantity_Color aColor = theGroup->GetColor();
-  double aRed   = aColor.Red();
-  double aGreen = aColor.Green();
-  double aBlue  = aColor.Blue();
-  int aR = int( aRed*255   );
-  int aG = int( aGreen*255 );
-  int aB = int( aBlue*255  );
-//   cout << "aRed = " << aR << endl;
-//   cout << "aGreen = " << aG << endl;
-//   cout << "aBlue = " << aB << endl;
-  myGroupAttributVal = (int)(aR*1000000 + aG*1000 + aB);
-  //cout << "myGroupAttributVal = " << myGroupAttributVal << endl;
-}
-
-//=============================================================================
-/*!
- *  Split <theSubMesh> on some parts (families)
- *  on the basis of the elements type.
- */
-//=============================================================================
-DriverMED_FamilyPtrList 
-DriverMED_Family::SplitByType (SMESHDS_SubMesh* theSubMesh,
-                               const int        theId)
-{
-  DriverMED_FamilyPtrList aFamilies;
-  DriverMED_FamilyPtr aNodesFamily   (new DriverMED_Family);
-  DriverMED_FamilyPtr anEdgesFamily  (new DriverMED_Family);
-  DriverMED_FamilyPtr aFacesFamily   (new DriverMED_Family);
-  DriverMED_FamilyPtr aVolumesFamily (new DriverMED_Family);
-  // DriverMED_FamilyPtr a0DElemsFamily (new DriverMED_Family);
-  // DriverMED_FamilyPtr aBallsFamily   (new DriverMED_Family);
-
-  char submeshGrpName[ 30 ];
-  sprintf( submeshGrpName, "SubMesh %d", theId );
-
-  SMDS_NodeIteratorPtr aNodesIter = theSubMesh->GetNodes();
-  while (aNodesIter->more())
-  {
-    const SMDS_MeshNode* aNode = aNodesIter->next();
-    aNodesFamily->AddElement(aNode);
-  }
-
-  SMDS_ElemIteratorPtr anElemsIter = theSubMesh->GetElements();
-  while (anElemsIter->more())
-  {
-    const SMDS_MeshElement* anElem = anElemsIter->next();
-    switch (anElem->GetType())
-    {
-    case SMDSAbs_Edge:
-      anEdgesFamily->AddElement(anElem);
-      break;
-    case SMDSAbs_Face:
-      aFacesFamily->AddElement(anElem);
-      break;
-    case SMDSAbs_Volume:
-      aVolumesFamily->AddElement(anElem);
-      break;
-    default:
-      break;
-    }
-  }
-
-  if (!aNodesFamily->IsEmpty()) {
-    aNodesFamily->SetType(SMDSAbs_Node);
-    aNodesFamily->AddGroupName(submeshGrpName);
-    aFamilies.push_back(aNodesFamily);
-  }
-  if (!anEdgesFamily->IsEmpty()) {
-    anEdgesFamily->SetType(SMDSAbs_Edge);
-    anEdgesFamily->AddGroupName(submeshGrpName);
-    aFamilies.push_back(anEdgesFamily);
-  }
-  if (!aFacesFamily->IsEmpty()) {
-    aFacesFamily->SetType(SMDSAbs_Face);
-    aFacesFamily->AddGroupName(submeshGrpName);
-    aFamilies.push_back(aFacesFamily);
-  }
-  if (!aVolumesFamily->IsEmpty()) {
-    aVolumesFamily->SetType(SMDSAbs_Volume);
-    aVolumesFamily->AddGroupName(submeshGrpName);
-    aFamilies.push_back(aVolumesFamily);
-  }
-
-  return aFamilies;
-}
-
-//=============================================================================
-/*!
- *  Remove from <myElements> elements, common with <by>,
- *  Remove from <by> elements, common with <myElements>,
- *  Create family <common> from common elements, with combined groups list.
- */
-//=============================================================================
-void DriverMED_Family::Split (DriverMED_FamilyPtr by,
-                              DriverMED_FamilyPtr common)
-{
-  // Elements
-  ElementsSet::iterator anIter = by->myElements.begin(), elemInMe;
-  while ( anIter != by->myElements.end())
-  {
-    elemInMe = myElements.find(*anIter);
-    if (elemInMe != myElements.end())
-    {
-      common->myElements.insert(*anIter);
-      myElements.erase(elemInMe);
-      by->myElements.erase(anIter++);
-    }
-    else
-      anIter++;
-  }
-
-  if (!common->IsEmpty())
-  {
-    // Groups list
-    common->myGroupNames = myGroupNames;
-    common->myGroupNames.insert( by->myGroupNames.begin(), by->myGroupNames.end() );
-
-    // Type
-    common->myType = myType;
-  }
-}
-
 //================================================================================
 /*!
  * \brief Return a number of elements of a given type
@@ -40,6 +40,7 @@
 #include <boost/shared_ptr.hpp>
 #include <set>
 #include <limits>
+#include <vector>
 
 #define REST_NODES_FAMILY 1
 #define FIRST_NODE_FAMILY 2
@@ -77,6 +78,10 @@ class MESHDRIVERMED_EXPORT DriverMED_Family
     on some parts (families) on the basis of the elements membership in other groups
     from <theGroups> and other sub-meshes from <theSubMeshes>.
     Resulting families have no common elements.
+    If <theNodeFamilyIds> and <theElemFamilyIds> are given, they are filled with
+    family IDs of nodes and elements indexed by node and element IDs (zero for
+    an element not belonging to any family); the families are then returned
+    without elements.
   */
   static 
   DriverMED_FamilyPtrList
@@ -88,7 +93,9 @@ class MESHDRIVERMED_EXPORT DriverMED_Family
                 const bool doGroupOfVolumes,
                 const bool doGroupOf0DElems,
                 const bool doGroupOfBalls,
-                const bool doAllInGroups);
+                const bool doAllInGroups,
+                std::vector<int>* theNodeFamilyIds = 0,
+                std::vector<int>* theElemFamilyIds = 0);
 
   //! Create TFamilyInfo for this family
   template<class LowLevelWriter>
@@ -126,22 +133,6 @@ class MESHDRIVERMED_EXPORT DriverMED_Family
   size_t NbElements( SMDSAbs_ElementType ) const;
 
  private:
-  //! Initialize the tool by SMESHDS_GroupBase
-  void Init (SMESHDS_GroupBase* group);
-
-  //! Split <theSubMesh> on some parts (families) on the basis of the elements type.
-  static
-  DriverMED_FamilyPtrList SplitByType(SMESHDS_SubMesh* theSubMesh,
-                                      const int        theId);
-
-
-  /*! Remove from <Elements> elements, common with <by>,
-    Remove from <by> elements, common with <Elements>,
-    Create family <common> from common elements, with combined groups list.
-  */
-  void Split (DriverMED_FamilyPtr by,
-              DriverMED_FamilyPtr common);
-
   //! Check, if this family has empty list of elements
   bool IsEmpty () const;
 
@@ -26,6 +26,7 @@
 
 #include "DriverMED_R_SMESHDS_Mesh.h"
 
+#include "DriverMED.hxx"
 #include "DriverMED_Family.h"
 #include "SMESHDS_Group.hxx"
 #include "SMESHDS_Mesh.hxx"
@@ -49,6 +50,9 @@ using namespace std;
 
 typedef std::map<int, DriverMED_FamilyPtr> TID2FamilyMap;
 
+// number of nodes or elements created at once
+static const TInt theBatchSize = 100000;
+
 namespace DriverMED
 {
   bool buildMeshGrille(const MED::PWrapper&  theWrapper,
@@ -65,6 +69,16 @@ namespace DriverMED
   bool checkFamilyID(DriverMED_FamilyPtr & aFamily,
                      int                   anID,
                      const TID2FamilyMap&  myFamilies);
+  /*!
+   * \brief Read elements of given families and their nodes
+   * \param theNbSkipped - returns a number of polygons, polyhedra and balls not read
+   */
+  Driver_Mesh::Status readFamilies(const MED::PWrapper&  theWrapper,
+                                   const MED::PMeshInfo& theMeshInfo,
+                                   SMESHDS_Mesh*         theMesh,
+                                   const TID2FamilyMap&  theFamilies,
+                                   const std::set<TInt>& theFamIDs,
+                                   TInt&                 theNbSkipped);
 
 
   const SMDS_MeshNode* FindNode(const SMDS_Mesh* theMesh, TInt theId)
@@ -87,6 +101,18 @@ void DriverMED_R_SMESHDS_Mesh::SetMeshName(string theMeshName)
   myMeshName = theMeshName;
 }
 
+//================================================================================
+/*!
+ * \brief Sets names of groups to read. If not empty, Perform() reads only elements
+ *        of these groups and nodes they are built on
+ */
+//================================================================================
+
+void DriverMED_R_SMESHDS_Mesh::SetGroupsToRead(const std::set<std::string>& theGroupNames)
+{
+  myGroupsToRead = theGroupNames;
+}
+
 //================================================================================
 /*!
  * \brief Reads a med file
@@ -163,6 +189,32 @@ Driver_Mesh::Status DriverMED_R_SMESHDS_Mesh::Perform()
         continue;
       }
 
+      if ( !myGroupsToRead.empty() )
+      {
+        // Reading only elements of the given groups and their nodes
+        //-----------------------------------------------------------
+        set<TInt> aFamIDs;
+        TID2FamilyMap::iterator anID2Fam = myFamilies.begin();
+        for ( ; anID2Fam != myFamilies.end(); ++anID2Fam )
+        {
+          const MED::TStringSet& aGroupNames = anID2Fam->second->GetGroupNames();
+          MED::TStringSet::const_iterator aGrName = aGroupNames.begin();
+          for ( ; aGrName != aGroupNames.end(); ++aGrName )
+            if ( myGroupsToRead.count( *aGrName ))
+              aFamIDs.insert( anID2Fam->first );
+        }
+        TInt aNbSkipped = 0;
+        aResult = DriverMED::readFamilies( aMed, aMeshInfo, myMesh, myFamilies, aFamIDs, aNbSkipped );
+        if ( aNbSkipped > 0 )
+        {
+          Status aStatus = addMessage( SMESH_Comment( aNbSkipped ) <<
+                                       " polygons, polyhedra and balls of the groups are not read" );
+          if ( aResult < aStatus )
+            aResult = aStatus;
+        }
+        continue;
+      }
+
       // Reading MED nodes to the corresponding SMDS structure
       //------------------------------------------------------
       PNodeInfo aNodeInfo = aMed->GetPNodeInfo(aMeshInfo);
@@ -177,28 +229,40 @@ Driver_Mesh::Status DriverMED_R_SMESHDS_Mesh::Perform()
       TInt aNbElems = aNodeInfo->GetNbElem();
       MESSAGE("Perform - aNodeInfo->GetNbElem() = "<<aNbElems<<"; anIsNodeNum = "<<anIsNodeNum);
       DriverMED_FamilyPtr aFamily;
-      for ( TInt iElem = 0; iElem < aNbElems; iElem++ )
+      vector<double>               aCoords;
+      vector<smIdType>             aNodeIds;
+      vector<const SMDS_MeshNode*> aNewNodes;
+      for ( TInt iBatch = 0; iBatch < aNbElems; iBatch += theBatchSize )
       {
-        TCCoordSlice aCoordSlice = aNodeInfo->GetCoordSlice(iElem);
-        double aCoords[3] = {0.0, 0.0, 0.0};
-        for(TInt iDim = 0; iDim < 3; iDim++)
-          aCoords[iDim] = aCoordHelper->GetCoord(aCoordSlice,iDim);
-        const SMDS_MeshNode* aNode;
-        if ( anIsNodeNum ) {
-          aNode = myMesh->AddNodeWithID
-            (aCoords[0],aCoords[1],aCoords[2],aNodeInfo->GetElemNum(iElem));
-        }
-        else {
-          aNode = myMesh->AddNodeWithID
-            (aCoords[0],aCoords[1],aCoords[2], iElem+1);
+        // fill a batch of nodes
+        TInt aNbInBatch = std::min( theBatchSize, aNbElems - iBatch );
+        aCoords.assign( 3 * aNbInBatch, 0. );
+        aNodeIds.resize( aNbInBatch );
+        for ( TInt i = 0; i < aNbInBatch; i++ )
+        {
+          TInt iElem = iBatch + i;
+          TCCoordSlice aCoordSlice = aNodeInfo->GetCoordSlice(iElem);
+          for(TInt iDim = 0; iDim < 3; iDim++)
+            aCoords[ 3*i + iDim ] = aCoordHelper->GetCoord(aCoordSlice,iDim);
+          aNodeIds[i] = anIsNodeNum ? aNodeInfo->GetElemNum(iElem) : iElem+1;
         }
-
-        // Save reference to this node from its family
-        TInt aFamNum = aNodeInfo->GetFamNum(iElem);
-        if ( DriverMED::checkFamilyID ( aFamily, aFamNum, myFamilies ))
+        // create nodes skipping ones with already used IDs
+        for ( TInt i = 0; i < aNbInBatch; )
         {
-          aFamily->AddElement(aNode);
-          aFamily->SetType(SMDSAbs_Node);
+          smIdType aNbAdded = myMesh->AddNodesWithID( aNbInBatch - i, &aCoords[ 3*i ],
+                                                      &aNodeIds[ i ], &aNewNodes );
+
+          // Save reference to these nodes from their families
+          for ( smIdType iN = 0; iN < aNbAdded; iN++ )
+          {
+            TInt aFamNum = aNodeInfo->GetFamNum( iBatch + i + iN );
+            if ( DriverMED::checkFamilyID ( aFamily, aFamNum, myFamilies ))
+            {
+              aFamily->AddElement(aNewNodes[iN]);
+              aFamily->SetType(SMDSAbs_Node);
+            }
+          }
+          i += FromSmIdType<TInt>( aNbAdded ) + 1;
         }
       }
 
@@ -495,8 +559,74 @@ Driver_Mesh::Status DriverMED_R_SMESHDS_Mesh::Perform()
             case ePOINT1:  aNbNodes = 1;  break;
             default:;
             }
+            // Create elements by batches. Creation of a batch stops at an element
+            // which can't be created, e.g. because of an already used ID; this and
+            // following elements are created one by one below
+            TInt aNbAdded = 0;
+            SMDSAbs_EntityType anEntityType = DriverMED::GetSMDSType( aGeom );
+            if ( aNbNodes > 0 && anEntityType != SMDSEntity_Last )
+            {
+              vector<smIdType>                 aConn, anElemIds;
+              vector<const SMDS_MeshElement*>  aNewElems;
+
+              // Save reference to new elements from their families
+              auto addNewToFamilies = [&]()
+              {
+                for ( size_t i = 0; i < aNewElems.size(); i++ )
+                {
+                  TInt aFamNum = aCellInfo->GetFamNum( aNbAdded + TInt( i ));
+                  if ( DriverMED::checkFamilyID ( aFamily, aFamNum, myFamilies )) {
+                    aFamily->AddElement(aNewElems[i]);
+                    aFamily->SetType(aNewElems[i]->GetType());
+                  }
+                }
+                aNbAdded += TInt( aNewElems.size() );
+                aNewElems.clear();
+              };
+#ifndef _DEXCEPT_
+              try{
+#endif
+                for ( TInt iBatch = 0; iBatch < aNbElems; iBatch += theBatchSize )
+                {
+                  TInt aNbInBatch = std::min( theBatchSize, aNbElems - iBatch );
+                  aConn.resize( aNbInBatch * aNbNodes );
+                  for ( TInt i = 0; i < aNbInBatch; i++ )
+                  {
+                    TCConnSlice aConnSlice = aCellInfo->GetConnSlice( iBatch + i );
+                    smIdType*   aNodeIds   = & aConn[ i * aNbNodes ];
+#ifdef _EDF_NODE_IDS_
+                    if(anIsNodeNum)
+                      for(int iNode = 0; iNode < aNbNodes; iNode++)
+                        aNodeIds[iNode] = aNodeInfo->GetElemNum(aConnSlice[iNode] - 1);
+                    else
+#endif
+                      for(int iNode = 0; iNode < aNbNodes; iNode++)
+                        aNodeIds[iNode] = aConnSlice[iNode];
+                  }
+                  if ( anIsElemNum )
+                  {
+                    anElemIds.resize( aNbInBatch );
+                    for ( TInt i = 0; i < aNbInBatch; i++ )
+                      anElemIds[i] = aCellInfo->GetElemNum( iBatch + i );
+                  }
+                  smIdType aNbInBatchAdded =
+                    myMesh->AddElementsWithID( anEntityType, aNbInBatch, &aConn[0],
+                                               anIsElemNum ? &anElemIds[0] : 0, &aNewElems );
+                  addNewToFamilies();
+                  if ( aNbInBatchAdded < aNbInBatch )
+                    break;
+                }
+#ifndef _DEXCEPT_
+              }catch(...){
+                // aNewElems keeps elements created before the exception;
+                // elements not created yet are processed one by one below
+                addNewToFamilies();
+              }
+#endif
+            }
+
             vector<TInt> aNodeIds(aNbNodes);
-            for ( TInt iElem = 0; iElem < aNbElems; iElem++ )
+            for ( TInt iElem = aNbAdded; iElem < aNbElems; iElem++ )
             {
               bool anIsValidConnect = false;
               TCConnSlice aConnSlice = aCellInfo->GetConnSlice(iElem);
@@ -1357,3 +1487,232 @@ bool DriverMED::buildMeshGrille(const MED::PWrapper&  theWrapper,
 
   return res;
 }
+
+/*!
+ * \brief Read elements of given families and nodes they are built on
+ *
+ * Numbers and families of all nodes and cells are read in order to select the
+ * entities to read. Coordinates and connectivity are read by batches of the
+ * selected entities using MED filters, so that the memory used to read does not
+ * depend on the size of the whole mesh in the file. File indices of nodes are
+ * converted to node IDs by a vector.
+ * \param theWrapper   - PWrapper const pointer
+ * \param theMeshInfo  - PMeshInfo const pointer
+ * \param theMesh      - the mesh to fill
+ * \param theFamilies  - a map of the family ID to the Family
+ * \param theFamIDs    - IDs of families to read
+ * \param theNbSkipped - returns a number of polygons, polyhedra and balls not read
+ * \return Driver_Mesh::Status - DRS_OK or a warning
+ */
+Driver_Mesh::Status DriverMED::readFamilies(const MED::PWrapper&  theWrapper,
+                                            const MED::PMeshInfo& theMeshInfo,
+                                            SMESHDS_Mesh*         theMesh,
+                                            const TID2FamilyMap&  theFamilies,
+                                            const std::set<TInt>& theFamIDs,
+                                            TInt&                 theNbSkipped)
+{
+  Driver_Mesh::Status aResult = Driver_Mesh::DRS_OK;
+  theNbSkipped = 0;
+
+  TInt aNbNodes = theWrapper->GetNbNodes(*theMeshInfo);
+  if ( aNbNodes < 1 )
+    return Driver_Mesh::DRS_OK;
+  theMeshInfo->myDim = theMeshInfo->mySpaceDim; // ignore meshdim in MEDFile because it can be false
+
+  // IDs of nodes by their indices in the file
+  PElemInfo aNodeElemInfo = theWrapper->CrElemInfo(theMeshInfo, aNbNodes, eVRAI, eFAUX);
+  theWrapper->GetNumeration(*aNodeElemInfo, aNbNodes, eNOEUD, eNONE);
+  theWrapper->GetFamilies  (*aNodeElemInfo, aNbNodes, eNOEUD, eNONE);
+
+  vector<smIdType> aNodeIds( aNbNodes );
+  vector<bool>     isNodeToRead( aNbNodes );
+  for ( TInt iNode = 0; iNode < aNbNodes; iNode++ )
+  {
+#ifdef _EDF_NODE_IDS_
+    aNodeIds[iNode] = aNodeElemInfo->IsElemNum() ? aNodeElemInfo->GetElemNum(iNode) : iNode+1;
+#else
+    aNodeIds[iNode] = iNode+1;
+#endif
+    isNodeToRead[iNode] = theFamIDs.count( aNodeElemInfo->GetFamNum(iNode) );
+  }
+  aNodeElemInfo.reset();
+
+  // Reading connectivity of the cells of the families
+  //--------------------------------------------------
+  struct TCells
+  {
+    SMDSAbs_EntityType myType;
+    TInt               myNbNodes;
+    vector<smIdType>   myNodeIds, myElemIds;
+    vector<TInt>       myFamNums;
+  };
+  list<TCells> aCellsList;
+  TIntVector   anIndices, aBatch;
+
+  MED::TEntityInfo aEntityInfo = theWrapper->GetEntityInfo(theMeshInfo, eNOD);
+  MED::TEntityInfo::iterator anEntityIter = aEntityInfo.begin();
+  for ( ; anEntityIter != aEntityInfo.end(); anEntityIter++ )
+  {
+    const EEntiteMaillage& anEntity = anEntityIter->first;
+    if ( anEntity == eNOEUD ) continue;
+
+    const MED::TGeom2Size& aGeom2Size = anEntityIter->second;
+    MED::TGeom2Size::const_iterator aGeom2SizeIter = aGeom2Size.begin();
+    for ( ; aGeom2SizeIter != aGeom2Size.end(); aGeom2SizeIter++ )
+    {
+      const EGeometrieElement& aGeom = aGeom2SizeIter->first;
+      const TInt            aNbCells = aGeom2SizeIter->second;
+
+      PElemInfo aCellElemInfo = theWrapper->CrElemInfo(theMeshInfo, aNbCells, eFAUX, eFAUX);
+      theWrapper->GetFamilies(*aCellElemInfo, aNbCells, anEntity, aGeom);
+      anIndices.clear();
+      for ( TInt iCell = 0; iCell < aNbCells; iCell++ )
+        if ( theFamIDs.count( aCellElemInfo->GetFamNum(iCell) ))
+          anIndices.push_back( iCell+1 );
+      aCellElemInfo.reset();
+      if ( anIndices.empty() )
+        continue;
+
+      SMDSAbs_EntityType anEntityType = DriverMED::GetSMDSType( aGeom );
+      if ( anEntity == eSTRUCT_ELEMENT ||
+           aGeom == ePOLYGONE || aGeom == ePOLYGON2 || aGeom == ePOLYEDRE ||
+           anEntityType == SMDSEntity_Last )
+      {
+        theNbSkipped += (TInt) anIndices.size();
+        continue;
+      }
+
+      aCellsList.push_back( TCells() );
+      TCells& aCells   = aCellsList.back();
+      aCells.myType    = anEntityType;
+      aCells.myNbNodes = MED::GetNbNodes( aGeom );
+      aCells.myNodeIds.reserve( anIndices.size() * aCells.myNbNodes );
+      aCells.myFamNums.reserve( anIndices.size() );
+
+      TInt aNbSelected = (TInt) anIndices.size();
+      bool anIsElemNum = true;
+      for ( TInt iBatch = 0; iBatch < aNbSelected; iBatch += theBatchSize )
+      {
+        TInt aNbInBatch = std::min( theBatchSize, aNbSelected - iBatch );
+        aBatch.assign( anIndices.begin() + iBatch, anIndices.begin() + iBatch + aNbInBatch );
+
+        PCellInfo aCellInfo = theWrapper->CrCellInfo(theMeshInfo, anEntity, aGeom, aNbInBatch);
+        theWrapper->GetCellInfo(*aCellInfo, aBatch);
+        anIsElemNum = anIsElemNum && aCellInfo->IsElemNum();
+
+        for ( TInt iCell = 0; iCell < aNbInBatch; iCell++ )
+        {
+          TCConnSlice aConnSlice = aCellInfo->GetConnSlice(iCell);
+          for ( TInt iNode = 0; iNode < aCells.myNbNodes; iNode++ )
+          {
+            TInt anIndex = aConnSlice[iNode] - 1;
+            if ( anIndex < 0 || anIndex >= aNbNodes )
+              EXCEPTION(runtime_error,"readFamilies - invalid node index "<<anIndex+1<<" in cell "<<aBatch[iCell]);
+            isNodeToRead[anIndex] = true;
+            aCells.myNodeIds.push_back( aNodeIds[anIndex] );
+          }
+          aCells.myFamNums.push_back( aCellInfo->GetFamNum(iCell) );
+          if ( anIsElemNum )
+            aCells.myElemIds.push_back( aCellInfo->GetElemNum(iCell) );
+        }
+      }
+      if ( !anIsElemNum )
+        aCells.myElemIds.clear();
+    }
+  }
+
+  // Reading the nodes to read by batches
+  //-------------------------------------
+  anIndices.clear();
+  for ( TInt iNode = 0; iNode < aNbNodes; iNode++ )
+    if ( isNodeToRead[iNode] )
+      anIndices.push_back( iNode+1 );
+
+  DriverMED_FamilyPtr          aFamily;
+  vector<double>               aCoords;
+  vector<smIdType>             aBatchIds;
+  vector<const SMDS_MeshNode*> aNewNodes;
+  TInt aNbSelected = (TInt) anIndices.size();
+  for ( TInt iBatch = 0; iBatch < aNbSelected; iBatch += theBatchSize )
+  {
+    TInt aNbInBatch = std::min( theBatchSize, aNbSelected - iBatch );
+    aBatch.assign( anIndices.begin() + iBatch, anIndices.begin() + iBatch + aNbInBatch );
+
+    PNodeInfo aNodeInfo = theWrapper->CrNodeInfo(theMeshInfo, aNbInBatch, eFULL_INTERLACE, eCART, eFAUX);
+    theWrapper->GetNodeInfo(*aNodeInfo, aBatch);
+    PCoordHelper aCoordHelper = GetCoordHelper(aNodeInfo);
+
+    aCoords.assign( 3 * aNbInBatch, 0. );
+    aBatchIds.resize( aNbInBatch );
+    for ( TInt i = 0; i < aNbInBatch; i++ )
+    {
+      TCCoordSlice aCoordSlice = aNodeInfo->GetCoordSlice(i);
+      for ( TInt iDim = 0; iDim < 3; iDim++ )
+        aCoords[ 3*i + iDim ] = aCoordHelper->GetCoord(aCoordSlice,iDim);
+      aBatchIds[i] = aNodeIds[ aBatch[i]-1 ];
+    }
+    // create nodes skipping ones with already used IDs
+    for ( TInt i = 0; i < aNbInBatch; )
+    {
+      smIdType aNbAdded = theMesh->AddNodesWithID( aNbInBatch - i, &aCoords[ 3*i ],
+                                                   &aBatchIds[ i ], &aNewNodes );
+      for ( smIdType iN = 0; iN < aNbAdded; iN++ )
+      {
+        TInt aFamNum = aNodeInfo->GetFamNum( i + FromSmIdType<TInt>( iN ));
+        if ( theFamIDs.count( aFamNum ) &&
+             DriverMED::checkFamilyID( aFamily, aFamNum, theFamilies ))
+        {
+          aFamily->AddElement(aNewNodes[iN]);
+          aFamily->SetType(SMDSAbs_Node);
+        }
+      }
+      i += FromSmIdType<TInt>( aNbAdded ) + 1;
+    }
+  }
+
+  // Creating the cells by batches
+  //------------------------------
+  vector<const SMDS_MeshElement*> aNewElems;
+  list<TCells>::iterator aCells = aCellsList.begin();
+  for ( ; aCells != aCellsList.end(); ++aCells )
+  {
+    TInt aNbCells    = (TInt) aCells->myFamNums.size();
+    bool anIsElemNum = !aCells->myElemIds.empty();
+    for ( TInt iCell = 0; iCell < aNbCells; )
+    {
+      TInt aNbInBatch = std::min( theBatchSize, aNbCells - iCell );
+      smIdType aNbAdded =
+        theMesh->AddElementsWithID( aCells->myType, aNbInBatch,
+                                    &aCells->myNodeIds[ iCell * aCells->myNbNodes ],
+                                    anIsElemNum ? &aCells->myElemIds[ iCell ] : 0, &aNewElems );
+
+      // Save reference to these elements from their families
+      for ( size_t i = 0; i < aNewElems.size(); i++ )
+      {
+        TInt aFamNum = aCells->myFamNums[ iCell + TInt( i )];
+        if ( DriverMED::checkFamilyID( aFamily, aFamNum, theFamilies ))
+        {
+          aFamily->AddElement(aNewElems[i]);
+          aFamily->SetType(aNewElems[i]->GetType());
+        }
+      }
+      iCell += FromSmIdType<TInt>( aNbAdded );
+      if ( aNbAdded < aNbInBatch )
+      {
+        if ( anIsElemNum ) // an ID is already used, create the rest with new IDs
+        {
+          anIsElemNum = false;
+          if ( aResult < Driver_Mesh::DRS_WARN_RENUMBER )
+            aResult = Driver_Mesh::DRS_WARN_RENUMBER;
+        }
+        else // an invalid element, skip it
+        {
+          ++iCell;
+          aResult = Driver_Mesh::DRS_WARN_SKIP_ELEM;
+        }
+      }
+    }
+  }
+
+  return aResult;
+}
@@ -35,6 +35,8 @@
 
 #include <list>
 #include <map>
+#include <set>
+#include <string>
 
 #include <NCollection_DataMap.hxx>
 #include <TCollection_AsciiString.hxx>
@@ -59,11 +61,13 @@ class MESHDRIVERMED_EXPORT DriverMED_R_SMESHDS_Mesh: public Driver_SMESHDS_Mesh
 
   std::list<std::string> GetMeshNames(Status& theStatus);
   void SetMeshName(std::string theMeshName);
+  void SetGroupsToRead(const std::set<std::string>& theGroupNames);
 
  private:
   std::string                        myMeshName;
   std::map<int, DriverMED_FamilyPtr> myFamilies;
   TName2Falilies                     myGroups2FamiliesMap;
+  std::set<std::string>              myGroupsToRead;
 };
 
 #endif
@@ -288,52 +288,19 @@ namespace
   };
 
 
-  typedef NCollection_DataMap< Standard_Address, int > TElemFamilyMap;
-
-  //================================================================================
-  /*!
-   * \brief Fills element to famaly ID map for element type.
-   * Removes all families of anElemType
-   */
-  //================================================================================
-
-  void fillElemFamilyMap( TElemFamilyMap &            anElemFamMap,
-                          list<DriverMED_FamilyPtr> & aFamilies,
-                          const SMDSAbs_ElementType   anElemType)
-  {
-    anElemFamMap.Clear();
-    list<DriverMED_FamilyPtr>::iterator aFamsIter = aFamilies.begin();
-    while ( aFamsIter != aFamilies.end() )
-    {
-      if ((*aFamsIter)->GetType() != anElemType) {
-        aFamsIter++;
-      }
-      else {
-        int aFamId = (*aFamsIter)->GetId();
-        const ElementsSet&              anElems = (*aFamsIter)->GetElements();
-        ElementsSet::const_iterator anElemsIter = anElems.begin();
-        for (; anElemsIter != anElems.end(); anElemsIter++)
-        {
-          anElemFamMap.Bind( (Standard_Address)*anElemsIter, aFamId );
-        }
-        // remove a family from the list
-        aFamilies.erase( aFamsIter++ );
-      }
-    }
-  }
-
   //================================================================================
   /*!
-   * \brief For an element, return family ID found in the map or a default one
+   * \brief For an element, return family ID found in the array or a default one
    */
   //================================================================================
 
-  int getFamilyId( const TElemFamilyMap &  anElemFamMap,
-                   const SMDS_MeshElement* anElement,
-                   const int               aDefaultFamilyId)
+  int getFamilyId( const std::vector<int> & aFamilyIds,
+                   const SMDS_MeshElement*  anElement,
+                   const int                aDefaultFamilyId)
   {
-    if ( anElemFamMap.IsBound( (Standard_Address) anElement ))
-      return anElemFamMap( (Standard_Address) anElement );
+    size_t id = anElement->GetID();
+    if ( id < aFamilyIds.size() && aFamilyIds[ id ] != 0 )
+      return aFamilyIds[ id ];
 
     return aDefaultFamilyId;
   }
@@ -554,6 +521,8 @@ Driver_Mesh::Status DriverMED_W_SMESHDS_Mesh::PerformInternal(LowLevelWriter myM
     }
 
     //MESSAGE("Perform - aFamilyInfo");
+    // family IDs of nodes and elements indexed by their IDs
+    vector< int > aNodeFamilyIds, anElemFamilyIds;
     list<DriverMED_FamilyPtr> aFamilies;
     if (myAllSubMeshes) {
       aFamilies = DriverMED_Family::MakeFamilies
@@ -564,7 +533,8 @@ Driver_Mesh::Status DriverMED_W_SMESHDS_Mesh::PerformInternal(LowLevelWriter myM
          myDoGroupOfVolumes && nbVolumes,
          myDoGroupOf0DElems && nb0DElements,
          myDoGroupOfBalls   && nbBalls,
-         myDoAllInGroups);
+         myDoAllInGroups,
+         &aNodeFamilyIds, &anElemFamilyIds);
     }
     else {
       aFamilies = DriverMED_Family::MakeFamilies
@@ -575,7 +545,8 @@ Driver_Mesh::Status DriverMED_W_SMESHDS_Mesh::PerformInternal(LowLevelWriter myM
          myDoGroupOfVolumes && nbVolumes,
          myDoGroupOf0DElems && nb0DElements,
          myDoGroupOfBalls   && nbBalls,
-         myDoAllInGroups);
+         myDoAllInGroups,
+         &aNodeFamilyIds, &anElemFamilyIds);
     }
     list<DriverMED_FamilyPtr>::iterator aFamsIter;
     for (aFamsIter = aFamilies.begin(); aFamsIter != aFamilies.end(); aFamsIter++)
@@ -600,10 +571,6 @@ Driver_Mesh::Status DriverMED_W_SMESHDS_Mesh::PerformInternal(LowLevelWriter myM
     PNodeInfo aNodeInfo = myMed->CrNodeInfo(aMeshInfo, aNbNodes,
                                             theMode, theSystem, theIsElemNum, theIsElemNames);
 
-    // find family numbers for nodes
-    TElemFamilyMap anElemFamMap;
-    fillElemFamilyMap( anElemFamMap, aFamilies, SMDSAbs_Node );
-
     for (TInt iNode = 0; aCoordHelperPtr->Next(); iNode++)
     {
       // coordinates
@@ -623,10 +590,10 @@ Driver_Mesh::Status DriverMED_W_SMESHDS_Mesh::PerformInternal(LowLevelWriter myM
 #endif
       // family number
       const SMDS_MeshNode* aNode = aCoordHelperPtr->GetNode();
-      int famNum = getFamilyId( anElemFamMap, aNode, myNodesDefaultFamilyId );
+      int famNum = getFamilyId( aNodeFamilyIds, aNode, myNodesDefaultFamilyId );
       aNodeInfo->SetFamNum( iNode, famNum );
     }
-    anElemFamMap.Clear();
+    vector< int >().swap( aNodeFamilyIds );
 
     // coordinate names and units
     for (TInt iCoord = 0; iCoord < aSpaceDimension; iCoord++) {
@@ -804,8 +771,6 @@ Driver_Mesh::Status DriverMED_W_SMESHDS_Mesh::PerformInternal(LowLevelWriter myM
                                                SMDSAbs_Volume));
     }
 
-    vector< bool > isElemFamMapBuilt( SMDSAbs_NbElementTypes, false );
-
     // loop on all geom types of elements
 
     list< TElemTypeData >::iterator aElemTypeData = aTElemTypeDatas.begin();
@@ -825,13 +790,6 @@ Driver_Mesh::Status DriverMED_W_SMESHDS_Mesh::PerformInternal(LowLevelWriter myM
         continue;
       }
 
-      // build map of family numbers for this type
-      if ( !isElemFamMapBuilt[ aElemTypeData->_smdsType ])
-      {
-        fillElemFamilyMap( anElemFamMap, aFamilies, aElemTypeData->_smdsType );
-        isElemFamMapBuilt[ aElemTypeData->_smdsType ] = true;
-      }
-
       // iterator on elements of a current type
       SMDS_ElemIteratorPtr elemIterator;
       TInt iElem = 0;
@@ -888,7 +846,7 @@ Driver_Mesh::Status DriverMED_W_SMESHDS_Mesh::PerformInternal(LowLevelWriter myM
             aPolygoneInfo->SetElemNum( iElem, FromSmIdType<TInt>(anElem->GetID()) );
 
             // family number
-            int famNum = getFamilyId( anElemFamMap, anElem, defaultFamilyId );
+            int famNum = getFamilyId( anElemFamilyIds, anElem, defaultFamilyId );
             aPolygoneInfo->SetFamNum( iElem, famNum );
 
             if ( ++iElem == aPolygoneInfo->GetNbElem() )
@@ -963,7 +921,7 @@ Driver_Mesh::Status DriverMED_W_SMESHDS_Mesh::PerformInternal(LowLevelWriter myM
             aPolyhInfo->SetElemNum( iElem, FromSmIdType<TInt>(anElem->GetID()) );
 
             // family number
-            int famNum = getFamilyId( anElemFamMap, anElem, defaultFamilyId );
+            int famNum = getFamilyId( anElemFamilyIds, anElem, defaultFamilyId );
             aPolyhInfo->SetFamNum( iElem, famNum );
 
             if ( ++iElem == aPolyhInfo->GetNbElem() )
@@ -999,7 +957,7 @@ Driver_Mesh::Status DriverMED_W_SMESHDS_Mesh::PerformInternal(LowLevelWriter myM
             static_cast<const SMDS_BallElement*>( anElem )->GetDiameter();
 
           // family number
-          int famNum = getFamilyId( anElemFamMap, anElem, defaultFamilyId );
+          int famNum = getFamilyId( anElemFamilyIds, anElem, defaultFamilyId );
           aBallInfo->SetFamNum( iElem, famNum );
           ++iElem;
         }
@@ -1046,7 +1004,7 @@ Driver_Mesh::Status DriverMED_W_SMESHDS_Mesh::PerformInternal(LowLevelWriter myM
           aCellInfo->SetElemNum( iElem, FromSmIdType<TInt>(anElem->GetID()) );
 
           // family number
-          int famNum = getFamilyId( anElemFamMap, anElem, defaultFamilyId );
+          int famNum = getFamilyId( anElemFamilyIds, anElem, defaultFamilyId );
           aCellInfo->SetFamNum( iElem, famNum );
 
           if ( ++iElem == aCellInfo->GetNbElem() )
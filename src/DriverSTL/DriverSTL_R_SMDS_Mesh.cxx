@@ -23,10 +23,7 @@
 #include "DriverSTL_R_SMDS_Mesh.h"
 
 #include <Basics_Utils.hxx>
-#include <Basics_OCCTVersion.hxx>
 
-#include <gp_Pnt.hxx>
-#include <NCollection_DataMap.hxx>
 #include <Standard_NoMoreObject.hxx>
 
 #include "SMDS_Mesh.hxx"
@@ -34,57 +31,103 @@
 #include "SMDS_MeshNode.hxx"
 #include "SMESH_File.hxx"
 
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
 namespace
 {
-  struct Hasher
+  //================================================================================
+  /*!
+   * \brief Check if a text starts with a lower-case key word, ignoring case
+   */
+  //================================================================================
+
+  bool isKeyWord( const char* text, const char* keyWord )
+  {
+    for ( ; *keyWord; ++text, ++keyWord )
+      if ( tolower( *text ) != *keyWord )
+        return false;
+    return true;
+  }
+
+  //=======================================================================
+  /*!
+   * \brief Point read from a file. Coordinates are stored in float as STL does
+   */
+  //=======================================================================
+
+  struct TPnt
+  {
+    float myXYZ[3];
+
+    bool operator==( const TPnt& other ) const
+    {
+      return memcmp( myXYZ, other.myXYZ, sizeof( myXYZ )) == 0;
+    }
+  };
+
+  struct TPntHasher
   {
-    //=======================================================================
-    //function : HashCode
-    //purpose  :
-    //=======================================================================
-#if OCC_VERSION_LARGE < 0x07080000
-    inline static Standard_Integer HashCode
-    (const gp_Pnt& point,  Standard_Integer Upper)
-#else
-    size_t operator()(const gp_Pnt& point) const
-#endif
+    size_t operator()( const TPnt& point ) const
     {
-      union
-      {
-        Standard_Real    R[3];
-        Standard_Integer I[6];
-      } U;
-
-      point.Coord( U.R[0], U.R[1], U.R[2] );
-
-#if OCC_VERSION_LARGE < 0x07080000
-      return ::HashCode(U.I[0]/23+U.I[1]/19+U.I[2]/17+U.I[3]/13+U.I[4]/11+U.I[5]/7,Upper);
-#else
-      return static_cast<size_t>(U.I[0]/23+U.I[1]/19+U.I[2]/17+U.I[3]/13+U.I[4]/11+U.I[5]/7);
-#endif
+      uint32_t i[3];
+      memcpy( i, point.myXYZ, sizeof( i ));
+      return ( size_t( i[0] ) * 73856093 ) ^ ( size_t( i[1] ) * 19349663 ) ^ ( size_t( i[2] ) * 83492791 );
     }
-    //=======================================================================
-    //function : IsEqual
-    //purpose  :
-    //=======================================================================
-#if OCC_VERSION_LARGE < 0x07080000
-    inline static Standard_Boolean IsEqual
-    (const gp_Pnt& point1, const gp_Pnt& point2)
-#else
-    bool operator()(const gp_Pnt& point1, const gp_Pnt& point2) const
-#endif
+  };
+
+  //=======================================================================
+  /*!
+   * \brief Unique points and triangles read from a file. Nodes and faces
+   *        are created at once when all the file is read
+   */
+  //=======================================================================
+
+  struct TSTLData
+  {
+    std::unordered_map< TPnt, smIdType, TPntHasher > myPntIndex; // index of a unique point
+    std::vector< double >                            myCoords;   // coordinates of unique points
+    std::vector< smIdType >                          myTriaPnts; // point indices of triangles
+
+    TSTLData( smIdType nbTria )
+    {
+      myPntIndex.reserve( nbTria / 2 + 3 ); // a closed surface has twice less nodes than triangles
+      myCoords.reserve( 3 * ( nbTria / 2 + 3 ));
+      myTriaPnts.reserve( 3 * nbTria );
+    }
+
+    void addPoint( const TPnt& point )
+    {
+      auto it2isNew = myPntIndex.insert( std::make_pair( point, smIdType( myPntIndex.size() )));
+      if ( it2isNew.second )
+        myCoords.insert( myCoords.end(), point.myXYZ, point.myXYZ + 3 );
+      myTriaPnts.push_back( it2isNew.first->second );
+    }
+
+    bool addToMesh( SMDS_Mesh* mesh, bool createFaces )
     {
-      static Standard_Real tab1[3], tab2[3];
-      point1.Coord(tab1[0],tab1[1],tab1[2]);
-      point2.Coord(tab2[0],tab2[1],tab2[2]);
-      return (memcmp(tab1,tab2,sizeof(tab1)) == 0);
+      myPntIndex.clear();
+
+      std::vector< const SMDS_MeshNode* > nodes;
+      smIdType nbNodes = myCoords.size() / 3;
+      if ( mesh->AddNodesWithID( nbNodes, myCoords.data(), 0, &nodes ) < nbNodes )
+        return false;
+      if ( !createFaces )
+        return true;
+
+      smIdType nbTria = myTriaPnts.size() / 3;
+      for ( smIdType& iPnt : myTriaPnts )
+        iPnt = nodes[ iPnt ]->GetID();
+      return ( mesh->AddElementsWithID( SMDSEntity_Triangle, nbTria, myTriaPnts.data() ) == nbTria );
     }
   };
-  typedef NCollection_DataMap<gp_Pnt,SMDS_MeshNode*,Hasher> TDataMapOfPntNodePtr;
 
   const int HEADER_SIZE           = 84; // 80 chars + int
   const int SIZEOF_STL_FACET      = 50;
-  const int ASCII_LINES_PER_FACET = 7;
+  const int ASCII_FACET_SIZE      = 250; // approximate size of a facet in ascii mode
   const int SIZE_OF_FLOAT         = 4;
   // const int STL_MIN_FILE_SIZE     = 284;
 }
@@ -151,7 +194,11 @@ Driver_Mesh::Status DriverSTL_R_SMDS_Mesh::Perform()
   }
 
   if ( myIsAscii )
+  {
     aResult = readAscii( file );
+    if ( aResult == DRS_EMPTY )
+      aResult = addMessage( "No facets found in the ASCII STL file", /*isFatal=*/false );
+  }
   else
     aResult = readBinary( file );
 
@@ -181,43 +228,14 @@ static Standard_Real readFloat(SMESH_File& theFile)
   return u.f;
 }
 
-static SMDS_MeshNode* addNode(const gp_Pnt& P,
-                              TDataMapOfPntNodePtr& uniqnodes,
-                              SMDS_Mesh* theMesh)
-{
-  SMDS_MeshNode* node = 0;
-  if ( uniqnodes.IsBound(P) ) {
-    node = uniqnodes.Find(P);
-  } else {
-    node = theMesh->AddNode(P.X(), P.Y(), P.Z() );
-    uniqnodes.Bind(P,node);
-  }
-  
-  return node;
-}                                
-
-static SMDS_MeshNode* readNode(FILE* file,
-                               TDataMapOfPntNodePtr& uniqnodes,
-                               SMDS_Mesh* theMesh)
-{
-  Standard_ShortReal coord[3];
-  // reading vertex
-  fscanf(file,"%*s %f %f %f\n",&coord[0],&coord[1],&coord[2]);
-
-  gp_Pnt P(coord[0],coord[1],coord[2]);
-  return addNode( P, uniqnodes, theMesh );
-}
-
-static SMDS_MeshNode* readNode(SMESH_File& theFile,
-                               TDataMapOfPntNodePtr& uniqnodes,
-                               SMDS_Mesh* theMesh)
+static void readNode(SMESH_File& theFile, TSTLData& theData)
 {
-  gp_Pnt coord;
-  coord.SetX( readFloat(theFile));
-  coord.SetY( readFloat(theFile));
-  coord.SetZ( readFloat(theFile));
+  TPnt coord;
+  coord.myXYZ[0] = (float) readFloat(theFile);
+  coord.myXYZ[1] = (float) readFloat(theFile);
+  coord.myXYZ[2] = (float) readFloat(theFile);
 
-  return addNode( coord, uniqnodes, theMesh );
+  theData.addPoint( coord );
 }
 
 //=======================================================================
@@ -230,7 +248,7 @@ Driver_Mesh::Status DriverSTL_R_SMDS_Mesh::readAscii(SMESH_File& theFile) const
   Status aResult = DRS_OK;
 
   // get a solid name
-  if ( strncmp( "solid ", theFile, strlen("solid ")) == 0 ) // not empty
+  if ( theFile.size() > (long) strlen("solid ") && isKeyWord( theFile, "solid " )) // not empty
   {
     const char * header = theFile;
     std::string& name = const_cast<std::string&>( myName );
@@ -246,61 +264,45 @@ Driver_Mesh::Status DriverSTL_R_SMDS_Mesh::readAscii(SMESH_File& theFile) const
     name.resize( n );
   }
 
-  // get the file size
-  long filesize = theFile.size();
-  theFile.close();
-
-  // Open the file
-#if defined(WIN32) && defined(UNICODE)
-  std::wstring aFile = Kernel_Utils::utf8_decode_s(myFile);
-  FILE* file = _wfopen( aFile.c_str(), L"r");
-#else
-  FILE* file = fopen(myFile.c_str(), "r");  
-#endif  
-
-  // count the number of lines
-  Standard_Integer nbLines = 0;
-  for (long ipos = 0; ipos < filesize; ++ipos)
-  {
-    if (getc(file) == '\n')
-      nbLines++;
-  }
-
-  // go back to the beginning of the file
-  rewind(file);
-
-  Standard_Integer nbTri = (nbLines / ASCII_LINES_PER_FACET);
+  TSTLData data( theFile.size() / ASCII_FACET_SIZE );
 
-  TDataMapOfPntNodePtr uniqnodes;
   // skip header
-  while (getc(file) != '\n');
-
-  // main reading
-  for (Standard_Integer iTri = 0; iTri < nbTri; ++iTri)
+  theFile.getLine();
+
+  // main reading: each three vertices make a triangle, other keywords are skipped
+  const long            keyWordLen = strlen("vertex");
+  const char*           end = theFile.end();
+  const char*           pos = theFile;
+  std::vector< double > coords( 3 );
+  TPnt                  point;
+  while ( end - pos > keyWordLen )
   {
-    // skipping the facet normal
-    Standard_ShortReal normal[3];
-    fscanf(file,"%*s %*s %f %f %f\n",&normal[0],&normal[1],&normal[2]);
-
-    // skip the keywords "outer loop"
-    fscanf(file,"%*s %*s");
-
-    // reading nodes
-    SMDS_MeshNode* node1 = readNode( file, uniqnodes, myMesh );
-    SMDS_MeshNode* node2 = readNode( file, uniqnodes, myMesh );
-    SMDS_MeshNode* node3 = readNode( file, uniqnodes, myMesh );
+    // key words are case insensitive
+    if (( *pos != 'v' && *pos != 'V' ) ||
+        !isKeyWord( pos, "vertex" ) ||
+        !isspace( pos[ keyWordLen ]))
+    {
+      ++pos;
+      continue;
+    }
+    theFile.setPos( pos + keyWordLen );
+    if ( !theFile.getDoubles( coords ))
+      break;
+    point.myXYZ[0] = (float) coords[0];
+    point.myXYZ[1] = (float) coords[1];
+    point.myXYZ[2] = (float) coords[2];
+    data.addPoint( point );
 
-    if (myIsCreateFaces)
-      myMesh->AddFace(node1,node2,node3);
+    pos = theFile;
+  }
+  data.myTriaPnts.resize( data.myTriaPnts.size() / 3 * 3 ); // remove an incomplete triangle
 
-    // skip the keywords "endloop"
-    fscanf(file,"%*s");
+  if ( data.myTriaPnts.empty() )
+    return DRS_EMPTY;
 
-    // skip the keywords "endfacet"
-    fscanf(file,"%*s");
-  }
+  if ( !data.addToMesh( myMesh, myIsCreateFaces ))
+    aResult = DRS_FAIL;
 
-  fclose(file);
   return aResult;
 }
 
@@ -344,23 +346,24 @@ Driver_Mesh::Status DriverSTL_R_SMDS_Mesh::readBinary(SMESH_File& file) const
   // skip the header
   file += HEADER_SIZE;
 
-  TDataMapOfPntNodePtr uniqnodes;
-  
+  TSTLData data( nbTri );
+
   for (Standard_Integer iTri = 0; iTri < nbTri; ++iTri) {
 
     // ignore normals
     file += 3 * SIZE_OF_FLOAT;
 
     // read vertices
-    SMDS_MeshNode* node1 = readNode( file, uniqnodes, myMesh );
-    SMDS_MeshNode* node2 = readNode( file, uniqnodes, myMesh );
-    SMDS_MeshNode* node3 = readNode( file, uniqnodes, myMesh );
-
-    if (myIsCreateFaces)
-      myMesh->AddFace(node1,node2,node3);
+    readNode( file, data );
+    readNode( file, data );
+    readNode( file, data );
 
     // skip extra bytes
     file += 2;
   }
+
+  if ( !data.addToMesh( myMesh, myIsCreateFaces ))
+    aResult = DRS_FAIL;
+
   return aResult;
 }
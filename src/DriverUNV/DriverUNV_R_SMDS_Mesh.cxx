@@ -33,54 +33,293 @@
 #include "UNV2420_Structure.hxx"
 #include "UNV_Utilities.hxx"
 
+#include "SMESH_File.hxx"
+
 #include <Basics_Utils.hxx>
 
+#include <map>
+#include <vector>
+
 using namespace std;
 
 namespace
 {
+  const size_t theBatchSize = 100000;
+
+  //================================================================================
   /*!
    * \brief Move node coordinates to the global Cartesian CS
    */
-  void transformNodes( UNV2411::TDataSet::const_iterator fromNode,
-                       UNV2411::TDataSet::const_iterator endNode,
-                       const UNV2420::TRecord &          csRecord )
-  {
-    const int csLabel = fromNode->exp_coord_sys_num;
-
-    UNV2411::TDataSet::const_iterator nodeIt;
+  //================================================================================
 
+  void transformNode( UNV2411::TRecord& nodeRec, const UNV2420::TRecord& csRecord )
+  {
     // apply Transformation Matrix
     if ( !csRecord.isIdentityMatrix() )
-    {
-      for ( nodeIt = fromNode; nodeIt != endNode; ++nodeIt )
-      {
-        const UNV2411::TRecord& nodeRec = *nodeIt;
-        if ( nodeRec.exp_coord_sys_num == csLabel )
-          csRecord.ApplyMatrix( (double*) nodeRec.coord );
-      }
-    }
+      csRecord.ApplyMatrix( nodeRec.coord );
 
     // transform from Cylindrical CS
     if ( csRecord.coord_sys_type == UNV2420::Cylindrical )
-    {
-      for ( nodeIt = fromNode; nodeIt != endNode; ++nodeIt )
-      {
-        const UNV2411::TRecord& nodeRec = *nodeIt;
-        if ( nodeRec.exp_coord_sys_num == csLabel )
-          csRecord.FromCylindricalCS( (double*) nodeRec.coord );
-      }
-    }
+      csRecord.FromCylindricalCS( nodeRec.coord );
+
     // transform from Spherical CS
     else if ( csRecord.coord_sys_type == UNV2420::Spherical )
-    {
-      for ( nodeIt = fromNode; nodeIt != endNode; ++nodeIt )
-      {
-        const UNV2411::TRecord& nodeRec = *nodeIt;
-        if ( nodeRec.exp_coord_sys_num == csLabel )
-          csRecord.FromSphericalCS( (double*) nodeRec.coord );
+      csRecord.FromSphericalCS( nodeRec.coord );
+  }
+
+  //================================================================================
+  /*!
+   * \brief Create nodes at once, skipping nodes with already used IDs
+   */
+  //================================================================================
+
+  void addNodes( SMDS_Mesh*             mesh,
+                 std::vector<double>&   coords,
+                 std::vector<smIdType>& nodeIDs )
+  {
+    const smIdType nbNodes = nodeIDs.size();
+    for ( smIdType i = 0; i < nbNodes; )
+      i += mesh->AddNodesWithID( nbNodes - i, &coords[ 3 * i ], &nodeIDs[ i ]) + 1;
+
+    coords.clear();
+    nodeIDs.clear();
+  }
+
+  //================================================================================
+  /*!
+   * \brief Create an element in the mesh
+   */
+  //================================================================================
+
+  SMDS_MeshElement* addElement( SMDS_Mesh* mesh, const UNV2412::TRecord& aRec )
+  {
+    using namespace UNV2412;
+
+    SMDS_MeshElement* anElement = NULL;
+    if(IsBeam(aRec.fe_descriptor_id)) {
+      switch ( aRec.node_labels.size() ) {
+      case 2: // edge with two nodes
+        //MESSAGE("add edge " << aLabel << " " << aRec.node_labels[0] << " " << aRec.node_labels[1]);
+        anElement = mesh->AddEdgeWithID(aRec.node_labels[0],
+                                        aRec.node_labels[1],
+                                        aRec.label);
+        break;
+      case 3: // quadratic edge (with 3 nodes)
+        //MESSAGE("add edge " << aRec.label << " " << aRec.node_labels[0] << " " << aRec.node_labels[1] << " " << aRec.node_labels[2]);
+        anElement = mesh->AddEdgeWithID(aRec.node_labels[0],
+                                        aRec.node_labels[2],
+                                        aRec.node_labels[1],
+                                        aRec.label);
+      }
+    }
+    else if(IsFace(aRec.fe_descriptor_id)) {
+      //MESSAGE("add face " << aRec.label);
+      switch(aRec.fe_descriptor_id){
+      case 41: // Plane Stress Linear Triangle
+      case 51: // Plane Strain Linear Triangle
+      case 61: // Plate Linear Triangle
+      case 74: // Membrane Linear Triangle
+      case 81: // Axisymmetric Solid Linear Triangle
+      case 91: // Thin Shell Linear Triangle
+        anElement = mesh->AddFaceWithID(aRec.node_labels[0],
+                                        aRec.node_labels[1],
+                                        aRec.node_labels[2],
+                                        aRec.label);
+        break;
+
+      case 42: //  Plane Stress Parabolic Triangle
+      case 52: //  Plane Strain Parabolic Triangle
+      case 62: //  Plate Parabolic Triangle
+      case 72: //  Membrane Parabolic Triangle
+      case 82: //  Axisymmetric Solid Parabolic Triangle
+      case 92: //  Thin Shell Parabolic Triangle
+        if ( aRec.node_labels.size() == 7 )
+          anElement = mesh->AddFaceWithID(aRec.node_labels[0],
+                                          aRec.node_labels[2],
+                                          aRec.node_labels[4],
+                                          aRec.node_labels[1],
+                                          aRec.node_labels[3],
+                                          aRec.node_labels[5],
+                                          aRec.node_labels[6],
+                                          aRec.label);
+        else
+          anElement = mesh->AddFaceWithID(aRec.node_labels[0],
+                                          aRec.node_labels[2],
+                                          aRec.node_labels[4],
+                                          aRec.node_labels[1],
+                                          aRec.node_labels[3],
+                                          aRec.node_labels[5],
+                                          aRec.label);
+        break;
+
+      case 44: // Plane Stress Linear Quadrilateral
+      case 54: // Plane Strain Linear Quadrilateral
+      case 64: // Plate Linear Quadrilateral
+      case 71: // Membrane Linear Quadrilateral
+      case 84: // Axisymmetric Solid Linear Quadrilateral
+      case 94: // Thin Shell Linear Quadrilateral
+        anElement = mesh->AddFaceWithID(aRec.node_labels[0],
+                                        aRec.node_labels[1],
+                                        aRec.node_labels[2],
+                                        aRec.node_labels[3],
+                                        aRec.label);
+        break;
+
+      case 45: // Plane Stress Parabolic Quadrilateral
+      case 55: // Plane Strain Parabolic Quadrilateral
+      case 65: // Plate Parabolic Quadrilateral
+      case 75: // Membrane Parabolic Quadrilateral
+      case 85: // Axisymmetric Solid Parabolic Quadrilateral
+      case 95: // Thin Shell Parabolic Quadrilateral
+        if ( aRec.node_labels.size() == 9 )
+          anElement = mesh->AddFaceWithID(aRec.node_labels[0],
+                                          aRec.node_labels[2],
+                                          aRec.node_labels[4],
+                                          aRec.node_labels[6],
+                                          aRec.node_labels[1],
+                                          aRec.node_labels[3],
+                                          aRec.node_labels[5],
+                                          aRec.node_labels[7],
+                                          aRec.node_labels[8],
+                                          aRec.label);
+        else
+          anElement = mesh->AddFaceWithID(aRec.node_labels[0],
+                                          aRec.node_labels[2],
+                                          aRec.node_labels[4],
+                                          aRec.node_labels[6],
+                                          aRec.node_labels[1],
+                                          aRec.node_labels[3],
+                                          aRec.node_labels[5],
+                                          aRec.node_labels[7],
+                                          aRec.label);
+        break;
+      }
+    }
+    else if(IsVolume(aRec.fe_descriptor_id)){
+      //MESSAGE("add volume " << aRec.label);
+      switch(aRec.fe_descriptor_id){
+
+      case 111: // Solid Linear Tetrahedron - TET4
+        anElement = mesh->AddVolumeWithID(aRec.node_labels[0],
+                                          aRec.node_labels[2],
+                                          aRec.node_labels[1],
+                                          aRec.node_labels[3],
+                                          aRec.label);
+        break;
+
+      case 118: // Solid Quadratic Tetrahedron - TET10
+        anElement = mesh->AddVolumeWithID(aRec.node_labels[0],
+                                          aRec.node_labels[4],
+                                          aRec.node_labels[2],
+
+                                          aRec.node_labels[9],
+
+                                          aRec.node_labels[5],
+                                          aRec.node_labels[3],
+                                          aRec.node_labels[1],
+
+                                          aRec.node_labels[6],
+                                          aRec.node_labels[8],
+                                          aRec.node_labels[7],
+                                          aRec.label);
+        break;
+
+      case 112: // Solid Linear Prism - PRISM6
+        anElement = mesh->AddVolumeWithID(aRec.node_labels[0],
+                                          aRec.node_labels[2],
+                                          aRec.node_labels[1],
+                                          aRec.node_labels[3],
+                                          aRec.node_labels[5],
+                                          aRec.node_labels[4],
+                                          aRec.label);
+        break;
+
+      case 113: // Solid Quadratic Prism - PRISM15
+        anElement = mesh->AddVolumeWithID(aRec.node_labels[0],
+                                          aRec.node_labels[4],
+                                          aRec.node_labels[2],
+
+                                          aRec.node_labels[9],
+                                          aRec.node_labels[13],
+                                          aRec.node_labels[11],
+
+                                          aRec.node_labels[5],
+                                          aRec.node_labels[3],
+                                          aRec.node_labels[1],
+
+                                          aRec.node_labels[14],
+                                          aRec.node_labels[12],
+                                          aRec.node_labels[10],
+
+                                          aRec.node_labels[6],
+                                          aRec.node_labels[8],
+                                          aRec.node_labels[7],
+                                          aRec.label);
+        break;
+
+      case 115: // Solid Linear Brick - HEX8
+        anElement = mesh->AddVolumeWithID(aRec.node_labels[0],
+                                          aRec.node_labels[3],
+                                          aRec.node_labels[2],
+                                          aRec.node_labels[1],
+                                          aRec.node_labels[4],
+                                          aRec.node_labels[7],
+                                          aRec.node_labels[6],
+                                          aRec.node_labels[5],
+                                          aRec.label);
+        break;
+
+      case 116: // Solid Quadratic Brick - HEX20
+        anElement = mesh->AddVolumeWithID(aRec.node_labels[0],
+                                          aRec.node_labels[6],
+                                          aRec.node_labels[4],
+                                          aRec.node_labels[2],
+
+                                          aRec.node_labels[12],
+                                          aRec.node_labels[18],
+                                          aRec.node_labels[16],
+                                          aRec.node_labels[14],
+
+                                          aRec.node_labels[7],
+                                          aRec.node_labels[5],
+                                          aRec.node_labels[3],
+                                          aRec.node_labels[1],
+
+                                          aRec.node_labels[19],
+                                          aRec.node_labels[17],
+                                          aRec.node_labels[15],
+                                          aRec.node_labels[13],
+
+                                          aRec.node_labels[8],
+                                          aRec.node_labels[11],
+                                          aRec.node_labels[10],
+                                          aRec.node_labels[9],
+                                          aRec.label);
+        break;
+
+      case 114: // pyramid of 13 nodes (quadratic) - PIRA13
+        anElement = mesh->AddVolumeWithID(aRec.node_labels[0],
+                                          aRec.node_labels[6],
+                                          aRec.node_labels[4],
+                                          aRec.node_labels[2],
+
+                                          aRec.node_labels[12],
+
+                                          aRec.node_labels[7],
+                                          aRec.node_labels[5],
+                                          aRec.node_labels[3],
+                                          aRec.node_labels[1],
+
+                                          aRec.node_labels[8],
+                                          aRec.node_labels[11],
+                                          aRec.node_labels[10],
+                                          aRec.node_labels[9],
+                                          aRec.label);
+        break;
+
       }
     }
+    return anElement;
   }
 }
 
@@ -101,6 +340,8 @@ Driver_Mesh::Status DriverUNV_R_SMDS_Mesh::Perform()
 #else
   std::ifstream in_stream(myFile.c_str());
 #endif
+  // nodes and elements are read from the memory-mapped file
+  SMESH_File aMappedFile( myFile );
   try
   {
     {
@@ -112,286 +353,59 @@ Driver_Mesh::Status DriverUNV_R_SMDS_Mesh::Perform()
       UNV2420::TDataSet aCoordSysDataSet;
       UNV2420::Read(in_stream, myMeshName, aCoordSysDataSet);
 
-      // Read nodes
-      using namespace UNV2411;
-      TDataSet aDataSet2411;
-      UNV2411::Read(in_stream,aDataSet2411);
-      MESSAGE("Perform - aDataSet2411.size() = "<<aDataSet2411.size());
+      // Coordinate systems by label
+      std::map< int, const UNV2420::TRecord* > aCoordSysMap;
+      UNV2420::TDataSet::const_iterator csIter = aCoordSysDataSet.begin();
+      for ( ; csIter != aCoordSysDataSet.end(); ++csIter )
+        aCoordSysMap.insert( std::make_pair( csIter->coord_sys_label, &*csIter ));
 
-      // Move nodes in a global CS
-      if ( !aCoordSysDataSet.empty() )
+      const double lenFactor = aUnitsRecord.factors[ UNV164::LENGTH_FACTOR ];
+
+      // Read nodes and create them in the mesh by batches, as they are read
+      std::vector< double >   aCoords;
+      std::vector< smIdType > aNodeIDs;
+      aCoords.reserve( 3 * theBatchSize );
+      aNodeIDs.reserve( theBatchSize );
+      smIdType aNbNodes = 0;
+
+      UNV2411::Read( aMappedFile, [&]( const UNV2411::TRecord& aRec )
       {
-        UNV2420::TDataSet::const_iterator csIter = aCoordSysDataSet.begin();
-        for ( ; csIter != aCoordSysDataSet.end(); ++csIter )
+        UNV2411::TRecord nodeRec = aRec;
+
+        // Move node in a global CS
+        if ( !aCoordSysMap.empty() )
         {
-          // find any node in this CS
-          TDataSet::const_iterator nodeIter = aDataSet2411.begin();
-          for (; nodeIter != aDataSet2411.end(); nodeIter++)
-            if ( nodeIter->exp_coord_sys_num == csIter->coord_sys_label )
-            {
-              transformNodes( nodeIter, aDataSet2411.end(), *csIter );
-              break;
-            }
+          auto label2cs = aCoordSysMap.find( nodeRec.exp_coord_sys_num );
+          if ( label2cs != aCoordSysMap.end() )
+            transformNode( nodeRec, *label2cs->second );
         }
-      }
-      // Move nodes to SI unit system
-      const double lenFactor = aUnitsRecord.factors[ UNV164::LENGTH_FACTOR ];
-      if ( lenFactor != 1. )
-      {
-        TDataSet::iterator nodeIter = aDataSet2411.begin(), nodeEnd;
-        for ( nodeEnd = aDataSet2411.end(); nodeIter != nodeEnd; nodeIter++)
+        // Move node to SI unit system
+        if ( lenFactor != 1. )
         {
-          UNV2411::TRecord& nodeRec = *nodeIter;
           nodeRec.coord[0] *= lenFactor;
           nodeRec.coord[1] *= lenFactor;
           nodeRec.coord[2] *= lenFactor;
         }
-      }
 
-      // Create nodes in the mesh
-      TDataSet::const_iterator anIter = aDataSet2411.begin();
-      for(; anIter != aDataSet2411.end(); anIter++)
-      {
-        const TRecord& aRec = *anIter;
-        myMesh->AddNodeWithID(aRec.coord[0],aRec.coord[1],aRec.coord[2],aRec.label);
-      }
+        aCoords.insert( aCoords.end(), nodeRec.coord, nodeRec.coord + 3 );
+        aNodeIDs.push_back( nodeRec.label );
+        if ( aNodeIDs.size() == theBatchSize )
+          addNodes( myMesh, aCoords, aNodeIDs );
+        ++aNbNodes;
+      });
+      addNodes( myMesh, aCoords, aNodeIDs );
+      MESSAGE("Perform - nb nodes in 2411 = "<<aNbNodes);
     }
     {
-      using namespace UNV2412;
-      TDataSet aDataSet2412;
-      UNV2412::Read(in_stream,aDataSet2412);
-      TDataSet::const_iterator anIter = aDataSet2412.begin();
-      MESSAGE("Perform - aDataSet2412.size() = "<<aDataSet2412.size());
-      for(; anIter != aDataSet2412.end(); anIter++)
+      // Read elements and create them in the mesh as they are read
+      smIdType aNbElems = 0;
+      UNV2412::Read( aMappedFile, [&]( const UNV2412::TRecord& aRec )
       {
-        SMDS_MeshElement* anElement = NULL;
-        const TRecord& aRec = *anIter;
-        if(IsBeam(aRec.fe_descriptor_id)) {
-          switch ( aRec.node_labels.size() ) {
-          case 2: // edge with two nodes
-            //MESSAGE("add edge " << aLabel << " " << aRec.node_labels[0] << " " << aRec.node_labels[1]);
-            anElement = myMesh->AddEdgeWithID(aRec.node_labels[0],
-                                              aRec.node_labels[1],
-                                              aRec.label);
-            break;
-          case 3: // quadratic edge (with 3 nodes)
-            //MESSAGE("add edge " << aRec.label << " " << aRec.node_labels[0] << " " << aRec.node_labels[1] << " " << aRec.node_labels[2]);
-            anElement = myMesh->AddEdgeWithID(aRec.node_labels[0],
-                                              aRec.node_labels[2],
-                                              aRec.node_labels[1],
-                                              aRec.label);
-          }
-        }
-        else if(IsFace(aRec.fe_descriptor_id)) {
-          //MESSAGE("add face " << aRec.label);
-          switch(aRec.fe_descriptor_id){
-          case 41: // Plane Stress Linear Triangle
-          case 51: // Plane Strain Linear Triangle
-          case 61: // Plate Linear Triangle
-          case 74: // Membrane Linear Triangle
-          case 81: // Axisymmetric Solid Linear Triangle
-          case 91: // Thin Shell Linear Triangle
-            anElement = myMesh->AddFaceWithID(aRec.node_labels[0],
-                                              aRec.node_labels[1],
-                                              aRec.node_labels[2],
-                                              aRec.label);
-            break;
-
-          case 42: //  Plane Stress Parabolic Triangle
-          case 52: //  Plane Strain Parabolic Triangle
-          case 62: //  Plate Parabolic Triangle
-          case 72: //  Membrane Parabolic Triangle
-          case 82: //  Axisymmetric Solid Parabolic Triangle
-          case 92: //  Thin Shell Parabolic Triangle
-            if ( aRec.node_labels.size() == 7 )
-              anElement = myMesh->AddFaceWithID(aRec.node_labels[0],
-                                                aRec.node_labels[2],
-                                                aRec.node_labels[4],
-                                                aRec.node_labels[1],
-                                                aRec.node_labels[3],
-                                                aRec.node_labels[5],
-                                                aRec.node_labels[6],
-                                                aRec.label);
-            else
-              anElement = myMesh->AddFaceWithID(aRec.node_labels[0],
-                                                aRec.node_labels[2],
-                                                aRec.node_labels[4],
-                                                aRec.node_labels[1],
-                                                aRec.node_labels[3],
-                                                aRec.node_labels[5],
-                                                aRec.label);
-            break;
-
-          case 44: // Plane Stress Linear Quadrilateral
-          case 54: // Plane Strain Linear Quadrilateral
-          case 64: // Plate Linear Quadrilateral
-          case 71: // Membrane Linear Quadrilateral
-          case 84: // Axisymmetric Solid Linear Quadrilateral
-          case 94: // Thin Shell Linear Quadrilateral
-            anElement = myMesh->AddFaceWithID(aRec.node_labels[0],
-                                              aRec.node_labels[1],
-                                              aRec.node_labels[2],
-                                              aRec.node_labels[3],
-                                              aRec.label);
-            break;
-
-          case 45: // Plane Stress Parabolic Quadrilateral
-          case 55: // Plane Strain Parabolic Quadrilateral
-          case 65: // Plate Parabolic Quadrilateral
-          case 75: // Membrane Parabolic Quadrilateral
-          case 85: // Axisymmetric Solid Parabolic Quadrilateral
-          case 95: // Thin Shell Parabolic Quadrilateral
-            if ( aRec.node_labels.size() == 9 )
-              anElement = myMesh->AddFaceWithID(aRec.node_labels[0],
-                                                aRec.node_labels[2],
-                                                aRec.node_labels[4],
-                                                aRec.node_labels[6],
-                                                aRec.node_labels[1],
-                                                aRec.node_labels[3],
-                                                aRec.node_labels[5],
-                                                aRec.node_labels[7],
-                                                aRec.node_labels[8],
-                                                aRec.label);
-            else
-              anElement = myMesh->AddFaceWithID(aRec.node_labels[0],
-                                                aRec.node_labels[2],
-                                                aRec.node_labels[4],
-                                                aRec.node_labels[6],
-                                                aRec.node_labels[1],
-                                                aRec.node_labels[3],
-                                                aRec.node_labels[5],
-                                                aRec.node_labels[7],
-                                                aRec.label);
-            break;
-          }
-        }
-        else if(IsVolume(aRec.fe_descriptor_id)){
-          //MESSAGE("add volume " << aRec.label);
-          switch(aRec.fe_descriptor_id){
-
-          case 111: // Solid Linear Tetrahedron - TET4
-            anElement = myMesh->AddVolumeWithID(aRec.node_labels[0],
-                                                aRec.node_labels[2],
-                                                aRec.node_labels[1],
-                                                aRec.node_labels[3],
-                                                aRec.label);
-            break;
-
-          case 118: // Solid Quadratic Tetrahedron - TET10
-            anElement = myMesh->AddVolumeWithID(aRec.node_labels[0],
-                                                aRec.node_labels[4],
-                                                aRec.node_labels[2],
-
-                                                aRec.node_labels[9],
-
-                                                aRec.node_labels[5],
-                                                aRec.node_labels[3],
-                                                aRec.node_labels[1],
-
-                                                aRec.node_labels[6],
-                                                aRec.node_labels[8],
-                                                aRec.node_labels[7],
-                                                aRec.label);
-            break;
-
-          case 112: // Solid Linear Prism - PRISM6
-            anElement = myMesh->AddVolumeWithID(aRec.node_labels[0],
-                                                aRec.node_labels[2],
-                                                aRec.node_labels[1],
-                                                aRec.node_labels[3],
-                                                aRec.node_labels[5],
-                                                aRec.node_labels[4],
-                                                aRec.label);
-            break;
-
-          case 113: // Solid Quadratic Prism - PRISM15
-            anElement = myMesh->AddVolumeWithID(aRec.node_labels[0],
-                                                aRec.node_labels[4],
-                                                aRec.node_labels[2],
-
-                                                aRec.node_labels[9],
-                                                aRec.node_labels[13],
-                                                aRec.node_labels[11],
-
-                                                aRec.node_labels[5],
-                                                aRec.node_labels[3],
-                                                aRec.node_labels[1],
-
-                                                aRec.node_labels[14],
-                                                aRec.node_labels[12],
-                                                aRec.node_labels[10],
-
-                                                aRec.node_labels[6],
-                                                aRec.node_labels[8],
-                                                aRec.node_labels[7],
-                                                aRec.label);
-            break;
-
-          case 115: // Solid Linear Brick - HEX8
-            anElement = myMesh->AddVolumeWithID(aRec.node_labels[0],
-                                                aRec.node_labels[3],
-                                                aRec.node_labels[2],
-                                                aRec.node_labels[1],
-                                                aRec.node_labels[4],
-                                                aRec.node_labels[7],
-                                                aRec.node_labels[6],
-                                                aRec.node_labels[5],
-                                                aRec.label);
-            break;
-
-          case 116: // Solid Quadratic Brick - HEX20
-            anElement = myMesh->AddVolumeWithID(aRec.node_labels[0],
-                                                aRec.node_labels[6],
-                                                aRec.node_labels[4],
-                                                aRec.node_labels[2],
-
-                                                aRec.node_labels[12],
-                                                aRec.node_labels[18],
-                                                aRec.node_labels[16],
-                                                aRec.node_labels[14],
-
-                                                aRec.node_labels[7],
-                                                aRec.node_labels[5],
-                                                aRec.node_labels[3],
-                                                aRec.node_labels[1],
-
-                                                aRec.node_labels[19],
-                                                aRec.node_labels[17],
-                                                aRec.node_labels[15],
-                                                aRec.node_labels[13],
-
-                                                aRec.node_labels[8],
-                                                aRec.node_labels[11],
-                                                aRec.node_labels[10],
-                                                aRec.node_labels[9],
-                                                aRec.label);
-            break;
-
-          case 114: // pyramid of 13 nodes (quadratic) - PIRA13
-            anElement = myMesh->AddVolumeWithID(aRec.node_labels[0],
-                                                aRec.node_labels[6],
-                                                aRec.node_labels[4],
-                                                aRec.node_labels[2],
-
-                                                aRec.node_labels[12],
-
-                                                aRec.node_labels[7],
-                                                aRec.node_labels[5],
-                                                aRec.node_labels[3],
-                                                aRec.node_labels[1],
-
-                                                aRec.node_labels[8],
-                                                aRec.node_labels[11],
-                                                aRec.node_labels[10],
-                                                aRec.node_labels[9],
-                                                aRec.label);
-            break;
-
-          }
-        }
-        if(!anElement)
+        if ( !addElement( myMesh, aRec ))
           MESSAGE("DriverUNV_R_SMDS_Mesh::Perform - can not add element with ID = "<<aRec.label<<" and type = "<<aRec.fe_descriptor_id);
-      }
+        ++aNbElems;
+      });
+      MESSAGE("Perform - nb elements in 2412 = "<<aNbElems);
     }
     {
       using namespace UNV2417;
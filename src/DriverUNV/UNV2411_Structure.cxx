@@ -26,6 +26,8 @@
 #include "UNV2411_Structure.hxx"
 #include "UNV_Utilities.hxx"
 
+#include <algorithm>
+
 using namespace std;
 using namespace UNV;
 using namespace UNV2411;
@@ -117,6 +119,69 @@ void UNV2411::Read(std::ifstream& in_stream, TDataSet& theDataSet)
 }
 
 
+void UNV2411::Read(SMESH_File& theFile, const TRecordFun& theFun)
+{
+  if(!beginning_of_dataset(theFile,_label_dataset))
+    EXCEPTION(runtime_error,"ERROR: Could not find "<<_label_dataset<<" dataset!");
+
+  std::vector<int>    ints( 3 );
+  std::vector<double> coords( 3 );
+
+  // Issue 22638. Find out space dimension to read a 2D mesh from a file
+  // generated by SIMAIL from Simulog
+  {
+    const char* recordStart = theFile;
+
+    ints.resize( 1 );
+    if ( !theFile.getInts( ints ) || ints[0] == -1 )
+      return; // dataset end
+
+    theFile.getLine(); // the rest of record 1
+    std::string num_buf = theFile.getLine();
+    int dim = 0;
+    for ( size_t i = 0; i < num_buf.size(); )
+    {
+      // skip spaces
+      while ( i < num_buf.size() && isspace( num_buf[i] ))
+        ++i;
+
+      dim += ( i < num_buf.size() );
+
+      // skip non-spaces
+      while ( i < num_buf.size() && !isspace( num_buf[i] ))
+        ++i;
+    }
+    if ( dim == 0 )
+      return;
+
+    coords.resize( std::min( dim, 3 ));
+    theFile.setPos( recordStart );
+  }
+
+  // read records
+  TRecord aRec;
+  while ( !theFile.eof() )
+  {
+    ints.resize( 1 );
+    if ( !theFile.getInts( ints ) || ints[0] == -1 )
+      // end of dataset is reached
+      break;
+    aRec.label = ints[0];
+
+    ints.resize( 3 );
+    if ( !theFile.getInts( ints ) || !theFile.getDoubles( coords ))
+      break;
+    aRec.exp_coord_sys_num  = ints[0];
+    aRec.disp_coord_sys_num = ints[1];
+    aRec.color              = ints[2];
+    for ( size_t d = 0; d < coords.size(); d++ )
+      aRec.coord[d] = coords[d];
+
+    theFun( aRec );
+  }
+}
+
+
 void UNV2411::Write(std::ofstream& out_stream, const TDataSet& theDataSet)
 {
   if(!out_stream.good())
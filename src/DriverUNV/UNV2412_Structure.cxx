@@ -26,6 +26,8 @@
 #include "UNV2412_Structure.hxx"
 #include "UNV_Utilities.hxx"
 
+#include <algorithm>
+
 using namespace std;
 using namespace UNV;
 using namespace UNV2412;
@@ -237,6 +239,49 @@ void UNV2412::Read(std::ifstream& in_stream, TDataSet& theDataSet)
 }
 
 
+void UNV2412::Read(SMESH_File& theFile, const TRecordFun& theFun)
+{
+  if(!beginning_of_dataset(theFile,_label_dataset))
+    EXCEPTION(runtime_error,"ERROR: Could not find "<<_label_dataset<<" dataset!");
+
+  std::vector<int> ints( 5 );
+  TRecord aRec;
+  while ( !theFile.eof() )
+  {
+    ints.resize( 1 );
+    if ( !theFile.getInts( ints ) || ints[0] == -1 )
+      // end of dataset is reached
+      break;
+    aRec.label = ints[0];
+
+    ints.resize( 5 );
+    if ( !theFile.getInts( ints ))
+      break;
+    aRec.fe_descriptor_id  = ints[0];
+    aRec.phys_prop_tab_num = ints[1];
+    aRec.mat_prop_tab_num  = ints[2];
+    aRec.color             = ints[3];
+    int n_nodes            = ints[4];
+
+    if(IsBeam(aRec.fe_descriptor_id)){
+      ints.resize( 3 );
+      if ( !theFile.getInts( ints ))
+        break;
+      aRec.beam_orientation = ints[0];
+      aRec.beam_fore_end    = ints[1];
+      aRec.beam_aft_end     = ints[2];
+    }
+
+    // read node labels
+    aRec.node_labels.resize( std::max( 0, n_nodes ));
+    if ( !theFile.getInts( aRec.node_labels ))
+      break;
+
+    theFun( aRec );
+  }
+}
+
+
 void UNV2412::Write(std::ofstream& out_stream, const TDataSet& theDataSet)
 {
   if(!out_stream.good())
@@ -25,9 +25,12 @@
 
 #include "SMESH_DriverUNV.hxx"
 
+#include <functional>
 #include <vector>
 #include <fstream>
 
+class SMESH_File;
+
 namespace UNV2412{
   
   typedef std::vector<int> TNodeLabels; // Nodal connectivities
@@ -52,9 +55,16 @@ namespace UNV2412{
   
   typedef std::vector<TRecord> TDataSet;
 
+  // function called for each read record
+  typedef std::function< void( const TRecord& ) > TRecordFun;
+
   MESHDRIVERUNV_EXPORT void
     Read(std::ifstream& in_stream, TDataSet& theDataSet);
 
+  // read records one by one from a memory-mapped file without storing them
+  MESHDRIVERUNV_EXPORT void
+    Read(SMESH_File& theFile, const TRecordFun& theFun);
+
   MESHDRIVERUNV_EXPORT void
     Write(std::ofstream& out_stream, const TDataSet& theDataSet);
 
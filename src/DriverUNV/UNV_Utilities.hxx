@@ -25,13 +25,17 @@
 
 #include "SMESH_DriverUNV.hxx"
 
+#include "SMESH_File.hxx"
+
 #include <iostream>     
 #include <sstream>      
 #include <fstream>
 #include <string>
 #include <stdexcept>
 #include <cassert>
+#include <cctype>
 #include <cstdlib>
+#include <cstring>
 
 namespace UNV {
 
@@ -86,6 +90,52 @@ namespace UNV {
     return false;
   }
 
+  /**
+   * @returns \p false when error occurred, \p true otherwise.
+   * Sets the current position of the memory-mapped \p file to
+   * the first record of the dataset \p ds_name.
+   */
+  inline bool beginning_of_dataset(SMESH_File& file, const std::string& ds_name)
+  {
+    assert (!ds_name.empty());
+
+    file.rewind();
+    const char* pos = file;
+    const char* end = file.end();
+    bool afterDelimiter = false; // previous line is "-1"
+    while ( pos < end )
+    {
+      // get the first word of a line
+      while ( pos < end && ( *pos == ' ' || *pos == '\t' ))
+        ++pos;
+      const char* word = pos;
+      while ( pos < end && !isspace( *pos ))
+        ++pos;
+      const size_t wordLen = pos - word;
+      const bool isDelimiter = ( wordLen == 2 && strncmp( word, "-1", 2 ) == 0 );
+
+      // go to the next line
+      while ( pos < end && *pos != '\n' )
+        ++pos;
+      if ( pos < end )
+        ++pos;
+
+      /*
+       * a "-1" followed by a number means the beginning of a dataset
+       */
+      if ( afterDelimiter && !isDelimiter &&
+           wordLen == ds_name.size() && strncmp( word, ds_name.c_str(), wordLen ) == 0 )
+      {
+        if ( pos >= end )
+          return false;
+        file.setPos( pos );
+        return true;
+      }
+      afterDelimiter = isDelimiter;
+    }
+    return false;
+  }
+
   /**
    * Method for converting exponential notation
    * from "D" to "e", for example
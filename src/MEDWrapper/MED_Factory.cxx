@@ -32,6 +32,7 @@
 #include <fstream>
 
 #include <med.h>
+#include <hdf5.h>
 extern "C"
 {
 #ifndef WIN32
@@ -206,4 +207,54 @@ namespace MED
     }
     return new MED::TWrapper(fileName, true, tfileInst, wantedMajor, wantedMinor);
   }
+
+  /*!
+   *  Copy a mesh and its families from a MED file to another one (created if absent)
+   *  as raw HDF5 objects, i.e. without decoding the mesh data
+   */
+  bool CopyMesh(const std::string& fromFileName,
+                const std::string& toFileName,
+                const std::string& meshName)
+  {
+    // HDF5 paths of a mesh and of its families in a MED file
+    const char* medGroups[] = { "/ENS_MAA", "/FAS" };
+
+    med_idt fromFid = MEDfileOpen(fromFileName.c_str(), MED_ACC_RDONLY);
+    if (fromFid < 0)
+      return false;
+
+    bool isOk = (H5Lexists(fromFid, medGroups[0], H5P_DEFAULT) > 0 &&
+                 H5Lexists(fromFid, (std::string(medGroups[0]) + "/" + meshName).c_str(), H5P_DEFAULT) > 0);
+    if (isOk)
+    {
+      med_access_mode mode = exists(toFileName) ? MED_ACC_RDWR : MED_ACC_CREAT;
+      med_idt toFid = MEDfileOpen(toFileName.c_str(), mode);
+      isOk = (toFid >= 0);
+      if (isOk)
+      {
+        hid_t linkProps = H5Pcreate(H5P_LINK_CREATE);
+        H5Pset_create_intermediate_group(linkProps, 1);
+        for (const char* medGroup : medGroups)
+        {
+          std::string path = std::string(medGroup) + "/" + meshName;
+          if (H5Lexists(fromFid, medGroup, H5P_DEFAULT) <= 0 ||
+              H5Lexists(fromFid, path.c_str(), H5P_DEFAULT) <= 0)
+            continue;
+          if (H5Lexists(toFid, medGroup, H5P_DEFAULT) > 0 &&
+              H5Lexists(toFid, path.c_str(), H5P_DEFAULT) > 0)
+          {
+            isOk = false; // do not overwrite an existing mesh
+            break;
+          }
+          isOk = (H5Ocopy(fromFid, path.c_str(), toFid, path.c_str(), H5P_DEFAULT, linkProps) >= 0);
+          if (!isOk)
+            break;
+        }
+        H5Pclose(linkProps);
+        MEDfileClose(toFid);
+      }
+    }
+    MEDfileClose(fromFid);
+    return isOk;
+  }
 }
@@ -48,6 +48,11 @@ namespace MED
 
   MEDWRAPPER_EXPORT
   PWrapper CrWrapperW( const std::string&, int theVersion=-1 , TFileInternal *tfileInst=nullptr );
+
+  MEDWRAPPER_EXPORT
+  bool CopyMesh( const std::string& fromFileName,
+                 const std::string& toFileName,
+                 const std::string& meshName );
 }
 
 #endif // MED_Factory_HeaderFile
@@ -36,6 +36,8 @@
 
 #include <boost/version.hpp>
 
+#include <algorithm>
+
 namespace MED
 {
   //---------------------------------------------------------------
@@ -1002,6 +1004,101 @@ namespace MED
       EXCEPTION(std::runtime_error, "GetNodeInfo - MEDmeshNodeCoordinateRd(...)");
   }
 
+  //----------------------------------------------------------------------------
+  //! Create a MED filter selecting entities by their indices, values are stored compact
+  static
+  TErr
+  CreateFilter(TIdt               theFid,
+               TInt               theNbEntities,
+               TInt               theNbConstituents,
+               EModeSwitch        theModeSwitch,
+               const TIntVector&  theIndices,
+               med_filter&        theFilter)
+  {
+    return MEDfilterEntityCr(theFid,
+                             theNbEntities,
+                             1,
+                             theNbConstituents,
+                             MED_ALL_CONSTITUENT,
+                             med_switch_mode(theModeSwitch),
+                             MED_COMPACT_STMODE,
+                             MED_NO_PROFILE,
+                             (med_int)theIndices.size(),
+                             &theIndices[0],
+                             &theFilter);
+  }
+
+  //----------------------------------------------------------------------------
+  void
+  TWrapper
+  ::GetNodeInfo(MED::TNodeInfo& theInfo,
+                const TIntVector& theIndices,
+                TErr* theErr)
+  {
+    TFileWrapper aFileWrapper(myFile, eLECTURE, theErr, myMinor);
+
+    if ((theErr && *theErr < 0) || theIndices.empty())
+      return;
+
+    MED::TMeshInfo& aMeshInfo = *theInfo.myMeshInfo;
+
+    TValueHolder<TString, char>         aMeshName(aMeshInfo.myName);
+    TValueHolder<TNodeCoord, med_float> aCoord   (theInfo.myCoord);
+    TValueHolder<TElemNum, med_int>     anElemNum(theInfo.myElemNum);
+    TValueHolder<TElemNum, med_int>     aFamNum  (theInfo.myFamNum);
+
+    TInt aNbNodes = GetNbNodes(aMeshInfo);
+
+    med_filter aFilter = MED_FILTER_INIT;
+    TErr aRet = CreateFilter(myFile->Id(), aNbNodes, aMeshInfo.mySpaceDim,
+                             theInfo.myModeSwitch, theIndices, aFilter);
+    if (aRet >= 0) {
+      aRet = MEDmeshNodeCoordinateAdvancedRd(myFile->Id(),
+                                             &aMeshName,
+                                             MED_NO_DT,
+                                             MED_NO_IT,
+                                             &aFilter,
+                                             &aCoord);
+      MEDfilterClose(&aFilter);
+    }
+
+    // families and numbers have one value per node
+    med_filter anAttrFilter = MED_FILTER_INIT;
+    if (aRet >= 0 &&
+        CreateFilter(myFile->Id(), aNbNodes, 1, eFULL_INTERLACE, theIndices, anAttrFilter) >= 0)
+    {
+      if (MEDmeshEntityAttributeAdvancedRd(myFile->Id(),
+                                           &aMeshName,
+                                           MED_FAMILY_NUMBER,
+                                           MED_NO_DT,
+                                           MED_NO_IT,
+                                           MED_NODE,
+                                           MED_NO_GEOTYPE,
+                                           &anAttrFilter,
+                                           &aFamNum) < 0)
+        std::fill(theInfo.myFamNum->begin(), theInfo.myFamNum->end(), 0);
+
+      if (theInfo.myIsElemNum &&
+          MEDmeshEntityAttributeAdvancedRd(myFile->Id(),
+                                           &aMeshName,
+                                           MED_NUMBER,
+                                           MED_NO_DT,
+                                           MED_NO_IT,
+                                           MED_NODE,
+                                           MED_NO_GEOTYPE,
+                                           &anAttrFilter,
+                                           &anElemNum) < 0)
+        theInfo.myIsElemNum = eFAUX;
+
+      MEDfilterClose(&anAttrFilter);
+    }
+
+    if (theErr)
+      *theErr = aRet;
+    else if (aRet < 0)
+      EXCEPTION(std::runtime_error, "GetNodeInfo - MEDmeshNodeCoordinateAdvancedRd(...)");
+  }
+
   //----------------------------------------------------------------------------
   void
   TWrapper
@@ -2118,6 +2215,85 @@ namespace MED
 
   }
 
+  //----------------------------------------------------------------------------
+  void
+  TWrapper
+  ::GetCellInfo(MED::TCellInfo& theInfo,
+                const TIntVector& theIndices,
+                TErr* theErr)
+  {
+    TFileWrapper aFileWrapper(myFile, eLECTURE, theErr, myMinor);
+
+    if ((theErr && *theErr < 0) || theIndices.empty())
+      return;
+
+    MED::TMeshInfo& aMeshInfo = *theInfo.myMeshInfo;
+
+    TValueHolder<TString, char>                        aMeshName(aMeshInfo.myName);
+    TValueHolder<TElemNum, med_int>                    aConn    (theInfo.myConn);
+    TValueHolder<TElemNum, med_int>                    anElemNum(theInfo.myElemNum);
+    TValueHolder<TElemNum, med_int>                    aFamNum  (theInfo.myFamNum);
+    TValueHolder<EEntiteMaillage, med_entity_type>     anEntity (theInfo.myEntity);
+    TValueHolder<EGeometrieElement, med_geometry_type> aGeom    (theInfo.myGeom);
+    TValueHolder<EConnectivite, med_connectivity_mode> aConnMode(theInfo.myConnMode);
+
+    TInt aNbCells = GetNbCells(aMeshInfo, theInfo.myEntity, theInfo.myGeom, theInfo.myConnMode);
+
+    med_filter aFilter = MED_FILTER_INIT;
+    TErr aRet = CreateFilter(myFile->Id(), aNbCells, theInfo.GetConnDim(),
+                             theInfo.myModeSwitch, theIndices, aFilter);
+    if (aRet >= 0) {
+      aRet = MEDmeshElementConnectivityAdvancedRd(myFile->Id(),
+                                                  &aMeshName,
+                                                  MED_NO_DT,
+                                                  MED_NO_IT,
+                                                  anEntity,
+                                                  aGeom,
+                                                  aConnMode,
+                                                  &aFilter,
+                                                  &aConn);
+      MEDfilterClose(&aFilter);
+    }
+
+    // families and numbers have one value per cell
+    med_filter anAttrFilter = MED_FILTER_INIT;
+    if (aRet >= 0 &&
+        CreateFilter(myFile->Id(), aNbCells, 1, eFULL_INTERLACE, theIndices, anAttrFilter) >= 0)
+    {
+      if (MEDmeshEntityAttributeAdvancedRd(myFile->Id(),
+                                           &aMeshName,
+                                           MED_FAMILY_NUMBER,
+                                           MED_NO_DT,
+                                           MED_NO_IT,
+                                           anEntity,
+                                           aGeom,
+                                           &anAttrFilter,
+                                           &aFamNum) < 0)
+        std::fill(theInfo.myFamNum->begin(), theInfo.myFamNum->end(), 0);
+      else
+        theInfo.myIsFamNum = eVRAI;
+
+      if (theInfo.myIsElemNum &&
+          MEDmeshEntityAttributeAdvancedRd(myFile->Id(),
+                                           &aMeshName,
+                                           MED_NUMBER,
+                                           MED_NO_DT,
+                                           MED_NO_IT,
+                                           anEntity,
+                                           aGeom,
+                                           &anAttrFilter,
+                                           &anElemNum) < 0)
+        theInfo.myIsElemNum = eFAUX;
+
+      MEDfilterClose(&anAttrFilter);
+    }
+
+    if (theErr)
+      *theErr = aRet;
+    else if (aRet < 0)
+      EXCEPTION(std::runtime_error, "GetCellInfo - MEDmeshElementConnectivityAdvancedRd(...)");
+  }
+
   //----------------------------------------------------------------------------
   void
   TWrapper
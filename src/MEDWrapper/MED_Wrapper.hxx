@@ -260,6 +260,18 @@ namespace MED
     GetNodeInfo(TNodeInfo& theInfo,
                 TErr* theErr = NULL);
 
+    //! Read a MEDWrapper MED Nodes representation of some nodes only
+    /*!
+      Coordinates, families and numbers of the nodes are read using a MED filter.
+      \param theInfo - a representation created for theIndices.size() nodes
+      \param theIndices - ascending 1-based indices of the nodes in the MED file
+    */
+    virtual
+    void
+    GetNodeInfo(TNodeInfo& theInfo,
+                const TIntVector& theIndices,
+                TErr* theErr = NULL);
+
     //! Write the MEDWrapper MED Nodes representation into the MED file
     virtual
     void
@@ -501,6 +513,18 @@ namespace MED
     GetCellInfo(TCellInfo& theInfo,
                 TErr* theErr = NULL);
 
+    //! Read a MEDWrapper MED Cells representation of some cells only
+    /*!
+      Connectivity, families and numbers of the cells are read using a MED filter.
+      \param theInfo - a representation created for theIndices.size() cells
+      \param theIndices - ascending 1-based indices of the cells in the MED file
+    */
+    virtual
+    void
+    GetCellInfo(TCellInfo& theInfo,
+                const TIntVector& theIndices,
+                TErr* theErr = NULL);
+
     //! Write the MEDWrapper MED Cells representation into the MED file
     virtual
     void
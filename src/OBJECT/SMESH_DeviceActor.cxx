@@ -44,6 +44,7 @@
 #include <vtkShrinkFilter.h>
 #include <vtkShrinkPolyData.h>
 #include <vtkTriangleFilter.h>
+#include <vtkQuadricClustering.h>
 
 #include <vtkProperty.h>
 #include <vtkPolyData.h>
@@ -112,6 +113,9 @@ SMESH_DeviceActor
   myGeomFilter = VTKViewer_GeometryFilter::New();
   myTriangleFilter = vtkTriangleFilter::New();
 
+  myLODFilter = 0; // created by SetUseLOD()
+  myLODMapper = 0;
+
   myTransformFilter = VTKViewer_TransformFilter::New();
 
   for(int i = 0; i < 6; i++)
@@ -157,6 +161,13 @@ SMESH_DeviceActor
   myGeomFilter->Delete();
   myTriangleFilter->Delete();
 
+  if ( myLODMapper )
+  {
+    myLODMapper->RemoveAllInputs();
+    myLODMapper->Delete();
+    myLODFilter->Delete();
+  }
+
   myTransformFilter->Delete();
 
   for(size_t i = 0, iEnd = myPassFilter.size(); i < iEnd; i++)
@@ -197,6 +208,28 @@ SMESH_DeviceActor
 }
 
 
+void
+SMESH_DeviceActor
+::SetUseLOD()
+{
+  if ( myLODMapper )
+    return;
+
+  // Level of detail: vtkLODActor draws myLODMapper instead of myMapper if the latter
+  // takes longer than the allocated render time, which is the case for huge meshes
+  // during interaction only. Picking is always done on myMapper, so IDs are not affected.
+  myLODFilter = vtkQuadricClustering::New();
+  myLODFilter->SetNumberOfDivisions( 128, 128, 128 );
+  myLODFilter->AutoAdjustNumberOfDivisionsOn();
+  myLODFilter->CopyCellDataOn();
+  myLODFilter->SetInputConnection( myPassFilter.back()->GetOutputPort() );
+
+  myLODMapper = vtkPolyDataMapper::New();
+  myLODMapper->SetInputConnection( myLODFilter->GetOutputPort() );
+  vtkLODActor::AddLODMapper( myLODMapper );
+}
+
+
 void 
 SMESH_DeviceActor
 ::Init(TVisualObjPtr theVisualObj, 
@@ -263,6 +296,8 @@ SMESH_DeviceActor
 
     anId++; // 5
     myMapper->SetInputConnection( myPassFilter[ anId ]->GetOutputPort() );
+    if ( myLODFilter )
+      myLODFilter->SetInputConnection( myPassFilter[ anId ]->GetOutputPort() );
     if( myPlaneCollection->GetNumberOfItems() )
       myMapper->SetClippingPlanes( myPlaneCollection );
 
@@ -1026,6 +1061,13 @@ SMESH_DeviceActor
     aUnits *= (1.0-EPS);
   }
   vtkMapper::SetResolveCoincidentTopologyPolygonOffsetParameters(aFactor,aUnits);
+
+  // let the decimated surface be colored and clipped as the full one
+  if ( myLODMapper && myLODMapper->GetMTime() < myMapper->GetMTime() )
+  {
+    myLODMapper->ShallowCopy( myMapper );
+    myLODMapper->SetInputConnection( myLODFilter->GetOutputPort() );
+  }
   vtkLODActor::Render(ren,m);
 
   vtkMapper::SetResolveCoincidentTopologyPolygonOffsetParameters(aStoredFactor,aStoredUnit);
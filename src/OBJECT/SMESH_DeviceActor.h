@@ -47,6 +47,7 @@ class vtkImplicitBoolean;
 class vtkPassThrough;
 class vtkPlaneCollection;
 class vtkTriangleFilter;
+class vtkQuadricClustering;
 
 class VTKViewer_Transform;
 class VTKViewer_TransformFilter;
@@ -69,6 +70,9 @@ class SMESHOBJECT_EXPORT SMESH_DeviceActor: public vtkLODActor{
   void SetStoreGemetryMapping(bool theStoreMapping);
   void SetStoreIDMapping(bool theStoreMapping);
 
+  //! Draw a decimated surface while rendering of a huge mesh is too slow (main surface actors only)
+  void SetUseLOD();
+
   virtual vtkIdType GetNodeObjId(vtkIdType theVtkID);
   virtual double* GetNodeCoord(vtkIdType theObjID);
   virtual vtkIdType GetNodeVtkId(vtkIdType theObjID);
@@ -184,6 +188,10 @@ class SMESHOBJECT_EXPORT SMESH_DeviceActor: public vtkLODActor{
   bool myStoreClippingMapping;
   VTKViewer_GeometryFilter *myGeomFilter;
   vtkTriangleFilter* myTriangleFilter = nullptr;
+  // decimated surface drawn instead of the full one while the full one is too slow
+  // to render in the time allocated by the view (e.g. during rotation); see SetUseLOD()
+  vtkQuadricClustering* myLODFilter;
+  vtkPolyDataMapper* myLODMapper;
   VTKViewer_TransformFilter *myTransformFilter;
   std::vector<vtkPassThrough*> myPassFilter;
 
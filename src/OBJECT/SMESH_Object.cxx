@@ -224,17 +224,7 @@ void SMESH_VisualObjDef::buildPrs(bool buildGrid)
   else
   {
     myLocalGrid = false;
-    if (!GetMesh()->IsCompacted())
-    {
-      NulData(); // detach from the SMDS grid to allow immediate memory de-allocation in compactMesh()
-      MESSAGE("*** buildPrs ==> compactMesh!");
-      GetMesh()->CompactMesh();
-      if ( SMESHDS_Mesh* m = dynamic_cast<SMESHDS_Mesh*>( GetMesh() )) // IPAL53915
-        m->GetScript()->SetModified(false); // drop IsModified set in compactMesh()
-    }
-    vtkUnstructuredGrid *theGrid = GetMesh()->GetGrid();
-    updateEntitiesFlags();
-    myGrid->ShallowCopy(theGrid);
+    shareMeshGrid();
     //MESSAGE(myGrid->GetReferenceCount());
     //MESSAGE( "Update - myGrid->GetNumberOfCells() = "<<myGrid->GetNumberOfCells() );
     //MESSAGE( "Update - myGrid->GetNumberOfPoints() = "<<myGrid->GetNumberOfPoints() );
@@ -244,6 +234,28 @@ void SMESH_VisualObjDef::buildPrs(bool buildGrid)
   }
 }
 
+//=================================================================================
+// function : shareMeshGrid
+// purpose  : make myGrid share the grid of the mesh. The mesh is compacted only if
+//            its grid contains removed cells or nodes, else added cells and moved
+//            nodes are already in the grid and a costly re-build of it is avoided
+//=================================================================================
+void SMESH_VisualObjDef::shareMeshGrid()
+{
+  if ( GetMesh()->HasGridHoles() )
+  {
+    NulData(); // detach from the SMDS grid to allow immediate memory de-allocation in CompactMesh()
+    MESSAGE("*** shareMeshGrid ==> compactMesh!");
+    GetMesh()->Modified(); // CompactMesh() does nothing if IsCompacted()
+    GetMesh()->CompactMesh();
+    if ( SMESHDS_Mesh* m = dynamic_cast<SMESHDS_Mesh*>( GetMesh() )) // IPAL53915
+      m->GetScript()->SetModified(false); // drop IsModified set in CompactMesh()
+  }
+  updateEntitiesFlags();
+  myGrid->ShallowCopy( GetMesh()->GetGrid() );
+  myGrid->Modified();
+}
+
 //=================================================================================
 // function : buildNodePrs
 // purpose  : create VTK cells for nodes
@@ -511,16 +523,10 @@ bool SMESH_VisualObjDef::GetEdgeNodes( const smIdType theElemId,
 
 vtkUnstructuredGrid* SMESH_VisualObjDef::GetUnstructuredGrid()
 {
-  if ( !myLocalGrid && ( !GetMesh()->IsCompacted() || // !IsCompacted() is needed ???
+  if ( !myLocalGrid && ( GetMesh()->HasGridHoles() ||
                          GetMesh()->GetGrid()->GetMTime() > myGrid->GetMTime() ))
   {
-    NulData(); // detach from the SMDS grid to allow immediate memory de-allocation in CompactMesh()
-    GetMesh()->CompactMesh();
-    if ( SMESHDS_Mesh* m = dynamic_cast<SMESHDS_Mesh*>( GetMesh() )) // IPAL53915
-      m->GetScript()->SetModified(false); // drop IsModified set in CompactMesh()
-    updateEntitiesFlags();
-    vtkUnstructuredGrid *theGrid = GetMesh()->GetGrid();
-    myGrid->ShallowCopy(theGrid);
+    shareMeshGrid();
   }
   return myGrid;
 }
@@ -620,6 +626,7 @@ SMESH_MeshObj::SMESH_MeshObj(SMESH::SMESH_Mesh_ptr theMesh):
   myClient(SalomeApp_Application::orb(),theMesh)
 {
         myEmptyGrid = 0;
+        myModifCounter = 0;
 
   MESSAGE("SMESH_MeshObj - this = "<<this<<"; theMesh->_is_nil() = "<<theMesh->_is_nil());
 }
@@ -646,6 +653,7 @@ bool SMESH_MeshObj::Update( int theIsClear )
   if ( myClient.Update(theIsClear) || GetUnstructuredGrid()->GetNumberOfPoints()==0) {
     MESSAGE("buildPrs");
     buildPrs();  // Fill unstructured grid
+    ++myModifCounter;
     return true;
   }
   return false;
@@ -815,6 +823,7 @@ SMESH_SubMeshObj::SMESH_SubMeshObj( SMESH_MeshObj* theMeshObj )
   MESSAGE( "SMESH_SubMeshObj - theMeshObj = " << theMeshObj );
   
   myMeshObj = theMeshObj;
+  myMeshModifCounter = -1;
 }
 
 SMESH_SubMeshObj::~SMESH_SubMeshObj()
@@ -848,7 +857,15 @@ bool SMESH_SubMeshObj::Update( int theIsClear )
 {
   MESSAGE("SMESH_SubMeshObj::Update " << this);
   bool changed = myMeshObj->Update( theIsClear );
-  buildPrs(true);
+
+  // re-build the local grid only if the mesh or contents of the sub-object change
+  bool toBuild = isContentsModified(); // call it anyway to store the current contents
+  toBuild = ( toBuild || !myLocalGrid || myMeshModifCounter != myMeshObj->GetModifCounter() );
+  if ( toBuild )
+  {
+    myMeshModifCounter = myMeshObj->GetModifCounter();
+    buildPrs(true);
+  }
   return changed;
 }
 
@@ -865,7 +882,8 @@ bool SMESH_SubMeshObj::Update( int theIsClear )
 SMESH_GroupObj::SMESH_GroupObj( SMESH::SMESH_GroupBase_ptr theGroup, 
                                 SMESH_MeshObj*             theMeshObj )
 : SMESH_SubMeshObj( theMeshObj ),
-  myGroupServer( SMESH::SMESH_GroupBase::_duplicate(theGroup) )
+  myGroupServer( SMESH::SMESH_GroupBase::_duplicate(theGroup) ),
+  myGroupTic( -1 )
 {
   MESSAGE("SMESH_GroupObj - theGroup->_is_nil() = "<<theGroup->_is_nil());
   myGroupServer->Register();
@@ -962,6 +980,29 @@ smIdType SMESH_GroupObj::GetNbEntities( const SMDSAbs_ElementType theType) const
   return 0;
 }
 
+//=================================================================================
+// function : isContentsModified
+// purpose  : Return true if IDs of group elements changed since the previous call
+//=================================================================================
+bool SMESH_GroupObj::isContentsModified()
+{
+  // the tic is cheap to get contrary to IDs of a big group
+  CORBA::Long aTic = myGroupServer->GetTic();
+  if ( aTic >= 0 && aTic == myGroupTic )
+    return false;
+  myGroupTic = aTic;
+
+  SMESH::smIdType_array_var anIds = myGroupServer->GetListOfID();
+  bool isModified = ( anIds->length() != myIDs.size() );
+  for ( CORBA::ULong i = 0; i < anIds->length() && !isModified; ++i )
+    isModified = ( anIds[ i ] != myIDs[ i ]);
+
+  if ( isModified )
+    myIDs.assign( anIds->get_buffer(), anIds->get_buffer() + anIds->length() );
+
+  return isModified;
+}
+
 smIdType SMESH_GroupObj::GetEntities( const SMDSAbs_ElementType theType, TEntityList& theResList ) const
 {
   theResList.clear();
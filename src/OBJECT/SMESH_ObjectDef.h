@@ -40,6 +40,7 @@
 
 #include <map>
 #include <list>
+#include <vector>
 
 class vtkPoints;
 class SALOME_ExtractUnstructuredGrid;
@@ -93,6 +94,7 @@ protected:
 
   void                      createPoints( vtkPoints* );
   void                      buildPrs(bool buildGrid = false);
+  void                      shareMeshGrid();
   void                      buildNodePrs();
   void                      buildElemPrs();
   void                      updateEntitiesFlags();
@@ -138,10 +140,14 @@ public:
   virtual SMESH::SMESH_Mesh_ptr GetMeshServer() { return myClient.GetMeshServer(); }
   virtual SMDS_Mesh*        GetMesh() const { return myClient.GetMesh(); }
 
+  // Return number of times the presentation was updated due to mesh modification
+  int                       GetModifCounter() const { return myModifCounter; }
+
 protected:
 
   SMESH_Client              myClient;
   vtkUnstructuredGrid*      myEmptyGrid;
+  int                       myModifCounter;
 };
 
 
@@ -166,7 +172,11 @@ public:
   
 protected:
 
+  // Return true if the sub-object contents changed while the mesh did not
+  virtual bool              isContentsModified() { return false; }
+
   SMESH_MeshObj*            myMeshObj;
+  int                       myMeshModifCounter; // value of myMeshObj->GetModifCounter()
 };
 
 
@@ -187,9 +197,15 @@ public:
 
   virtual SMDSAbs_ElementType GetElementType() const;
 
+protected:
+
+  virtual bool              isContentsModified();
+
 private:
 
   SMESH::SMESH_GroupBase_var    myGroupServer;
+  std::vector< smIdType >       myIDs; // IDs of elements the presentation is built of
+  CORBA::Long                   myGroupTic; // GetTic() of the group when myIDs were got
 };
 
 
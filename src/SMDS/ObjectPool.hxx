@@ -20,8 +20,10 @@
 #ifndef _OBJECTPOOL_HXX_
 #define _OBJECTPOOL_HXX_
 
+#include <algorithm>
+#include <cstdint>
+#include <utility>
 #include <vector>
-#include <iostream>
 
 #include "SMDS_Iterator.hxx"
 
@@ -36,61 +38,153 @@ namespace
 
 template<class X> class ObjectPoolIterator;
 
+//================================================================================
+/*!
+ * \brief Allocator of objects by chunks.
+ *
+ * Free slots are indexed by a hierarchy of bit masks: a bit of level 0 is set if
+ * a slot is free, a bit of level N is set if a word of level N-1 has a set bit.
+ * So the first free slot is found and a slot is freed in a constant time (the
+ * number of levels is log64 of the number of slots). A chunk owning a destroyed
+ * object is found by a binary search of its address. Chunks with no used objects
+ * are released, one empty chunk is kept to avoid re-allocation on add/remove cycles.
+ */
+//================================================================================
+
 template<class X> class ObjectPool
 {
 
 private:
-  std::vector<X*>   _chunkList;
-  std::vector<bool> _freeList;
-  int               _nextFree;    // either the 1st hole or last added
+  typedef uint64_t TWord;
+  enum { theWordBits = 64, theWordShift = 6 };
+
+  std::vector<X*>                   _chunkList;     // NULL for a released chunk
+  std::vector<int>                  _nbUsedInChunk;
+  std::vector< std::pair<X*,int> >  _chunkOfAddress; // sorted by address
+  std::vector< std::vector<TWord> > _freeBits;      // hierarchy of free slot masks
   int               _maxAvail;    // nb allocated elements
   int               _chunkSize;
   int               _maxOccupied; // max used ID
-  int               _nbHoles;
+  int               _nbUsed;      // nb used elements
   int               _lastDelChunk;
+  int               _emptyChunk;  // a chunk kept allocated while empty
 
   friend class ObjectPoolIterator<X>;
 
-  int getNextFree()
-  {
-    // Don't iterate on the _freeList if all the "holes"
-    // are filled. Go straight to the last occupied ID + 1
-    if ( _nbHoles == 0 )
-      return std::min(_maxOccupied + 1, _maxAvail);
-    
-    for (int i = _nextFree; i < _maxAvail; i++)
-      if (_freeList[i] == true)
-        {
-          return i;
-          break;
-        }
-    return _maxAvail;
+  static int lowestBit( TWord w ) // w != 0
+  {
+#if defined(__GNUC__)
+    return __builtin_ctzll( w );
+#else
+    int i = 0;
+    for ( ; ( w & 0xFFFF ) == 0; w >>= 16 ) i += 16;
+    for ( ; ( w & 1      ) == 0; w >>= 1  ) ++i;
+    return i;
+#endif
+  }
+
+  bool isFree( int i ) const
+  {
+    return ( _freeBits[0][ i >> theWordShift ] >> ( i & ( theWordBits - 1 ))) & 1;
+  }
+
+  void setFree( int i )
+  {
+    for ( size_t level = 0; level < _freeBits.size(); ++level )
+    {
+      TWord& w = _freeBits[ level ][ i >> theWordShift ];
+      const bool hadFree = ( w != 0 );
+      w |= TWord(1) << ( i & ( theWordBits - 1 ));
+      if ( hadFree )
+        break;
+      i >>= theWordShift;
+    }
+  }
+
+  void setUsed( int i )
+  {
+    for ( size_t level = 0; level < _freeBits.size(); ++level )
+    {
+      TWord& w = _freeBits[ level ][ i >> theWordShift ];
+      w &= ~( TWord(1) << ( i & ( theWordBits - 1 )));
+      if ( w != 0 )
+        break;
+      i >>= theWordShift;
+    }
+  }
+
+  int getNextFree() const
+  {
+    if ( _freeBits.empty() || _freeBits.back()[0] == 0 )
+      return _maxAvail;
+    int i = 0;
+    for ( size_t level = _freeBits.size(); level-- > 0; )
+      i = ( i << theWordShift ) + lowestBit( _freeBits[ level ][ i ]);
+    return i;
+  }
+
+  // add free slots of a new chunk
+  void addChunk()
+  {
+    const int nbSlots = _maxAvail + _chunkSize;
+    size_t    nbWords = ( nbSlots + theWordBits - 1 ) >> theWordShift;
+    for ( size_t level = 0; ; ++level )
+    {
+      if ( level == _freeBits.size() )
+        _freeBits.push_back( std::vector<TWord>() );
+      _freeBits[ level ].resize( nbWords, 0 );
+      if ( nbWords == 1 )
+        break;
+      nbWords = ( nbWords + theWordBits - 1 ) >> theWordShift;
+    }
+    _chunkList.push_back( 0 );
+    _nbUsedInChunk.push_back( 0 );
+    for ( int i = _maxAvail; i < nbSlots; ++i )
+      setFree( i );
+    _maxAvail = nbSlots;
+  }
+
+  void allocateChunk( int chunkId )
+  {
+    X* chunk = new X[_chunkSize];
+    _chunkList[ chunkId ] = chunk;
+    std::pair<X*,int> chunk2id( chunk, chunkId );
+    _chunkOfAddress.insert( std::upper_bound( _chunkOfAddress.begin(),
+                                              _chunkOfAddress.end(), chunk2id ), chunk2id );
   }
 
-  void checkDelete(int chunkId)
+  void releaseChunk( int chunkId )
   {
-    int i0 = _chunkSize * chunkId;
-    int i1 = _chunkSize * (chunkId + 1);
-    for (int i = i0; i < i1; i++)
-      if (_freeList[i] == false)
-        return;
-    std::cerr << "a chunk to delete" << std::endl;
-    // compactage des vecteurs un peu lourd, pas necessaire
-    //X* chunk = _chunkList[chunkId];
-    //delete [] chunk;
+    X* chunk = _chunkList[ chunkId ];
+    typename std::vector< std::pair<X*,int> >::iterator c2id =
+      std::lower_bound( _chunkOfAddress.begin(), _chunkOfAddress.end(),
+                        std::make_pair( chunk, chunkId ));
+    _chunkOfAddress.erase( c2id );
+    delete [] chunk;
+    _chunkList[ chunkId ] = 0;
+  }
+
+  int chunkOf( const X* obj ) const
+  {
+    const X* chunk = _chunkList[ _lastDelChunk ];
+    if ( chunk && obj >= chunk && obj < chunk + _chunkSize )
+      return _lastDelChunk;
+
+    typename std::vector< std::pair<X*,int> >::const_iterator c2id =
+      std::upper_bound( _chunkOfAddress.begin(), _chunkOfAddress.end(),
+                        std::make_pair( const_cast<X*>( obj ), _maxAvail ));
+    return ( --c2id )->second;
   }
 
 public:
   ObjectPool(int nblk = 1024)
   {
     _chunkSize    = nblk;
-    _nextFree     = 0;
     _maxAvail     = 0;
     _maxOccupied  = -1;
-    _nbHoles      = 0;
+    _nbUsed       = 0;
     _lastDelChunk = 0;
-    _chunkList.clear();
-    _freeList.clear();
+    _emptyChunk   = -1;
   }
 
   virtual ~ObjectPool()
@@ -101,86 +195,73 @@ public:
 
   X* getNew()
   {
-    X *obj = 0;
-    _nextFree = getNextFree();
-    if (_nextFree == _maxAvail)
-      {
-        X* newChunk = new X[_chunkSize];
-        _chunkList.push_back(newChunk);
-        _freeList.insert(_freeList.end(), _chunkSize, true);
-        _maxAvail += _chunkSize;
-        _freeList[_nextFree] = false;
-        obj = newChunk;
-      }
-    else
-      {
-        int chunkId = _nextFree / _chunkSize;
-        int rank = _nextFree - chunkId * _chunkSize;
-        _freeList[_nextFree] = false;
-        obj = _chunkList[chunkId] + rank;
-      }
-    if (_nextFree <= _maxOccupied)
-      {
-        _nbHoles-=1;
-      }
-    else
-      {
-        _maxOccupied = _nextFree;
-      }
-    return obj;
+    int iFree = getNextFree();
+    if ( iFree == _maxAvail )
+      addChunk();
+
+    int chunkId = iFree / _chunkSize;
+    int rank    = iFree - chunkId * _chunkSize;
+    if ( !_chunkList[ chunkId ])
+      allocateChunk( chunkId );
+
+    setUsed( iFree );
+    ++_nbUsedInChunk[ chunkId ];
+    ++_nbUsed;
+    if ( iFree > _maxOccupied )
+      _maxOccupied = iFree;
+
+    return _chunkList[ chunkId ] + rank;
   }
 
   void destroy(X* obj)
   {
-    size_t i = 0;
-    if ( obj >= _chunkList[ _lastDelChunk ] &&
-         obj <  _chunkList[ _lastDelChunk ] + _chunkSize )
-      i = _lastDelChunk;
-    else
-      for ( ; i < _chunkList.size(); i++ )
-      {
-        if ( obj >= _chunkList[ i ] &&
-             obj <  _chunkList[ i ] + _chunkSize )
-          break;
-      }
-    X*    chunk = _chunkList[i];
-    long adrobj = (long) (obj);
-    long adrmin = (long) (chunk);
-    int  rank   = (adrobj - adrmin) / sizeof(X);
-    int  toFree = i * _chunkSize + rank;
-    _freeList[toFree] = true;
-    if (toFree < _nextFree)
-      _nextFree = toFree;
-    if (toFree < _maxOccupied)
-      ++_nbHoles;
-    else
+    int chunkId = chunkOf( obj );
+    int rank    = int( obj - _chunkList[ chunkId ]);
+    int toFree  = chunkId * _chunkSize + rank;
+    if ( isFree( toFree ))
+      return;
+
+    setFree( toFree );
+    --_nbUsed;
+    if ( toFree == _maxOccupied )
       --_maxOccupied;
-    _lastDelChunk = i;
+    _lastDelChunk = chunkId;
+
+    if ( --_nbUsedInChunk[ chunkId ] == 0 )
+    {
+      // release a previous empty chunk and keep this one
+      if ( _emptyChunk >= 0 && _emptyChunk != chunkId &&
+           _chunkList[ _emptyChunk ] && _nbUsedInChunk[ _emptyChunk ] == 0 )
+        releaseChunk( _emptyChunk );
+      _emptyChunk = chunkId;
+    }
   }
 
   void clear()
   {
-    _nextFree = 0;
-    _maxAvail = 0;
-    _maxOccupied = 0;
-    _nbHoles = 0;
+    _maxAvail     = 0;
+    _maxOccupied  = -1;
+    _nbUsed       = 0;
     _lastDelChunk = 0;
+    _emptyChunk   = -1;
     for (size_t i = 0; i < _chunkList.size(); i++)
       delete[] _chunkList[i];
     clearVector( _chunkList );
-    clearVector( _freeList );
+    clearVector( _nbUsedInChunk );
+    clearVector( _chunkOfAddress );
+    clearVector( _freeBits );
   }
 
   // nb allocated elements
   size_t size() const
   {
-    return _freeList.size();
+    return _maxAvail;
   }
 
   // nb used elements
   size_t nbElements() const
   {
-    return _maxOccupied + 1 - _nbHoles;
+    return _nbUsed;
   }
 
   // return an element w/o any check
@@ -194,22 +275,13 @@ public:
   // return only being used element
   const X* at( size_t i ) const // i < size()
   {
-    if ( i >= size() || _freeList[ i ] )
+    if ( i >= size() || isFree( i ))
       return 0;
 
     int chunkId = i / _chunkSize;
     int    rank = i - chunkId * _chunkSize;
     return _chunkList[ chunkId ] + rank;
   }
-
-  //  void destroy(int toFree)
-  //  {
-  //    // no control 0<= toFree < _freeList.size()
-  //    _freeList[toFree] = true;
-  //    if (toFree < _nextFree)
-  //      _nextFree = toFree;
-  //  }
-
 };
 
 template<class X> class ObjectPoolIterator : public SMDS_Iterator<const X*>
@@ -220,7 +292,7 @@ public:
 
   ObjectPoolIterator( const ObjectPool<X>& pool ) : _pool( pool ), _i( 0 ), _nbFound( 0 )
   {
-    if ( more() && _pool._freeList[ _i ] == true )
+    if ( more() && _pool.isFree( _i ))
     {
       next();
       --_nbFound;
@@ -242,7 +314,7 @@ public:
       ++_nbFound;
 
       for ( ++_i; _i <= _pool._maxOccupied; ++_i )
-        if ( _pool._freeList[ _i ] == false )
+        if ( !_pool.isFree( _i ))
           break;
     }
     return x;
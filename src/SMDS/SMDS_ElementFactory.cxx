@@ -111,14 +111,41 @@ int SMDS_ElementFactory::ChunkSize()
 smIdType SMDS_ElementFactory::GetFreeID()
 {
   if ( myChunksWithUnused.empty() )
-  {
-    smIdType id0 = myChunks.size() * theChunkSize + 1;
-    myChunks.push_back( new SMDS_ElementChunk( this, id0 ));
-  }
+    addChunk();
   SMDS_ElementChunk * chunk = (*myChunksWithUnused.begin());
   return chunk->GetUnusedID();
 }
 
+//================================================================================
+/*!
+ * \brief Allocate a new chunk of elements.
+ *  Raise std::bad_alloc if the mesh exceeds its memory budget
+ */
+//================================================================================
+
+void SMDS_ElementFactory::addChunk()
+{
+  if ( myMesh )
+    myMesh->CheckMemoryBudget();
+
+  smIdType id0 = myChunks.size() * theChunkSize + 1;
+  myChunks.push_back( new SMDS_ElementChunk( this, id0 ));
+}
+
+//================================================================================
+/*!
+ * \brief Return an estimate of memory in bytes allocated by this factory
+ */
+//================================================================================
+
+size_t SMDS_ElementFactory::GetMemoryUsage() const
+{
+  size_t elemSize = myIsNodal ? sizeof( SMDS_MeshNode ) + 2 * sizeof( TParam ) : sizeof( SMDS_MeshCell );
+  return ( myChunks.size() * theChunkSize * elemSize +
+           myVtkIDs.capacity()  * sizeof( vtkIdType ) +
+           mySmdsIDs.capacity() * sizeof( smIdType ));
+}
+
 //================================================================================
 /*!
  * \brief Return maximal ID of an used element
@@ -174,10 +201,7 @@ SMDS_MeshElement* SMDS_ElementFactory::NewElement( const smIdType id )
   smIdType iChunk = ( id - 1 ) / theChunkSize;
   smIdType index  = ( id - 1 ) % theChunkSize;
   while ((smIdType) myChunks.size() <= iChunk )
-  {
-    smIdType id0 = myChunks.size() * theChunkSize + 1;
-    myChunks.push_back( new SMDS_ElementChunk( this, id0 ));
-  }
+    addChunk();
   SMDS_MeshElement* e = myChunks[iChunk].Element( FromSmIdType<int>(index) );
   if ( !e->IsNull() )
     return 0; // element with given ID already exists
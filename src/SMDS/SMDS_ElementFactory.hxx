@@ -74,6 +74,9 @@ protected:
 
   friend class SMDS_ElementChunk;
 
+  //! Allocate a new chunk of elements if the mesh memory budget allows it
+  void addChunk();
+
 public:
 
   SMDS_ElementFactory( SMDS_Mesh* mesh, const bool isNodal=false );
@@ -100,6 +103,9 @@ public:
   //! Return a number of used elements
   smIdType NbUsedElements() const { return myNbUsedElements; }
 
+  //! Return an estimate of memory in bytes allocated by this factory
+  size_t GetMemoryUsage() const;
+
   //! Return an iterator on all element filtered using a given filter.
   //  nbElemsToReturn is used to optimize by stopping the iteration as soon as
   //  all elements satisfying filtering condition encountered.
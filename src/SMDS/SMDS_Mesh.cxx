@@ -39,21 +39,19 @@
 #include <vtkUnstructuredGrid.h>
 //#include <vtkUnstructuredGridWriter.h>
 #include <vtkCell.h>
+#include <vtkCellArray.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkCellLinks.h>
 #include <vtkIdList.h>
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <fstream>
 
 //#include <boost/make_shared.hpp>
 #include <boost/container/flat_set.hpp>
 
-#if !defined WIN32 && !defined __APPLE__
-#include <sys/sysinfo.h>
-#endif
-
 // number of added entities to check memory after
 #define CHECKMEMORY_INTERVAL 100000
 
@@ -61,61 +59,115 @@
 
 int SMDS_Mesh::chunkSize = 1024;
 
+namespace
+{
+  const size_t theMbyte = 1024 * 1024;
+
+  std::atomic< size_t > theGlobalMemoryBudget( 0 ); // MB
+  std::atomic< size_t > theTotalAccountedMemory( 0 ); // bytes used by all meshes
+}
+
 //================================================================================
 /*!
- * \brief Raise an exception if free memory (ram+swap) too low
+ * \brief Raise std::bad_alloc if all meshes use more memory than the global budget
  * \param doNotRaise - if true, suppress exception, just return free memory size
- * \retval int - amount of available memory in MB or negative number in failure case
+ * \retval int - amount of memory in MB left within the global budget or
+ *         negative number if no budget is set
  */
 //================================================================================
 
 int SMDS_Mesh::CheckMemory(const bool doNotRaise)
 {
-  return -1;
-#if !defined WIN32 && !defined __APPLE__
-  struct sysinfo si;
-  int err = sysinfo( &si );
-  if ( err )
+  const size_t budget = theGlobalMemoryBudget;
+  if ( budget == 0 )
     return -1;
 
-  const unsigned long Mbyte = 1024 * 1024;
-
-  static int limit = -1;
-  if ( limit < 0 ) {
-    if ( si.totalswap == 0 )
-    {
-      int status = system("SMDS_MemoryLimit"); // it returns lower limit of free RAM
-      if (status >= 0 ) {
-        limit = WEXITSTATUS(status);
-      }
-      else {
-        double factor = ( si.totalswap == 0 ) ? 0.1 : 0.2;
-        limit = int(( factor * si.totalram * si.mem_unit ) / Mbyte );
-      }
-    }
-    if ( limit < 20 )
-      limit = 20;
-    else
-      limit = int ( limit * 1.5 );
-    MESSAGE ( "SMDS_Mesh::CheckMemory() memory limit = " << limit << " MB" );
-  }
-
-  // compute separately to avoid overflow
-  int freeMb =
-    ( si.freeram  * si.mem_unit ) / Mbyte +
-    ( si.freeswap * si.mem_unit ) / Mbyte;
-
-  if ( freeMb > limit )
-    return freeMb - limit;
+  const size_t usedMb = theTotalAccountedMemory / theMbyte;
+  if ( usedMb < budget )
+    return int( budget - usedMb );
 
   if ( doNotRaise )
     return 0;
 
-  MESSAGE ("SMDS_Mesh::CheckMemory() throws as free memory too low: " << freeMb <<" MB" );
+  MESSAGE ("SMDS_Mesh::CheckMemory() throws as memory budget of " << budget <<
+           " MB is exceeded: " << usedMb << " MB" );
   throw std::bad_alloc();
-#else
-  return -1;
-#endif
+}
+
+//================================================================================
+/*!
+ * \brief Set a limit of memory in MB used by all meshes together; zero means no limit
+ */
+//================================================================================
+
+void SMDS_Mesh::SetGlobalMemoryBudget( size_t megabytes )
+{
+  theGlobalMemoryBudget = megabytes;
+}
+
+//================================================================================
+/*!
+ * \brief Return a limit of memory in MB used by all meshes together
+ */
+//================================================================================
+
+size_t SMDS_Mesh::GetGlobalMemoryBudget()
+{
+  return theGlobalMemoryBudget;
+}
+
+//================================================================================
+/*!
+ * \brief Return an estimate of memory in bytes allocated by this mesh:
+ *        elements allocated by factories and data of the VTK grid
+ */
+//================================================================================
+
+size_t SMDS_Mesh::GetMemoryUsage() const
+{
+  size_t usage = myNodeFactory->GetMemoryUsage() + myCellFactory->GetMemoryUsage();
+  if ( myGrid )
+    usage += size_t( myGrid->GetActualMemorySize() ) * 1024;
+  return usage;
+}
+
+//================================================================================
+/*!
+ * \brief Update memory usage of this mesh in the total usage of all meshes
+ */
+//================================================================================
+
+void SMDS_Mesh::UpdateAccountedMemory()
+{
+  const size_t usage = GetMemoryUsage();
+  theTotalAccountedMemory += usage;
+  theTotalAccountedMemory -= myAccountedMemory;
+  myAccountedMemory = usage;
+}
+
+//================================================================================
+/*!
+ * \brief Raise std::bad_alloc if this mesh or all meshes together exceed their
+ *        memory budget
+ */
+//================================================================================
+
+void SMDS_Mesh::CheckMemoryBudget()
+{
+  // account memory even if there is no budget, as it can be set later
+  UpdateAccountedMemory();
+
+  if ( myMemoryBudget == 0 && theGlobalMemoryBudget == 0 )
+    return;
+
+  const size_t usage = myAccountedMemory;
+  if ( myMemoryBudget > 0 && usage / theMbyte >= myMemoryBudget )
+  {
+    MESSAGE ("SMDS_Mesh::CheckMemoryBudget() throws as memory budget of " << myMemoryBudget <<
+             " MB is exceeded: " << usage / theMbyte << " MB" );
+    throw std::bad_alloc();
+  }
+  CheckMemory();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -125,7 +177,8 @@ SMDS_Mesh::SMDS_Mesh():
   myNodeFactory( new SMDS_NodeFactory( this )),
   myCellFactory( new SMDS_ElementFactory( this )),
   myParent(NULL),
-  myModified(false), myModifTime(0), myCompactTime(0),
+  myModified(false), myModifTime(0), myCompactTime(0), myNbModifications(0),
+  myMemoryBudget(0), myAccountedMemory(0),
   xmin(0), xmax(0), ymin(0), ymax(0), zmin(0), zmax(0)
 {
   myGrid = SMDS_UnstructuredGrid::New();
@@ -151,9 +204,13 @@ SMDS_Mesh::SMDS_Mesh():
 /// (2003-09-08) of SMESH
 ///////////////////////////////////////////////////////////////////////////////
 SMDS_Mesh::SMDS_Mesh(SMDS_Mesh * parent):
+  myGrid(NULL),
   myNodeFactory( new SMDS_NodeFactory( this )),
   myCellFactory( new SMDS_ElementFactory( this )),
-  myParent(parent)
+  myParent(parent),
+  myModified(false), myModifTime(0), myCompactTime(0), myNbModifications(0),
+  myMemoryBudget(0), myAccountedMemory(0),
+  xmin(0), xmax(0), ymin(0), ymax(0), zmin(0), zmax(0)
 {
 }
 
@@ -192,7 +249,7 @@ SMDS_MeshNode * SMDS_Mesh::AddNodeWithID( double x, double y, double z, smIdType
   {
     node->init( x, y, z );
     myInfo.myNbNodes++;
-    myModified = true;
+    setMyModified();
     this->adjustBoundingBox(x, y, z);
   }
   return node;
@@ -977,6 +1034,262 @@ SMDS_MeshFace* SMDS_Mesh::AddFaceFromVtkIds(const std::vector<vtkIdType>& vtkNod
   return f;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// Create nodes given by an array of coordinates.
+/// @param nbNodes  number of nodes to create
+/// @param coords   coordinates of nodes: [ x0,y0,z0, x1,y1,z1, ... ]
+/// @param nodeIDs  IDs of nodes to create; if NULL, free IDs are used
+/// @param newNodes optional vector filled with the created nodes
+/// @return number of created nodes. Creation stops at the first node whose ID is
+///         already used. If an exception is raised (e.g. std::bad_alloc when the memory
+///         budget is exceeded), nodes created before are counted and kept in newNodes
+///////////////////////////////////////////////////////////////////////////////
+
+smIdType SMDS_Mesh::AddNodesWithID( const smIdType                     nbNodes,
+                                    const double*                      coords,
+                                    const smIdType*                    nodeIDs,
+                                    std::vector<const SMDS_MeshNode*>* newNodes )
+{
+  if ( newNodes )
+  {
+    newNodes->clear();
+    newNodes->reserve( nbNodes );
+  }
+  if ( nbNodes < 1 )
+    return 0;
+
+  CheckMemory();
+
+  // allocate points at once; VTK ID of a new node is its ID - 1
+  smIdType maxID = myNodeFactory->GetMaxID() + nbNodes;
+  if ( nodeIDs )
+    maxID = *std::max_element( nodeIDs, nodeIDs + nbNodes );
+  vtkPoints* points = myGrid->GetPoints();
+  if ( points->GetData()->GetSize() < 3 * maxID )
+    points->Resize( FromSmIdType<vtkIdType>( maxID ));
+
+  smIdType iN = 0;
+  try
+  {
+    for ( ; iN < nbNodes; ++iN, coords += 3 )
+    {
+      smIdType         ID = nodeIDs ? nodeIDs[ iN ] : myNodeFactory->GetFreeID();
+      SMDS_MeshNode* node = myNodeFactory->NewNode( ID );
+      if ( !node )
+        break;
+      node->init( coords[0], coords[1], coords[2] );
+      this->adjustBoundingBox( coords[0], coords[1], coords[2] );
+      if ( newNodes )
+        newNodes->push_back( node );
+    }
+  }
+  catch ( ... )
+  {
+    // count nodes created before an exception, e.g. std::bad_alloc raised
+    // by CheckMemoryBudget() at allocation of a new chunk
+    myInfo.myNbNodes += iN;
+    setMyModified();
+    throw;
+  }
+  myInfo.myNbNodes += iN;
+  setMyModified();
+
+  return iN;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Create elements of one type given by an array of node IDs.
+/// @param type     type of elements to create
+/// @param nbElems  number of elements to create
+/// @param nodeIDs  IDs of nodes of all elements, in the order of Add...WithID() methods
+/// @param elemIDs  IDs of elements to create; if NULL, free IDs are used
+/// @param newElems optional vector filled with the created elements
+/// @return number of created elements. Creation stops at the first element which
+///         can't be created. If an exception is raised, elements created before are
+///         counted and kept in newElems
+///////////////////////////////////////////////////////////////////////////////
+
+smIdType SMDS_Mesh::AddElementsWithID( const SMDSAbs_EntityType              type,
+                                       const smIdType                        nbElems,
+                                       const smIdType*                       nodeIDs,
+                                       const smIdType*                       elemIDs,
+                                       std::vector<const SMDS_MeshElement*>* newElems )
+{
+  if ( newElems )
+  {
+    newElems->clear();
+    newElems->reserve( nbElems );
+  }
+  const int nbNodes = SMDS_MeshCell::NbNodes( type );
+  if ( nbElems < 1 || SMDS_MeshCell::IsPoly( type ) || nbNodes < 1 )
+    return 0;
+
+  CheckMemory();
+  reserveCells( nbElems, nbElems * nbNodes );
+
+  std::vector< vtkIdType > vtkIds;
+  smIdType iE = 0;
+  try
+  {
+    for ( ; iE < nbElems; ++iE, nodeIDs += nbNodes )
+    {
+      smIdType          ID = elemIDs ? elemIDs[ iE ] : myCellFactory->GetFreeID();
+      SMDS_MeshCell* cell = addCellWithID( type, nodeIDs, nbNodes, ID, vtkIds );
+      if ( !cell )
+        break;
+      if ( newElems )
+        newElems->push_back( cell );
+    }
+  }
+  catch ( ... )
+  {
+    // count elements created before an exception
+    myInfo.setNb( type, myInfo.NbEntities( type ) + iE );
+    throw;
+  }
+  myInfo.setNb( type, myInfo.NbEntities( type ) + iE );
+
+  return iE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Create elements of any types given by an array of node IDs.
+/// @param nbElems  number of elements to create
+/// @param types    types of elements
+/// @param offsets  index in nodeIDs of the first node of each element and
+///                 the total number of nodes at offsets[ nbElems ]
+/// @param nodeIDs  IDs of nodes of all elements, in the order of Add...WithID() methods
+/// @param elemIDs  IDs of elements to create; if NULL, free IDs are used
+/// @param newElems optional vector filled with the created elements
+/// @return number of created elements. Creation stops at the first element which
+///         can't be created. If an exception is raised, elements created before are
+///         counted and kept in newElems
+///////////////////////////////////////////////////////////////////////////////
+
+smIdType SMDS_Mesh::AddElementsWithID( const smIdType                        nbElems,
+                                       const SMDSAbs_EntityType*             types,
+                                       const smIdType*                       offsets,
+                                       const smIdType*                       nodeIDs,
+                                       const smIdType*                       elemIDs,
+                                       std::vector<const SMDS_MeshElement*>* newElems )
+{
+  if ( newElems )
+  {
+    newElems->clear();
+    newElems->reserve( nbElems );
+  }
+  if ( nbElems < 1 )
+    return 0;
+
+  CheckMemory();
+  reserveCells( nbElems, offsets[ nbElems ] - offsets[ 0 ]);
+
+  std::vector< smIdType > nbAdded( SMDSEntity_Last, 0 );
+  std::vector< vtkIdType > vtkIds;
+  auto countAdded = [&]()
+  {
+    for ( int iT = 0; iT < SMDSEntity_Last; ++iT )
+      if ( nbAdded[ iT ] > 0 )
+      {
+        SMDSAbs_EntityType type = (SMDSAbs_EntityType) iT;
+        myInfo.setNb( type, myInfo.NbEntities( type ) + nbAdded[ iT ]);
+      }
+  };
+  smIdType iE = 0;
+  try
+  {
+    for ( ; iE < nbElems; ++iE )
+    {
+      smIdType          ID = elemIDs ? elemIDs[ iE ] : myCellFactory->GetFreeID();
+      const int    nbNodes = FromSmIdType<int>( offsets[ iE + 1 ] - offsets[ iE ]);
+      SMDS_MeshCell* cell = addCellWithID( types[ iE ], nodeIDs + offsets[ iE ], nbNodes, ID, vtkIds );
+      if ( !cell )
+        break;
+      ++nbAdded[ types[ iE ]];
+      if ( newElems )
+        newElems->push_back( cell );
+    }
+  }
+  catch ( ... )
+  {
+    // count elements created before an exception
+    countAdded();
+    throw;
+  }
+  countAdded();
+
+  return iE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Enlarge capacity of VTK arrays to add a given number of cells.
+/// Number of cells in the grid does not change
+///////////////////////////////////////////////////////////////////////////////
+
+void SMDS_Mesh::reserveCells( smIdType nbCells, smIdType nbCellNodes )
+{
+  vtkCellArray* cells = myGrid->GetCells();
+  if ( !cells )
+    return;
+  // Resize() of a data array keeps its values and only enlarges the storage,
+  // contrary to vtkCellArray::ResizeExact() which sets the number of cells
+  vtkIdType nbNewCells = myGrid->GetNumberOfCells() + FromSmIdType<vtkIdType>( nbCells );
+  vtkIdType nbNewIds   = cells->GetNumberOfConnectivityIds() + FromSmIdType<vtkIdType>( nbCellNodes );
+  if ( cells->GetOffsetsArray()->GetSize() <= nbNewCells )
+    cells->GetOffsetsArray()->Resize( nbNewCells + 1 );
+  if ( cells->GetConnectivityArray()->GetSize() < nbNewIds )
+    cells->GetConnectivityArray()->Resize( nbNewIds );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Create a cell of any type except polyhedron and ball
+/// @param vtkIds a buffer for VTK IDs of nodes
+/// @return the created cell or NULL if the ID is used, nodes are missing or
+///         nbNodes does not correspond to type
+///////////////////////////////////////////////////////////////////////////////
+
+SMDS_MeshCell* SMDS_Mesh::addCellWithID( const SMDSAbs_EntityType type,
+                                         const smIdType*          nodeIDs,
+                                         const int                nbNodes,
+                                         const smIdType           ID,
+                                         std::vector<vtkIdType>&  vtkIds )
+{
+  switch ( type )
+  {
+  case SMDSEntity_Node:
+  case SMDSEntity_Ball:
+  case SMDSEntity_Polyhedra:
+  case SMDSEntity_Quad_Polyhedra:
+  case SMDSEntity_Last:
+    return 0;
+  case SMDSEntity_Polygon:
+    if ( nbNodes < 3 ) return 0;
+    break;
+  case SMDSEntity_Quad_Polygon:
+    if ( nbNodes < 6 || nbNodes % 2 ) return 0;
+    break;
+  default:
+    if ( nbNodes != SMDS_MeshCell::NbNodes( type )) return 0;
+  }
+
+  const std::vector<int>& interlace = SMDS_MeshCell::toVtkOrder( type );
+  const bool toInterlace = ((int) interlace.size() == nbNodes && !SMDS_MeshCell::IsPoly( type ));
+
+  vtkIds.resize( nbNodes );
+  for ( int i = 0; i < nbNodes; ++i )
+  {
+    const SMDS_MeshNode* node = myNodeFactory->FindNode( nodeIDs[ toInterlace ? interlace[i] : i ]);
+    if ( !node )
+      return 0;
+    vtkIds[i] = node->GetVtkID();
+  }
+
+  SMDS_MeshCell* cell = myCellFactory->NewCell( ID );
+  if ( cell )
+    cell->init( type, vtkIds );
+  return cell;
+}
+
 //=======================================================================
 //function : MoveNode
 //purpose  : 
@@ -1568,7 +1881,10 @@ SMDS_Mesh::~SMDS_Mesh()
   delete myNodeFactory;
   delete myCellFactory;
 
-  myGrid->Delete();
+  if ( myGrid )
+    myGrid->Delete();
+
+  theTotalAccountedMemory -= myAccountedMemory;
 }
 
 //================================================================================
@@ -1592,6 +1908,7 @@ void SMDS_Mesh::Clear()
 
   myModified = false;
   myModifTime++;
+  myNbModifications++;
   xmin = 0; xmax = 0;
   ymin = 0; ymax = 0;
   zmin = 0; zmax = 0;
@@ -1608,6 +1925,8 @@ void SMDS_Mesh::Clear()
   myGrid->SetPoints( points );
   points->Delete();
   myGrid->DeleteLinks();
+
+  UpdateAccountedMemory();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3036,7 +3355,7 @@ void SMDS_Mesh::CompactMesh()
     else
       (*holder)->compact();
 
-  return;
+  UpdateAccountedMemory();
 }
 
 smIdType SMDS_Mesh::FromVtkToSmds( vtkIdType vtkid ) const
@@ -3082,6 +3401,14 @@ bool SMDS_Mesh::HasNumerationHoles()
            myCellFactory->CompactChangePointers() );
 }
 
+//! are there points of removed nodes or cells of removed elements in the VTK grid,
+//! i.e. CompactMesh() is needed to visualize the grid
+bool SMDS_Mesh::HasGridHoles()
+{
+  return ( myGrid->GetNumberOfPoints() != myNodeFactory->NbUsedElements() ||
+           myGrid->GetNumberOfCells()  != myCellFactory->NbUsedElements() );
+}
+
 void SMDS_Mesh::setNbShapes( size_t nbShapes )
 {
   myNodeFactory->SetNbShapes( nbShapes );
@@ -591,6 +591,35 @@ public:
 
   virtual SMDS_MeshFace* AddFaceFromVtkIds(const std::vector<vtkIdType>& vtkNodeIds);
 
+  // Bulk creation of nodes and elements given by flat arrays.
+  // Creation stops at the first node or element that can't be created (its ID is
+  // already used or its nodes are not found); the number of created ones is returned.
+  // If IDs are not given, free IDs are used.
+
+  //! Create nodes; coords = [ x0,y0,z0, x1,y1,z1, ... ]
+  virtual smIdType AddNodesWithID( const smIdType                      nbNodes,
+                                   const double*                       coords,
+                                   const smIdType*                     nodeIDs = 0,
+                                   std::vector<const SMDS_MeshNode*>*  newNodes = 0 );
+
+  //! Create elements of one type; nodeIDs = [ e0n0,e0n1,...,e1n0,e1n1,... ]
+  //! Polyhedra and balls are not supported
+  virtual smIdType AddElementsWithID( const SMDSAbs_EntityType              type,
+                                      const smIdType                        nbElems,
+                                      const smIdType*                       nodeIDs,
+                                      const smIdType*                       elemIDs = 0,
+                                      std::vector<const SMDS_MeshElement*>* newElems = 0 );
+
+  //! Create elements of any types; nodes of i-th element are
+  //! nodeIDs[ offsets[i] ] ... nodeIDs[ offsets[i+1]-1 ].
+  //! Polyhedra and balls are not supported
+  virtual smIdType AddElementsWithID( const smIdType                        nbElems,
+                                      const SMDSAbs_EntityType*             types,
+                                      const smIdType*                       offsets,
+                                      const smIdType*                       nodeIDs,
+                                      const smIdType*                       elemIDs = 0,
+                                      std::vector<const SMDS_MeshElement*>* newElems = 0 );
+
   virtual void MoveNode(const SMDS_MeshNode *n, double x, double y, double z);
 
   virtual void RemoveElement(const SMDS_MeshElement *               elem,
@@ -627,6 +656,7 @@ public:
   virtual void CompactMesh();
   virtual bool IsCompacted();
   virtual bool HasNumerationHoles();
+  virtual bool HasGridHoles();
 
   template<class ELEMTYPE>
     static const ELEMTYPE* DownCast( const SMDS_MeshElement* e )
@@ -679,12 +709,44 @@ public:
   virtual bool Contains( const SMDS_MeshElement* elem ) const;
 
   /*!
-   * \brief Raise an exception if free memory (ram+swap) too low
+   * \brief Raise std::bad_alloc if all meshes use more memory than the global budget
     * \param doNotRaise - if true, suppress exception, just return free memory size
-    * \retval int - amount of available memory in MB or negative number in failure case
+    * \retval int - amount of memory in MB left within the global budget or
+    *         negative number if no budget is set
    */
   static int CheckMemory(const bool doNotRaise=false);
 
+  /*!
+   * \brief Set a limit of memory in MB used by all meshes together; zero means no limit
+   */
+  static void   SetGlobalMemoryBudget( size_t megabytes );
+  static size_t GetGlobalMemoryBudget();
+
+  /*!
+   * \brief Set a limit of memory in MB used by this mesh; zero means no limit
+   */
+  void   SetMemoryBudget( size_t megabytes ) { myMemoryBudget = megabytes; }
+  size_t GetMemoryBudget() const { return myMemoryBudget; }
+
+  /*!
+   * \brief Return an estimate of memory in bytes allocated by this mesh
+   */
+  size_t GetMemoryUsage() const;
+
+  /*!
+   * \brief Raise std::bad_alloc if this mesh or all meshes together exceed their
+   *        memory budget. It is called by element factories before allocation of
+   *        a new chunk of elements.
+   */
+  void CheckMemoryBudget();
+
+  /*!
+   * \brief Update memory usage of this mesh in the total usage of all meshes.
+   *        It is called before allocation of a chunk of elements and after release
+   *        of chunks by Clear() and CompactMesh().
+   */
+  void UpdateAccountedMemory();
+
   virtual smIdType MaxNodeID() const;
   virtual smIdType MinNodeID() const;
   virtual smIdType MaxElementID() const;
@@ -710,11 +772,14 @@ public:
   static int chunkSize;
 
   //! low level modification: add, change or remove node or element
-  inline void setMyModified() { this->myModified = true; }
+  inline void setMyModified() { this->myModified = true; ++this->myNbModifications; }
 
   void Modified();
   vtkMTimeType GetMTime() const;
 
+  //! number of low level modifications since the mesh creation
+  unsigned long GetNbModifications() const { return myNbModifications; }
+
  protected:
   SMDS_Mesh(SMDS_Mesh * parent);
 
@@ -737,7 +802,15 @@ public:
                               const int                       nbnodes,
                               std::set<const SMDS_MeshNode*>& oldNodes );
 
-  void setNbShapes( size_t nbShapes );  
+  void setNbShapes( size_t nbShapes );
+
+  void reserveCells( smIdType nbCells, smIdType nbCellNodes );
+
+  SMDS_MeshCell* addCellWithID( const SMDSAbs_EntityType type,
+                                const smIdType*          nodeIDs,
+                                const int                nbNodes,
+                                const smIdType           ID,
+                                std::vector<vtkIdType>&  vtkIds );
 
   // Fields PRIVATE
 
@@ -756,6 +829,11 @@ public:
   bool                   myModified;
   //! use a counter to keep track of modifications
   unsigned long          myModifTime, myCompactTime;
+  //! counter of any add, remove or change of node or cell, never reset
+  unsigned long          myNbModifications;
+
+  //! memory limit in MB and memory usage added to the total usage of all meshes
+  size_t                 myMemoryBudget, myAccountedMemory;
 
   friend class SMDS_ElementHolder;
   std::set< SMDS_ElementHolder* > myElemHolders;
@@ -381,7 +381,7 @@ struct XYZ {
   XYZ()                               { x = 0; y = 0; z = 0; }
   XYZ( double X, double Y, double Z ) { x = X; y = Y; z = Z; }
   XYZ( const XYZ& other )             { x = other.x; y = other.y; z = other.z; }
-  XYZ( const SMDS_MeshNode* n )       { x = n->X(); y = n->Y(); z = n->Z(); }
+  XYZ( const SMDS_MeshNode* n )       { n->GetXYZ( data() ); } // thread safe
   double* data()                      { return &x; }
   inline XYZ operator-( const XYZ& other );
   inline XYZ operator+( const XYZ& other );
@@ -573,9 +573,7 @@ bool SMDS_VolumeTool::Set (const SMDS_MeshElement*                  theVolume,
       int topNodeIndex = myVolume->NbCornerNodes() - 1;
       while ( !IsLinked( 0, topNodeIndex, /*ignoreMediumNodes=*/true )) --topNodeIndex;
       const SMDS_MeshNode* topNode = myVolumeNodes[ topNodeIndex ];
-      XYZ upDir (topNode->X() - botNode->X(),
-                 topNode->Y() - botNode->Y(),
-                 topNode->Z() - botNode->Z() );
+      XYZ upDir = XYZ( topNode ) - XYZ( botNode );
       myVolForward = ( botNormal.Dot( upDir ) < 0 );
     }
     if ( !myVolForward )
@@ -1229,9 +1227,10 @@ bool SMDS_VolumeTool::GetBaryCenter(double & X, double & Y, double & Z) const
     return false;
 
   for ( size_t i = 0; i < myVolumeNodes.size(); i++ ) {
-    X += myVolumeNodes[ i ]->X();
-    Y += myVolumeNodes[ i ]->Y();
-    Z += myVolumeNodes[ i ]->Z();
+    XYZ p( myVolumeNodes[ i ]);
+    X += p.x;
+    Y += p.y;
+    Z += p.z;
   }
   X /= myVolumeNodes.size();
   Y /= myVolumeNodes.size();
@@ -1614,9 +1613,10 @@ bool SMDS_VolumeTool::GetFaceBaryCenter (int faceIndex, double & X, double & Y,
   X = Y = Z = 0.0;
   for ( int i = 0; i < myCurFace.myNbNodes; ++i )
   {
-    X += myCurFace.myNodes[i]->X() / myCurFace.myNbNodes;
-    Y += myCurFace.myNodes[i]->Y() / myCurFace.myNbNodes;
-    Z += myCurFace.myNodes[i]->Z() / myCurFace.myNbNodes;
+    XYZ p( myCurFace.myNodes[i] );
+    X += p.x / myCurFace.myNbNodes;
+    Y += p.y / myCurFace.myNbNodes;
+    Z += p.z / myCurFace.myNbNodes;
   }
   return true;
 }
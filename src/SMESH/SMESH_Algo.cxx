@@ -178,6 +178,7 @@ SMESH_Algo::SMESH_Algo (int hypId, SMESH_Gen * gen)
 {
   _compatibleAllHypFilter = _compatibleNoAuxHypFilter = NULL;
   _onlyUnaryInput = _requireDiscreteBoundary = _requireShape = true;
+  _requireLowerDimMeshFile = true;
   _quadraticMesh = _supportSubmeshes = false;
   _error = COMPERR_OK;
   for ( int i = 0; i < 4; ++i )
@@ -279,6 +279,12 @@ public:
   // This info is used not to issue warnings on hiding of lower global algos.
   //
 
+  bool NeedLowerDimMeshFile() const { return _requireLowerDimMeshFile; }
+  // 7 - whether Compute() of a sub-mesh of the parallelism dimension of a
+  // SMESH_ParallelMesh reads the mesh of lower dimension from the MED file
+  // SMESH_ParallelMesh::GetLowerDimMeshFile(). If no algo needs it, the file is
+  // not written in MultiThread mode and the mesh in memory is used as is.
+
   virtual void setSubMeshesToCompute(SMESH_subMesh * aSubMesh) {SubMeshesToCompute().assign( 1, aSubMesh );}
 
 public:
@@ -447,6 +453,7 @@ protected:
   bool _requireShape;           // work with GetDim()-1 mesh bound to geom only. Default TRUE
   bool _supportSubmeshes;       // if !_requireDiscreteBoundary. Default FALSE
   bool _neededLowerHyps[4];     // hyp dims needed by algo that !_requireDiscreteBoundary. Df. FALSE
+  bool _requireLowerDimMeshFile;// Compute() in a parallel mesh reads GetLowerDimMeshFile(). Df. TRUE
 
   // indicates if quadratic mesh creation is required,
   // is usually set like this: _quadraticMesh = SMESH_MesherHelper::IsQuadraticSubMesh(shape)
@@ -0,0 +1,261 @@
+// Copyright (C) 2007-2025  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  File   : SMESH_ElementBuffer.cxx
+//  Module : SMESH
+//
+#include "SMESH_ElementBuffer.hxx"
+
+#include "SMDS_MeshNode.hxx"
+#include "SMESHDS_Mesh.hxx"
+#include "SMESH_Mesh.hxx"
+#include "SMESH_MeshLocker.hxx"
+
+#include <TopoDS_Shape.hxx>
+
+//================================================================================
+/*!
+ * \brief Constructor
+ */
+//================================================================================
+
+SMESH_ElementBuffer::SMESH_ElementBuffer()
+{
+}
+
+//================================================================================
+/*!
+ * \brief Allocate memory for a given number of nodes and elements
+ */
+//================================================================================
+
+void SMESH_ElementBuffer::Reserve( size_t nbNodes, size_t nbElems, size_t nbElemNodes )
+{
+  myNodes.reserve( nbNodes );
+  myNewNodes.reserve( nbNodes );
+  myNewNodeIndex.reserve( nbNodes );
+  myElems.reserve( nbElems );
+  myElemNodes.reserve( nbElemNodes > 0 ? nbElemNodes : 4 * nbElems );
+}
+
+//================================================================================
+/*!
+ * \brief Add a node to create
+ *  \param [in] x, y, z - node coordinates
+ *  \param [in] shapeID - ID of a sub-shape the node is on
+ *  \param [in] u, v - parameters of the node on the sub-shape
+ *  \return int - index of the node in the buffer
+ */
+//================================================================================
+
+int SMESH_ElementBuffer::AddNode( double x, double y, double z, int shapeID, double u, double v )
+{
+  _Node n;
+  n.myXYZ[0] = x; n.myXYZ[1] = y; n.myXYZ[2] = z;
+  n.myUV [0] = u; n.myUV [1] = v;
+  n.myShapeID = shapeID;
+
+  myNewNodeIndex.push_back( (int) myNewNodes.size() );
+  myNewNodes.push_back( n );
+  myNodes.push_back( nullptr );
+
+  return (int) myNodes.size() - 1;
+}
+
+//================================================================================
+/*!
+ * \brief Add a node existing in the mesh
+ *  \return int - index of the node in the buffer
+ */
+//================================================================================
+
+int SMESH_ElementBuffer::AddNode( const SMDS_MeshNode* node )
+{
+  myNewNodeIndex.push_back( -1 );
+  myNodes.push_back( node );
+
+  return (int) myNodes.size() - 1;
+}
+
+//================================================================================
+/*!
+ * \brief Add an element to create
+ *  \param [in] nodeIndices - indices of element nodes in the buffer
+ *  \param [in] features - type of the element etc.
+ *  \param [in] shapeID - ID of a sub-shape the element is on
+ *  \return int - index of the element in the buffer
+ */
+//================================================================================
+
+int SMESH_ElementBuffer::AddElement( const std::vector<int>&               nodeIndices,
+                                     const SMESH_MeshEditor::ElemFeatures& features,
+                                     int                                   shapeID )
+{
+  _Element e;
+  e.myType         = features.myType;
+  e.myIsPoly       = features.myIsPoly;
+  e.myIsQuad       = features.myIsQuad;
+  e.myShapeID      = shapeID;
+  e.myNbNodes      = (int) nodeIndices.size();
+  e.my1stNode      = myElemNodes.size();
+  e.my1stQuantity  = myQuantities.size();
+  e.myNbQuantities = (int) features.myPolyhedQuantities.size();
+  e.myBallDiameter = features.myBallDiameter;
+
+  myElemNodes.insert( myElemNodes.end(), nodeIndices.begin(), nodeIndices.end() );
+  myQuantities.insert( myQuantities.end(),
+                       features.myPolyhedQuantities.begin(),
+                       features.myPolyhedQuantities.end() );
+  myElems.push_back( e );
+
+  return (int) myElems.size() - 1;
+}
+
+//================================================================================
+/*!
+ * \brief Add a triangle to create
+ */
+//================================================================================
+
+int SMESH_ElementBuffer::AddFace( int n1, int n2, int n3, int shapeID )
+{
+  std::vector<int> nodes = { n1, n2, n3 };
+  return AddElement( nodes, SMESH_MeshEditor::ElemFeatures( SMDSAbs_Face ), shapeID );
+}
+
+//================================================================================
+/*!
+ * \brief Add a quadrangle to create
+ */
+//================================================================================
+
+int SMESH_ElementBuffer::AddFace( int n1, int n2, int n3, int n4, int shapeID )
+{
+  std::vector<int> nodes = { n1, n2, n3, n4 };
+  return AddElement( nodes, SMESH_MeshEditor::ElemFeatures( SMDSAbs_Face ), shapeID );
+}
+
+//================================================================================
+/*!
+ * \brief Add a tetrahedron to create
+ */
+//================================================================================
+
+int SMESH_ElementBuffer::AddVolume( int n1, int n2, int n3, int n4, int shapeID )
+{
+  std::vector<int> nodes = { n1, n2, n3, n4 };
+  return AddElement( nodes, SMESH_MeshEditor::ElemFeatures( SMDSAbs_Volume ), shapeID );
+}
+
+//================================================================================
+/*!
+ * \brief Add buffered nodes and elements to the mesh. The mesh is locked meanwhile.
+ *        Buffered elements are then removed while nodes remain available via GetNode()
+ *  \param [in] mesh - the mesh to fill in
+ *  \param [out] createdElems - optional vector of created elements; an element
+ *               that could not be created is NULL
+ *  \return bool - false if some element could not be created
+ */
+//================================================================================
+
+bool SMESH_ElementBuffer::Commit( SMESH_Mesh& mesh, std::vector<const SMDS_MeshElement*>* createdElems )
+{
+  bool ok = true;
+  {
+    SMESH_MeshLocker locker( &mesh );
+
+    SMESHDS_Mesh* meshDS = mesh.GetMeshDS();
+
+    // create nodes
+
+    for ( size_t i = 0; i < myNodes.size(); ++i )
+    {
+      if ( myNodes[i] )
+        continue;
+      const _Node&    n = myNewNodes[ myNewNodeIndex[i] ];
+      SMDS_MeshNode* node = meshDS->AddNode( n.myXYZ[0], n.myXYZ[1], n.myXYZ[2] );
+      myNodes[i] = node;
+      if ( n.myShapeID < 1 || !mesh.HasShapeToMesh() )
+        continue;
+      switch ( meshDS->IndexToShape( n.myShapeID ).ShapeType() )
+      {
+      case TopAbs_VERTEX: meshDS->SetNodeOnVertex( node, n.myShapeID ); break;
+      case TopAbs_EDGE:   meshDS->SetNodeOnEdge  ( node, n.myShapeID, n.myUV[0] ); break;
+      case TopAbs_FACE:   meshDS->SetNodeOnFace  ( node, n.myShapeID, n.myUV[0], n.myUV[1] ); break;
+      default:            meshDS->SetNodeInVolume( node, n.myShapeID );
+      }
+    }
+
+    // create elements
+
+    if ( createdElems )
+      createdElems->resize( myElems.size() );
+
+    SMESH_MeshEditor editor( &mesh );
+    SMESH_MeshEditor::ElemFeatures features;
+    std::vector<const SMDS_MeshNode*> nodes;
+
+    for ( size_t i = 0; i < myElems.size(); ++i )
+    {
+      const _Element& e = myElems[i];
+
+      nodes.resize( e.myNbNodes );
+      for ( int iN = 0; iN < e.myNbNodes; ++iN )
+        nodes[ iN ] = myNodes[ myElemNodes[ e.my1stNode + iN ]];
+
+      features.Init( e.myType, e.myIsPoly, e.myIsQuad );
+      features.myBallDiameter = e.myBallDiameter;
+      features.myPolyhedQuantities.assign( myQuantities.begin() + e.my1stQuantity,
+                                           myQuantities.begin() + e.my1stQuantity + e.myNbQuantities );
+
+      const SMDS_MeshElement* elem = editor.AddElement( nodes, features );
+      if ( elem && e.myShapeID > 0 && mesh.HasShapeToMesh() )
+        meshDS->SetMeshElementOnShape( elem, e.myShapeID );
+      if ( !elem )
+        ok = false;
+      if ( createdElems )
+        (*createdElems)[i] = elem;
+    }
+  }
+
+  // keep created nodes to be used by elements of a next batch
+  myNewNodes.clear();
+  myNewNodeIndex.assign( myNodes.size(), -1 );
+  myElems.clear();
+  myElemNodes.clear();
+  myQuantities.clear();
+
+  return ok;
+}
+
+//================================================================================
+/*!
+ * \brief Forget all buffered data
+ */
+//================================================================================
+
+void SMESH_ElementBuffer::Clear()
+{
+  myNodes.clear();
+  myNewNodes.clear();
+  myNewNodeIndex.clear();
+  myElems.clear();
+  myElemNodes.clear();
+  myQuantities.clear();
+}
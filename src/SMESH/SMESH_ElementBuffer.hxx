@@ -0,0 +1,123 @@
+// Copyright (C) 2007-2025  CEA, EDF, OPEN CASCADE
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+//  File   : SMESH_ElementBuffer.hxx
+//  Module : SMESH
+//
+#ifndef _SMESH_ELEMENTBUFFER_HXX_
+#define _SMESH_ELEMENTBUFFER_HXX_
+
+#include "SMESH_SMESH.hxx"
+
+#include "SMESH_MeshEditor.hxx"
+
+#include <vector>
+
+class SMDS_MeshNode;
+class SMDS_MeshElement;
+class SMESH_Mesh;
+
+//------------------------------------------------------------------------------------
+/*!
+ * \brief Staging buffer of nodes and elements to create in a mesh.
+ *
+ * It is used to create elements from several threads: each thread fills its own
+ * buffer without touching the mesh, then Commit() adds all buffered nodes and
+ * elements to the mesh at once, under SMESH_MeshLocker. So the mesh is locked
+ * only while the elements are really added and not during the whole compute.
+ *
+ * Nodes are referred to by their index in the buffer; a node existing in the mesh
+ * is referred to via AddNode( const SMDS_MeshNode* ). Note that other threads may
+ * modify the mesh while the buffer is filled, so coordinates of existing nodes
+ * should be read under the mesh lock.
+ */
+//------------------------------------------------------------------------------------
+
+class SMESH_EXPORT SMESH_ElementBuffer
+{
+ public:
+
+  SMESH_ElementBuffer();
+
+  //! Allocate memory for a given number of nodes and elements
+  void Reserve( size_t nbNodes, size_t nbElems, size_t nbElemNodes = 0 );
+
+  //! Add a node to create; \a shapeID and \a u, \a v define its position on shape
+  int AddNode( double x, double y, double z, int shapeID = 0, double u = 0., double v = 0. );
+
+  //! Add a node existing in the mesh, to be used by elements to create
+  int AddNode( const SMDS_MeshNode* node );
+
+  //! Add an element to create and return its index in the buffer
+  int AddElement( const std::vector<int>&                   nodeIndices,
+                  const SMESH_MeshEditor::ElemFeatures&     features,
+                  int                                       shapeID = 0 );
+
+  //! Add an element to create with nodes given by indices
+  int AddFace  ( int n1, int n2, int n3,         int shapeID = 0 );
+  int AddFace  ( int n1, int n2, int n3, int n4, int shapeID = 0 );
+  int AddVolume( int n1, int n2, int n3, int n4, int shapeID = 0 );
+
+  //! Return number of buffered nodes including existing ones
+  size_t NbNodes() const { return myNodes.size(); }
+
+  //! Return number of buffered elements
+  size_t NbElements() const { return myElems.size(); }
+
+  //! Return a mesh node by its index in the buffer. It is NULL before Commit()
+  //! for a node to create
+  const SMDS_MeshNode* GetNode( int nodeIndex ) const { return myNodes[ nodeIndex ]; }
+
+  //! Add buffered nodes and elements to the mesh and remove elements from the buffer;
+  //! nodes stay in the buffer to be used by next elements.
+  //! Return false if some element could not be created
+  bool Commit( SMESH_Mesh& mesh, std::vector<const SMDS_MeshElement*>* createdElems = 0 );
+
+  //! Forget all buffered data
+  void Clear();
+
+ private:
+
+  struct _Node
+  {
+    double myXYZ[3];
+    double myUV [2];
+    int    myShapeID;
+  };
+  struct _Element
+  {
+    SMDSAbs_ElementType myType;
+    bool                myIsPoly, myIsQuad;
+    int                 myShapeID;
+    int                 myNbNodes;
+    size_t              my1stNode;      // index in myElemNodes
+    size_t              my1stQuantity;  // index in myQuantities of polyhedron
+    int                 myNbQuantities;
+    double              myBallDiameter;
+  };
+
+  std::vector< const SMDS_MeshNode* > myNodes;       // NULL for a node to create
+  std::vector< _Node >                myNewNodes;    // data of nodes to create
+  std::vector< int >                  myNewNodeIndex;// index in myNewNodes of a node
+  std::vector< _Element >             myElems;
+  std::vector< int >                  myElemNodes;   // node indices of all elements
+  std::vector< int >                  myQuantities;  // polyhedra quantities
+};
+
+#endif
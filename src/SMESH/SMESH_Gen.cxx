@@ -34,10 +34,12 @@
 #include "SMDS_MeshElement.hxx"
 #include "SMDS_MeshNode.hxx"
 #include "SMESHDS_Document.hxx"
+#include "SMESHDS_SubMesh.hxx"
 #include "SMESH_HypoFilter.hxx"
 #include "SMESH_Mesh.hxx"
 #include "SMESH_SequentialMesh.hxx"
 #include "SMESH_ParallelMesh.hxx"
+#include "SMESH_MeshLocker.hxx"
 #include "SMESH_MesherHelper.hxx"
 #include "SMESH_subMesh.hxx"
 
@@ -49,7 +51,15 @@
 #include <TopoDS_Iterator.hxx>
 
 #include "memoire.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <queue>
 
 #include <QString>
 #include <QProcess>
@@ -112,6 +122,307 @@ namespace
     }
     return allowedSub;
   }
+
+#ifndef WIN32
+  //================================================================================
+  /*!
+   * \brief Node of a graph of sub-meshes computed by a thread pool. A sub-mesh
+   *        is posted to the pool when all sub-meshes of the same stage it depends
+   *        on are computed. Only sub-meshes of the parallel element run concurrently,
+   *        others are computed under SMESH_MeshLocker, i.e. one at a time
+   */
+  //================================================================================
+
+  struct _ComputeTask
+  {
+    SMESH_subMesh*   _subMesh = nullptr;
+    bool             _toLock  = true; // compute under SMESH_MeshLocker
+    std::atomic<int> _nbPending{ 0 }; // nb of sub-meshes to compute before _subMesh
+    std::vector<int> _dependents;     // tasks waiting for _subMesh
+    double           _time     = 0.;  // estimated compute time of _subMesh
+    double           _priority = -1.; // estimated time of the longest chain of tasks from this one
+    bool             _computed = false; // _subMesh is computed by this task
+  };
+
+  //================================================================================
+  /*!
+   * \brief Return estimated time of the longest chain of tasks starting from a task
+   */
+  //================================================================================
+
+  double getPriority( std::vector< _ComputeTask >& tasks, int iTask )
+  {
+    _ComputeTask& task = tasks[ iTask ];
+    if ( task._priority < 0 )
+    {
+      double maxDependentPriority = 0;
+      for ( int iDependent : task._dependents )
+        maxDependentPriority = std::max( maxDependentPriority, getPriority( tasks, iDependent ));
+      task._priority = task._time + maxDependentPriority;
+    }
+    return task._priority;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Evaluate numbers of mesh entities to generate on sub-meshes.
+   *        Computed sub-meshes they depend on are not evaluated, their existing
+   *        mesh entities are counted. Contrary to SMESH_subMesh::Evaluate(),
+   *        compute errors of sub-meshes are kept.
+   */
+  //================================================================================
+
+  void evaluate( SMESH_Mesh&                          aMesh,
+                 const std::vector< SMESH_subMesh* >& subMeshes,
+                 MapShapeNbElems&                     nbElems )
+  {
+    // sub-meshes to evaluate, lower dimension first as an algo needs
+    // estimations of its boundary
+    std::vector< SMESH_subMesh* > toEvaluate;
+    std::set< SMESH_subMesh* >    added;
+    std::set< SMESH_subMesh* >    scheduled( subMeshes.begin(), subMeshes.end() );
+    for ( SMESH_subMesh* sm : subMeshes )
+    {
+      SMESH_subMeshIteratorPtr smIt = sm->getDependsOnIterator(/*includeSelf=*/true);
+      while ( smIt->more() )
+      {
+        SMESH_subMesh* subSM = smIt->next();
+        if ( added.insert( subSM ).second )
+          toEvaluate.push_back( subSM );
+      }
+    }
+    std::stable_sort( toEvaluate.begin(), toEvaluate.end(),
+                      []( SMESH_subMesh* sm1, SMESH_subMesh* sm2 )
+                      { return ( SMESH_Gen::GetShapeDim( sm1->GetSubShape() ) <
+                                 SMESH_Gen::GetShapeDim( sm2->GetSubShape() )); });
+
+    for ( SMESH_subMesh* sm : toEvaluate )
+    {
+      if ( sm->GetSubShape().ShapeType() == TopAbs_VERTEX )
+      {
+        std::vector< smIdType >& nbEntities = nbElems[ sm ];
+        nbEntities.resize( SMDSEntity_Last, 0 );
+        nbEntities[ SMDSEntity_Node ] = 1;
+      }
+      else if ( sm->IsMeshComputed() )
+      {
+        std::vector< smIdType >& nbEntities = nbElems[ sm ];
+        nbEntities.resize( SMDSEntity_Last, 0 );
+        if ( SMESHDS_SubMesh* smDS = sm->GetSubMeshDS() )
+        {
+          nbEntities[ SMDSEntity_Node ] = smDS->NbNodes();
+          SMDS_ElemIteratorPtr elemIt = smDS->GetElements();
+          while ( elemIt->more() )
+            nbEntities[ elemIt->next()->GetEntityType() ]++;
+        }
+      }
+      else if ( !scheduled.count( sm ))
+      {
+        continue; // not computed yet, GetComputeCost() is used for its dependents
+      }
+      else if ( SMESH_Algo* algo = sm->GetAlgo() )
+      {
+        SMESH_Hypothesis::Hypothesis_Status status;
+        try {
+          OCC_CATCH_SIGNALS;
+          if ( algo->CheckHypothesis( aMesh, sm->GetSubShape(), status ))
+            algo->Evaluate( aMesh, sm->GetSubShape(), nbElems );
+        }
+        catch (...) {
+          // no estimation, SMESH_subMesh::GetComputeCost() will be used
+        }
+      }
+    }
+  }
+
+  //================================================================================
+  /*!
+   * \brief Append estimated and real compute times of tasks to a file
+   */
+  //================================================================================
+
+  void dumpComputeStats( const char*                        fileName,
+                         const std::vector< _ComputeTask >& tasks,
+                         const MapShapeNbElems&             nbElems,
+                         double                             estimationTime,
+                         double                             makespan )
+  {
+    std::ofstream file( fileName, std::ios::app );
+    if ( !file )
+      return;
+    file << "# sub-mesh shape_type algo estimated_time priority real_time"
+         << " evaluated_nb real_nb" << std::endl;
+    for ( const _ComputeTask& task : tasks )
+    {
+      SMESH_subMesh*      sm = task._subMesh;
+      const SMESH_Algo* algo = sm->GetAlgo();
+      MapShapeNbElems::const_iterator sm2nb = nbElems.find( sm );
+      smIdType nbEvaluated = 0, nbReal = 0;
+      if ( sm2nb != nbElems.end() )
+        nbEvaluated = std::accumulate( sm2nb->second.begin(), sm2nb->second.end(), smIdType(0) );
+      if ( const SMESHDS_SubMesh* smDS = sm->GetSubMeshDS() )
+        nbReal = smDS->NbNodes() + smDS->NbElements();
+      file << sm->GetId()                         << " "
+           << sm->GetSubShape().ShapeType()       << " "
+           << ( algo ? algo->GetName() : "none" ) << " "
+           << task._time                          << " "
+           << task._priority                      << " "
+           << ( task._computed ? sm->GetComputeTime() : 0. ) << " "
+           << nbEvaluated                         << " "
+           << nbReal                              << std::endl;
+    }
+    file << "# estimation_time " << estimationTime << std::endl;
+    file << "# makespan " << makespan << std::endl;
+  }
+
+  //================================================================================
+  /*!
+   * \brief Compute sub-meshes of one stage using the thread pool of a parallel mesh.
+   *        Dependencies between sub-meshes are taken from getDependsOnIterator().
+   *        A sub-mesh not of the parallel element is computed under the mesh lock,
+   *        so such sub-meshes are computed one after another; only sub-meshes of
+   *        the parallel element are computed concurrently. parallelComputeSubMeshes()
+   *        calls it for lower dimensions first, so all of them are computed before
+   *        any sub-mesh of the parallelism dimension starts.
+   *        Among ready sub-meshes, the one starting the longest chain of
+   *        estimated compute times is computed first. Compute times are not
+   *        estimated if all sub-meshes are computed one by one under the mesh lock,
+   *        or if SMESH_COMPUTE_NO_ORDER environment variable is set.
+   *  \param [in] aParMesh - the mesh owning the thread pool
+   *  \param [in] subMeshes - sub-meshes to compute
+   *  \param [in] computeEvent - event to send to sub-meshes
+   *  \param [in] allowedSubShapes - sub-shapes allowed for compute
+   *  \param [in] isCanceled - flag telling that the compute is canceled
+   */
+  //================================================================================
+
+  void computeGraph( SMESH_ParallelMesh&                  aParMesh,
+                     const std::vector< SMESH_subMesh* >& subMeshes,
+                     SMESH_subMesh::compute_event         computeEvent,
+                     TopTools_IndexedMapOfShape*          allowedSubShapes,
+                     const volatile bool &                isCanceled )
+  {
+    const int nbTasks = (int) subMeshes.size();
+    if ( nbTasks == 0 )
+      return;
+
+    // build the graph; it is done in this thread as DependsOn() and GetAlgo()
+    // of sub-meshes are lazily initialized and thus are not thread-safe
+
+    std::vector< _ComputeTask > tasks( nbTasks );
+    std::map< SMESH_subMesh*, int > sm2task;
+    for ( int i = 0; i < nbTasks; ++i )
+    {
+      tasks[i]._subMesh = subMeshes[i];
+      sm2task.insert( std::make_pair( subMeshes[i], i ));
+    }
+    for ( int i = 0; i < nbTasks; ++i )
+    {
+      SMESH_subMesh* sm = tasks[i]._subMesh;
+      int nbPending = 0;
+      SMESH_subMeshIteratorPtr smIt = sm->getDependsOnIterator(/*includeSelf=*/false);
+      while ( smIt->more() )
+      {
+        std::map< SMESH_subMesh*, int >::iterator sm2t = sm2task.find( smIt->next() );
+        if ( sm2t == sm2task.end() )
+          continue;
+        tasks[ sm2t->second ]._dependents.push_back( i );
+        ++nbPending;
+      }
+      tasks[i]._nbPending = nbPending;
+
+      // elements of the parallelism dimension are computed by algos
+      // aware of the parallel mesh, other algos modify the mesh under a lock
+      tasks[i]._toLock = ( sm->GetSubShape().ShapeType() != aParMesh.GetParallelElement() );
+    }
+
+    // estimate compute times to start long tasks and tasks blocking them first;
+    // else tasks are started in the order of subMeshes
+
+    SMESH_Gen* gen = aParMesh.GetGen();
+    MapShapeNbElems nbElems;
+    bool toOrder = ( nbTasks > 1 && !getenv( "SMESH_COMPUTE_NO_ORDER" ));
+    if ( toOrder )
+    {
+      toOrder = false;
+      for ( int i = 0; i < nbTasks && !toOrder; ++i )
+        toOrder = !tasks[i]._toLock;
+    }
+    auto estimationStart = std::chrono::steady_clock::now();
+    if ( toOrder )
+    {
+      evaluate( aParMesh, subMeshes, nbElems );
+      for ( _ComputeTask& task : tasks )
+        task._time = gen->EstimateComputeTime( task._subMesh, nbElems );
+      for ( int i = 0; i < nbTasks; ++i )
+        getPriority( tasks, i );
+    }
+    std::chrono::duration< double > estimationTime =
+      std::chrono::steady_clock::now() - estimationStart;
+
+    // ready tasks; a posted job computes the ready task of highest priority
+    std::priority_queue< std::pair< double, int > > readyTasks;
+    std::mutex                                      readyMutex;
+    auto pushReady = [&]( int iTask )
+    {
+      std::lock_guard< std::mutex > lock( readyMutex );
+      readyTasks.push( std::make_pair( tasks[ iTask ]._priority, -iTask ));
+    };
+
+    std::function< void() > compute = [&]()
+    {
+      int iTask;
+      {
+        std::lock_guard< std::mutex > lock( readyMutex );
+        iTask = -readyTasks.top().second;
+        readyTasks.pop();
+      }
+      _ComputeTask& task = tasks[ iTask ];
+      SMESH_subMesh*  sm = task._subMesh;
+      if ( !isCanceled && sm->GetComputeState() == SMESH_subMesh::READY_TO_COMPUTE )
+      {
+        std::unique_ptr< SMESH_MeshLocker > locker;
+        if ( task._toLock )
+          locker.reset( new SMESH_MeshLocker( &aParMesh ));
+
+        sm->SetAllowedSubShapes( allowedSubShapes );
+        sm->ComputeStateEngine( computeEvent );
+        sm->SetAllowedSubShapes( nullptr );
+        task._computed = true;
+      }
+      for ( int iDependent : task._dependents )
+        if ( --tasks[ iDependent ]._nbPending == 0 )
+        {
+          pushReady( iDependent );
+          boost::asio::post( *aParMesh.GetPool(), compute );
+        }
+    };
+
+    auto computeStart = std::chrono::steady_clock::now();
+
+    int nbReady = 0;
+    for ( int i = 0; i < nbTasks; ++i )
+      if ( tasks[i]._nbPending == 0 )
+      {
+        pushReady( i );
+        ++nbReady;
+      }
+    for ( int i = 0; i < nbReady; ++i )
+      boost::asio::post( *aParMesh.GetPool(), compute );
+
+    // join() returns when there is no more work including tasks posted by tasks
+    aParMesh.wait();
+
+    std::chrono::duration< double > makespan = std::chrono::steady_clock::now() - computeStart;
+
+    for ( _ComputeTask& task : tasks )
+      if ( task._computed )
+        gen->LearnComputeTime( task._subMesh );
+
+    if ( const char* statFile = getenv( "SMESH_COMPUTE_STATS" ))
+      dumpComputeStats( statFile, tasks, nbElems, estimationTime.count(), makespan.count() );
+  }
+#endif
 }
 
 //=============================================================================
@@ -259,40 +570,6 @@ bool SMESH_Gen::sequentialComputeSubMeshes(
 
 };
 
-//=============================================================================
-/*
- * compute of a submesh
- * This function is passed to the thread pool
- */
-//=============================================================================
-const std::function<void(SMESH_subMesh*,
-                         SMESH_subMesh::compute_event,
-                         SMESH_subMesh*,
-                         bool,
-                         TopTools_IndexedMapOfShape *,
-                         TSetOfInt*)>
-     compute_function([] (SMESH_subMesh* sm,
-                          SMESH_subMesh::compute_event event,
-                          SMESH_subMesh *shapeSM,
-                          bool aShapeOnly,
-                          TopTools_IndexedMapOfShape *allowedSubShapes,
-                          TSetOfInt*                  aShapesId) -> void
-{
-  if (sm->GetComputeState() == SMESH_subMesh::READY_TO_COMPUTE)
-  {
-    sm->SetAllowedSubShapes( fillAllowed( shapeSM, aShapeOnly, allowedSubShapes ));
-    //setCurrentSubMesh( sm );
-    sm->ComputeStateEngine(event);
-    //setCurrentSubMesh( nullptr );
-    sm->SetAllowedSubShapes( nullptr );
-  }
-
-  if ( aShapesId )
-    aShapesId->insert( sm->GetId() );
-
-});
-
-
 //=============================================================================
 /*
  * Copy a file on remote resource
@@ -382,9 +659,12 @@ bool SMESH_Gen::parallelComputeSubMeshes(
   SMESH_subMesh *shapeSM = aMesh.GetSubMesh(aShape);
   SMESH_ParallelMesh &aParMesh = dynamic_cast<SMESH_ParallelMesh&>(aMesh);
 
-  TopAbs_ShapeEnum previousShapeType = TopAbs_VERTEX;
   MESSAGE("Parallel Compute of submeshes");
 
+  // Sub-meshes of dimension lower than the parallelism one are computed first,
+  // then the lower dimension mesh is dumped for the parallel meshers
+  // and the rest sub-meshes are computed
+  std::vector< SMESH_subMesh* > subMeshesByStage[2];
 
   smIt = shapeSM->getDependsOnIterator(includeSelf, !complexShapeFirst);
   while ( smIt->more() )
@@ -394,30 +674,9 @@ bool SMESH_Gen::parallelComputeSubMeshes(
     // do not mesh vertices of a pseudo shape
     const TopoDS_Shape&        shape = smToCompute->GetSubShape();
     const TopAbs_ShapeEnum shapeType = shape.ShapeType();
-    // Not doing in parallel 1D meshes
     if ( !aMesh.HasShapeToMesh() && shapeType == TopAbs_VERTEX )
       continue;
 
-    if (shapeType != previousShapeType) {
-      // Waiting for all threads for the previous type to end
-      aMesh.wait();
-
-      std::string file_name="";
-      if (previousShapeType == aParMesh.GetDumpElement())
-        file_name = "Mesh"+std::to_string(aParMesh.GetParallelismDimension()-1)+"D.med";
-
-      if(file_name != "")
-      {
-        fs::path mesh_file = fs::path(aParMesh.GetTmpFolder()) / fs::path(file_name);
-	      SMESH_DriverMesh::exportMesh(mesh_file.string(), aMesh, "MESH");
-        if (aParMesh.GetParallelismMethod() == ParallelismMethod::MultiNode) {
-          this->send_mesh(aMesh, mesh_file.string());
-        }
-      }
-      //Resetting threaded pool info
-      previousShapeType = shapeType;
-    }
-
     // check for preview dimension limitations
     if ( aShapesId && SMESH_Gen::GetShapeDim( shapeType ) > (int)aDim )
     {
@@ -426,26 +685,87 @@ bool SMESH_Gen::parallelComputeSubMeshes(
       smToCompute->ComputeStateEngine( SMESH_subMesh::CHECK_COMPUTE_STATE );
       continue;
     }
-    // Parallelism is only for 3D parts
-    if(shapeType!=aMesh.GetParallelElement()){
-      compute_function(smToCompute, computeEvent,
-                      shapeSM, aShapeOnly, allowedSubShapes,
-                      aShapesId);
-    }else{
-      boost::asio::post(*(aParMesh.GetPool()), std::bind(compute_function, smToCompute, computeEvent,
-                        shapeSM, aShapeOnly, allowedSubShapes,
-                        aShapesId));
+    const bool isLowerDim =
+      ( SMESH_Gen::GetShapeDim( shapeType ) < aParMesh.GetParallelismDimension() );
+    subMeshesByStage[ isLowerDim ? 0 : 1 ].push_back( smToCompute );
+  }
+
+  // fill allowed sub-shapes here as it is not thread-safe
+  TopTools_IndexedMapOfShape* allowed = fillAllowed( shapeSM, aShapeOnly, allowedSubShapes );
+
+  typedef std::chrono::steady_clock TClock;
+  SMESH_ParallelMesh::StageTimes times;
+  TClock::time_point stageStart = TClock::now();
+
+  computeGraph( aParMesh, subMeshesByStage[0], computeEvent, allowed, _compute_canceled );
+
+  times._computeLowerDim = std::chrono::duration<double>( TClock::now() - stageStart ).count();
+
+  if ( !subMeshesByStage[1].empty() && !_compute_canceled )
+  {
+    // in MultiThread mode, algos not reading the lower dimension mesh from a file
+    // use the mesh in memory, so the file is written only if needed
+    const bool isMultiNode = ( aParMesh.GetParallelismMethod() == ParallelismMethod::MultiNode );
+    bool needMeshFile = isMultiNode;
+    for ( size_t i = 0; i < subMeshesByStage[1].size() && !needMeshFile; ++i )
+      if ( SMESH_Algo* algo = subMeshesByStage[1][i]->GetAlgo() )
+        needMeshFile = algo->NeedLowerDimMeshFile();
+
+    if ( needMeshFile )
+    {
+      fs::path mesh_file = aParMesh.GetLowerDimMeshFile();
+
+      stageStart = TClock::now();
+      SMESH_DriverMesh::exportMesh(mesh_file.string(), aMesh, "MESH");
+      times._exportLowerDim = std::chrono::duration<double>( TClock::now() - stageStart ).count();
+
+      if ( isMultiNode )
+      {
+        stageStart = TClock::now();
+        this->send_mesh(aMesh, mesh_file.string());
+        times._sendLowerDim = std::chrono::duration<double>( TClock::now() - stageStart ).count();
+      }
     }
+
+    stageStart = TClock::now();
+    computeGraph( aParMesh, subMeshesByStage[1], computeEvent, allowed, _compute_canceled );
+    times._computeParaDim = std::chrono::duration<double>( TClock::now() - stageStart ).count();
   }
 
-  // Waiting for the thread for Solids to finish
-  aMesh.wait();
+  aParMesh.SetStageTimes( times );
+  MESSAGE("Parallel compute stages [s]: lower dim " << times._computeLowerDim
+          << ", export "   << times._exportLowerDim
+          << ", send "     << times._sendLowerDim
+          << ", para dim " << times._computeParaDim );
+  if ( const char* statFile = getenv( "SMESH_COMPUTE_STATS" ))
+  {
+    std::ofstream file( statFile, std::ios::app );
+    file << "# stages: compute_lower_dim export send compute_para_dim" << std::endl
+         << "# stage_times "
+         << times._computeLowerDim << " " << times._exportLowerDim << " "
+         << times._sendLowerDim    << " " << times._computeParaDim << std::endl;
+  }
 
   aMesh.GetMeshDS()->Modified();
 
+  // we check all the sub-meshes here and detect if any of them failed to compute
+  for ( std::vector< SMESH_subMesh* > & subMeshes : subMeshesByStage )
+    for ( SMESH_subMesh* sm : subMeshes )
+    {
+      const TopoDS_Shape& shape = sm->GetSubShape();
+      if (sm->GetComputeState() == SMESH_subMesh::FAILED_TO_COMPUTE &&
+          ( shape.ShapeType() != TopAbs_EDGE || !SMESH_Algo::isDegenerated( TopoDS::Edge( shape ))))
+        ret = false;
+      else if ( aShapesId )
+        aShapesId->insert( sm->GetId() );
+    }
+
   // Cleanup done here as in Python the destructor is not called
   aParMesh.cleanup();
 
+  if ( _compute_canceled )
+    return false;
+
   return ret;
 #endif
 };
@@ -1162,6 +1482,61 @@ static bool checkMissing(SMESH_Gen*                aGen,
   return ret;
 }
 
+//================================================================================
+/*!
+ * \brief Estimates time of computing a sub-mesh using the time per mesh entity
+ *        measured at previous computes by the same algorithm
+ */
+//================================================================================
+
+double SMESH_Gen::EstimateComputeTime(SMESH_subMesh*         aSubMesh,
+                                      const MapShapeNbElems& aNbElems) const
+{
+  double nbEntities = 0;
+  MapShapeNbElems::const_iterator sm2nb = aNbElems.find( aSubMesh );
+  if ( sm2nb != aNbElems.end() )
+    nbEntities = std::accumulate( sm2nb->second.begin(), sm2nb->second.end(), 0. );
+  if ( nbEntities == 0 ) // not evaluated
+    nbEntities = aSubMesh->GetComputeCost();
+
+  // initial time per entity, until the algo is learned
+  const double defaultTime[] = { 1e-7, 1e-6, 2e-5, 1e-4 }; // per dimension
+  int dim = std::max( 0, GetShapeDim( aSubMesh->GetSubShape() ));
+  double timePerEntity = defaultTime[ dim ];
+
+  if ( SMESH_Algo* algo = aSubMesh->GetAlgo() )
+  {
+    std::lock_guard< std::mutex > lock( _computeTimeMutex );
+    auto name2stat = _computeTimeStats.find( algo->GetName() );
+    if ( name2stat != _computeTimeStats.end() && name2stat->second.second > 0 )
+      timePerEntity = name2stat->second.first / name2stat->second.second;
+  }
+  return nbEntities * timePerEntity;
+}
+
+//================================================================================
+/*!
+ * \brief Takes into account the time of the last compute of a sub-mesh
+ *        to improve further estimations by EstimateComputeTime()
+ */
+//================================================================================
+
+void SMESH_Gen::LearnComputeTime(SMESH_subMesh* aSubMesh)
+{
+  SMESH_Algo*         algo = aSubMesh->GetAlgo();
+  SMESHDS_SubMesh*    smDS = aSubMesh->GetSubMeshDS();
+  if ( !algo || !smDS || aSubMesh->GetComputeTime() <= 0 )
+    return;
+  double nbEntities = double( smDS->NbNodes() + smDS->NbElements() );
+  if ( nbEntities == 0 )
+    return;
+
+  std::lock_guard< std::mutex > lock( _computeTimeMutex );
+  std::pair< double, double > & timeAndNb = _computeTimeStats[ algo->GetName() ];
+  timeAndNb.first  += aSubMesh->GetComputeTime();
+  timeAndNb.second += nbEntities;
+}
+
 //=======================================================================
 //function : CheckAlgoState
 //purpose  : notify on bad state of attached algos, return false
@@ -1544,6 +1919,28 @@ int SMESH_Gen::GetFlatShapeDim(const TopoDS_Shape &aShape)
   return aShapeDim;
 }
 
+//================================================================================
+/*!
+ * \brief Set a limit of memory in MB used by all meshes; zero means no limit
+ */
+//================================================================================
+
+void SMESH_Gen::SetMemoryBudget( int megabytes )
+{
+  SMDS_Mesh::SetGlobalMemoryBudget( megabytes > 0 ? size_t( megabytes ) : 0 );
+}
+
+//================================================================================
+/*!
+ * \brief Return a limit of memory in MB used by all meshes
+ */
+//================================================================================
+
+int SMESH_Gen::GetMemoryBudget()
+{
+  return int( SMDS_Mesh::GetGlobalMemoryBudget() );
+}
+
 //=============================================================================
 /*!
  * Generate a new id unique within this Gen
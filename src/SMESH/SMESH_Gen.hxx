@@ -37,6 +37,7 @@
 #include "SMESH_subMesh.hxx"
 
 #include <map>
+#include <mutex>
 #include <list>
 #include <set>
 #include <vector>
@@ -121,6 +122,20 @@ public:
   // notify on bad state of attached algos, return false
   // if Compute() would fail because of some algo bad state
 
+  /*!
+   * \brief Estimates time of computing a sub-mesh using the time per mesh entity
+   *        measured at previous computes by the same algorithm
+   * \param aSubMesh - the sub-mesh
+   * \param aNbElems - prospective numbers of elements found by Evaluate()
+   * \retval double - the time in seconds
+   */
+  double EstimateComputeTime(SMESH_subMesh* aSubMesh, const MapShapeNbElems& aNbElems) const;
+  /*!
+   * \brief Takes into account the time of the last compute of a sub-mesh
+   *        to improve further estimations by EstimateComputeTime()
+   */
+  void LearnComputeTime(SMESH_subMesh* aSubMesh);
+
   /*!
    * \brief Sets number of segments per diagonal of boundary box of geometry by which
    *        default segment length of appropriate 1D hypotheses is defined
@@ -132,6 +147,12 @@ public:
    */
   void SetDefaultNbSegments(int nb) { _nbSegments = nb; }
   int GetDefaultNbSegments() const { return _nbSegments; }
+  /*!
+   * \brief Sets a limit of memory in MB used by all meshes; zero means no limit.
+   *        Compute of a mesh exceeding it fails with COMPERR_MEMORY_PB error
+   */
+  static void SetMemoryBudget( int megabytes );
+  static int  GetMemoryBudget();
 
   struct TAlgoStateError
   {
@@ -215,6 +236,10 @@ private:
 
   volatile bool               _compute_canceled;
   std::list< SMESH_subMesh* > _sm_current;
+
+  // algo name -> ( compute time, nb of computed nodes and elements )
+  std::map< std::string, std::pair< double, double > > _computeTimeStats;
+  mutable std::mutex                                   _computeTimeMutex;
 };
 
 #endif
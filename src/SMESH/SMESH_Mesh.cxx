@@ -518,7 +518,9 @@ int SMESH_Mesh::UNVToMesh(const char* theFileName)
 //purpose  :
 //=======================================================================
 
-int SMESH_Mesh::MEDToMesh(const char* theFileName, const char* theMeshName)
+int SMESH_Mesh::MEDToMesh(const char*                  theFileName,
+                          const char*                  theMeshName,
+                          const std::set<std::string>& theGroupsToRead)
 {
   if ( _isShapeToMesh )
     throw SALOME_Exception(LOCALIZED("a shape to mesh has already been defined"));
@@ -529,6 +531,7 @@ int SMESH_Mesh::MEDToMesh(const char* theFileName, const char* theMeshName)
   myReader.SetMeshId(-1);
   myReader.SetFile(theFileName);
   myReader.SetMeshName(theMeshName);
+  myReader.SetGroupsToRead(theGroupsToRead);
   Driver_Mesh::Status status = myReader.Perform();
 
   if (SALOME::VerbosityActivated())
@@ -542,6 +545,8 @@ int SMESH_Mesh::MEDToMesh(const char* theFileName, const char* theMeshName)
   std::list<TNameAndType>::iterator name_type = aGroupNames.begin();
   for ( ; name_type != aGroupNames.end(); name_type++ )
   {
+    if ( !theGroupsToRead.empty() && !theGroupsToRead.count( name_type->first ))
+      continue;
     SMESH_Group* aGroup = AddGroup( name_type->second, name_type->first.c_str() );
     if ( aGroup ) {
       SMESHDS_Group* aGroupDS = dynamic_cast<SMESHDS_Group*>( aGroup->GetGroupDS() );
@@ -46,6 +46,7 @@
 
 #include <map>
 #include <list>
+#include <set>
 #include <vector>
 #include <ostream>
 
@@ -133,7 +134,13 @@ class SMESH_EXPORT SMESH_Mesh
    */
   int UNVToMesh(const char* theFileName);
 
-  int MEDToMesh(const char* theFileName, const char* theMeshName);
+  /*!
+   * \brief Read a mesh from a MED file. If theGroupsToRead is not empty, only elements
+   *        of these groups and their nodes are read
+   */
+  int MEDToMesh(const char*                  theFileName,
+                const char*                  theMeshName,
+                const std::set<std::string>& theGroupsToRead = std::set<std::string>());
 
   std::string STLToMesh(const char* theFileName);
 
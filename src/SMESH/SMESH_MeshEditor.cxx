@@ -93,6 +93,7 @@
 #include <limits>
 #include <algorithm>
 #include <sstream>
+#include <unordered_map>
 
 #include <boost/tuple/tuple.hpp>
 #include <boost/container/flat_set.hpp>
@@ -105,6 +106,22 @@
 #include <smIdType.hxx>
 #include <Basics_OCCTVersion.hxx>
 
+#ifdef WITH_TBB
+
+#ifdef WIN32
+// See https://docs.microsoft.com/en-gb/cpp/porting/modifying-winver-and-win32-winnt?view=vs-2019
+// Windows 10 = 0x0A00
+#define WINVER 0x0A00
+#define _WIN32_WINNT 0x0A00
+
+#endif
+
+#include <tbb/parallel_for.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/task_arena.h>
+
+#endif
+
 #define cast2Node(elem) static_cast<const SMDS_MeshNode*>( elem )
 
 using namespace std;
@@ -564,7 +581,7 @@ void SMESH_MeshEditor::RemoveNodeWithReconnection( const SMDS_MeshNode* node )
  */
 //================================================================================
 
-void SMESH_MeshEditor::Create0DElementsOnAllNodes( const TIDSortedElemSet& elements,
+void SMESH_MeshEditor::Create0DElementsOnAllNodes( const TIDSortedElemVec& elements,
                                                    TIDSortedElemSet&       all0DElems,
                                                    const bool              duplicateElements )
 {
@@ -3857,17 +3874,17 @@ void SMESH_MeshEditor::GetLinkedNodes( const SMDS_MeshNode* theNode,
 //purpose  : Auxiliary function to treat properly nodes in periodic faces in the laplacian smoother
 //=======================================================================
 void averageBySurface( const Handle(Geom_Surface)& theSurface, const SMDS_MeshNode* refNode, 
-                        TIDSortedElemSet& nodeSet, map< const SMDS_MeshNode*, gp_XY* >& theUVMap, double * coord )
+                        TIDSortedElemSet& nodeSet, const map< const SMDS_MeshNode*, gp_XY* >& theUVMap, double * coord )
 {
   if ( theSurface.IsNull() ) 
   {
     TIDSortedElemSet::iterator nodeSetIt = nodeSet.begin();
     for ( ; nodeSetIt != nodeSet.end(); nodeSetIt++ ) 
     {
-      const SMDS_MeshNode* node = cast2Node(*nodeSetIt);
-      coord[0] += node->X();
-      coord[1] += node->Y();
-      coord[2] += node->Z();
+      SMESH_NodeXYZ node( *nodeSetIt ); // thread-safe
+      coord[0] += node.X();
+      coord[1] += node.Y();
+      coord[2] += node.Z();
     }
   }
   else
@@ -3875,7 +3892,7 @@ void averageBySurface( const Handle(Geom_Surface)& theSurface, const SMDS_MeshNo
     Standard_Real Umin,Umax,Vmin,Vmax;
     theSurface->Bounds( Umin, Umax, Vmin, Vmax );
     ASSERT( theUVMap.find( refNode ) != theUVMap.end() );
-    gp_XY* nodeUV = theUVMap[ refNode ];
+    gp_XY* nodeUV = theUVMap.at( refNode );
     Standard_Real uref = nodeUV->X();
     Standard_Real vref = nodeUV->Y();
 
@@ -3884,7 +3901,7 @@ void averageBySurface( const Handle(Geom_Surface)& theSurface, const SMDS_MeshNo
     {
       const SMDS_MeshNode* node = cast2Node(*nodeSetIt);
       ASSERT( theUVMap.find( node ) != theUVMap.end() );
-      gp_XY* uv = theUVMap[ node ];    
+      gp_XY* uv = theUVMap.at( node );    
 
       if ( theSurface->IsUPeriodic() || theSurface->IsVPeriodic() )  
       {          
@@ -3917,12 +3934,15 @@ void averageBySurface( const Handle(Geom_Surface)& theSurface, const SMDS_MeshNo
 //=======================================================================
 //function : laplacianSmooth
 //purpose  : pulls theNode toward the center of surrounding nodes directly
-//           connected to that node along an element edge
+//           connected to that node along an element edge.
+//           Compute new position of theNode, return false if it is not to move
 //=======================================================================
 
-void laplacianSmooth(const SMDS_MeshNode*                 theNode,
-                     const Handle(Geom_Surface)&          theSurface,
-                     map< const SMDS_MeshNode*, gp_XY* >& theUVMap)
+bool laplacianSmooth(const SMDS_MeshNode*                       theNode,
+                     const Handle(Geom_Surface)&                theSurface,
+                     const map< const SMDS_MeshNode*, gp_XY* >& theUVMap,
+                     gp_XYZ&                                    theNewXYZ,
+                     gp_XY&                                     theNewUV)
 {
   // find surrounding nodes
 
@@ -3936,14 +3956,14 @@ void laplacianSmooth(const SMDS_MeshNode*                 theNode,
 
   int nbNodes = nodeSet.size();
   if ( !nbNodes )
-    return;
+    return false;
 
   coord[0] /= nbNodes;
   coord[1] /= nbNodes;
 
   if ( !theSurface.IsNull() ) {
     ASSERT( theUVMap.find( theNode ) != theUVMap.end() );
-    theUVMap[ theNode ]->SetCoord( coord[0], coord[1] );
+    theNewUV.SetCoord( coord[0], coord[1] );
     gp_Pnt p3d = theSurface->Value( coord[0], coord[1] );
     coord[0] = p3d.X();
     coord[1] = p3d.Y();
@@ -3952,9 +3972,25 @@ void laplacianSmooth(const SMDS_MeshNode*                 theNode,
   else
     coord[2] /= nbNodes;
 
-  // move node
+  theNewXYZ.SetCoord( coord[0], coord[1], coord[2] );
+  return true;
+}
 
-  const_cast< SMDS_MeshNode* >( theNode )->setXYZ(coord[0],coord[1],coord[2]);
+//=======================================================================
+//function : moveSmoothedNode
+//purpose  : set a position computed by laplacianSmooth() or centroidalSmooth()
+//=======================================================================
+
+void moveSmoothedNode(const SMDS_MeshNode*                 theNode,
+                      const Handle(Geom_Surface)&          theSurface,
+                      map< const SMDS_MeshNode*, gp_XY* >& theUVMap,
+                      const gp_XYZ&                        theNewXYZ,
+                      const gp_XY&                         theNewUV)
+{
+  if ( !theSurface.IsNull() )
+    *theUVMap[ theNode ] = theNewUV;
+
+  const_cast< SMDS_MeshNode* >( theNode )->setXYZ( theNewXYZ.X(), theNewXYZ.Y(), theNewXYZ.Z() );
 }
 
 //=======================================================================
@@ -3978,7 +4014,7 @@ void correctTheValue( Standard_Real Umax, Standard_Real Umin, Standard_Real Vmax
 //purpose  : Auxiliary function to treat properly nodes in periodic faces in the centroidal smoother
 //=======================================================================
 void averageByElement( const Handle(Geom_Surface)& theSurface, const SMDS_MeshNode* refNode, const SMDS_MeshElement* elem,
-                        map< const SMDS_MeshNode*, gp_XY* >& theUVMap, SMESH::Controls::TSequenceOfXYZ& aNodePoints, 
+                        const map< const SMDS_MeshNode*, gp_XY* >& theUVMap, SMESH::Controls::TSequenceOfXYZ& aNodePoints, 
                         gp_XYZ& elemCenter )
 {
   int nn = elem->NbNodes();
@@ -3990,12 +4026,12 @@ void averageByElement( const Handle(Geom_Surface)& theSurface, const SMDS_MeshNo
   {
     const SMDS_MeshNode* aNode = static_cast<const SMDS_MeshNode*>( itN->next() );
     i++;
-    gp_XYZ aP( aNode->X(), aNode->Y(), aNode->Z() );
+    gp_XYZ aP = SMESH_NodeXYZ( aNode ); // thread-safe
     aNodePoints.push_back( aP );
     if ( !theSurface.IsNull() ) // smooth in 2D
     { 
       ASSERT( theUVMap.find( aNode ) != theUVMap.end() );
-      gp_XY* uv = theUVMap[ aNode ];
+      gp_XY* uv = theUVMap.at( aNode );
 
       if ( theSurface->IsUPeriodic() || theSurface->IsVPeriodic() )  
       {  
@@ -4009,7 +4045,7 @@ void averageByElement( const Handle(Geom_Surface)& theSurface, const SMDS_MeshNo
         }
         else
         {
-          gp_XY* refPoint = theUVMap[ refNode ];
+          gp_XY* refPoint = theUVMap.at( refNode );
           Standard_Real uref = refPoint->X();
           Standard_Real vref = refPoint->Y();
           correctTheValue( Umax, Umin, Vmax, Vmin, uref, vref, u, v ); 
@@ -4026,12 +4062,15 @@ void averageByElement( const Handle(Geom_Surface)& theSurface, const SMDS_MeshNo
 //=======================================================================
 //function : centroidalSmooth
 //purpose  : pulls theNode toward the element-area-weighted centroid of the
-//           surrounding elements
+//           surrounding elements.
+//           Compute new position of theNode, return false if it is not to move
 //=======================================================================
 
-void centroidalSmooth(const SMDS_MeshNode*                 theNode,
-                      const Handle(Geom_Surface)&          theSurface,
-                      map< const SMDS_MeshNode*, gp_XY* >& theUVMap)
+bool centroidalSmooth(const SMDS_MeshNode*                       theNode,
+                      const Handle(Geom_Surface)&                theSurface,
+                      const map< const SMDS_MeshNode*, gp_XY* >& theUVMap,
+                      gp_XYZ&                                    theNewXYZ,
+                      gp_XY&                                     theNewUV)
 {
   gp_XYZ aNewXYZ(0.,0.,0.);
   SMESH::Controls::Area anAreaFunc;
@@ -4044,7 +4083,7 @@ void centroidalSmooth(const SMDS_MeshNode*                 theNode,
   { 
     Standard_Real Umin,Umax,Vmin,Vmax;
     theSurface->Bounds( Umin, Umax, Vmin, Vmax );
-    gp_XY* uv = theUVMap[ theNode ];
+    gp_XY* uv = theUVMap.at( theNode );
     Standard_Real u = uv->X();
     Standard_Real v = uv->Y();   
     notToMoveNode = std::fabs(u - Umin) < 1e-7 || std::fabs(v - Vmin) < 1e-7 || std::fabs(u - Umax) < 1e-7 || std::fabs( v - Vmax ) < 1e-7;
@@ -4067,16 +4106,17 @@ void centroidalSmooth(const SMDS_MeshNode*                 theNode,
     elemCenter /= nn;
     aNewXYZ += elemCenter * elemArea;
   }
+  if ( notToMoveNode )
+    return false;
+
   aNewXYZ /= totalArea;
-  
-  if ( !theSurface.IsNull() && !notToMoveNode ) {
-    theUVMap[ theNode ]->SetCoord( aNewXYZ.X(), aNewXYZ.Y() );
+
+  if ( !theSurface.IsNull() ) {
+    theNewUV.SetCoord( aNewXYZ.X(), aNewXYZ.Y() );
     aNewXYZ = theSurface->Value( aNewXYZ.X(), aNewXYZ.Y() ).XYZ();
   }
-
-  // move node
-  if ( !notToMoveNode )
-    const_cast< SMDS_MeshNode* >( theNode )->setXYZ(aNewXYZ.X(),aNewXYZ.Y(),aNewXYZ.Z());
+  theNewXYZ = aNewXYZ;
+  return true;
 }
 
 //=======================================================================
@@ -4102,6 +4142,155 @@ static bool getClosestUV (Extrema_GenExtPS& projector,
   return false;
 }
 
+namespace
+{
+  typedef map< const SMDS_MeshNode*, gp_XY* > TNodeUVMap;
+
+  //================================================================================
+  /*!
+   * \brief Split movable nodes into groups of nodes not sharing faces, so that
+   *        nodes of a group can be smoothed independently of each other.
+   *        Nodes are colored greedily in the order of their IDs.
+   */
+  //================================================================================
+
+  void colorNodes( const set<const SMDS_MeshNode*>&         theNodes,
+                   vector< vector< const SMDS_MeshNode* > >& theNodeGroups )
+  {
+    vector< const SMDS_MeshNode* > nodes( theNodes.begin(), theNodes.end() );
+    std::sort( nodes.begin(), nodes.end(), TIDCompare() );
+
+    std::unordered_map< const SMDS_MeshNode*, int > nodeColor;
+    nodeColor.reserve( nodes.size() );
+    vector< bool > isColorUsed;
+
+    for ( size_t iN = 0; iN < nodes.size(); ++iN )
+    {
+      isColorUsed.assign( isColorUsed.size(), false );
+      SMDS_ElemIteratorPtr faceIt = nodes[ iN ]->GetInverseElementIterator( SMDSAbs_Face );
+      while ( faceIt->more() )
+      {
+        SMDS_ElemIteratorPtr nIt = faceIt->next()->nodesIterator();
+        while ( nIt->more() )
+        {
+          auto n2c = nodeColor.find( cast2Node( nIt->next() ));
+          if ( n2c != nodeColor.end() )
+            isColorUsed[ n2c->second ] = true;
+        }
+      }
+      int color = std::find( isColorUsed.begin(), isColorUsed.end(), false ) - isColorUsed.begin();
+      if ( color == (int) isColorUsed.size() )
+      {
+        isColorUsed.push_back( true );
+        theNodeGroups.resize( color + 1 );
+      }
+      nodeColor.insert( make_pair( nodes[ iN ], color ));
+      theNodeGroups[ color ].push_back( nodes[ iN ]);
+    }
+  }
+
+  //================================================================================
+  /*!
+   * \brief Smooth nodes group by group. New positions of nodes of a group are
+   *        computed in parallel and then set in the order of node IDs, hence
+   *        the result does not depend on the number of threads.
+   */
+  //================================================================================
+
+  struct ParallelSmoother
+  {
+    struct TNewPosition
+    {
+      gp_XYZ _xyz;
+      gp_XY  _uv;
+      bool   _toMove;
+    };
+
+    const set<const SMDS_MeshNode*>& myNodesNearSeam;
+    const Handle(Geom_Surface)&      mySurface;
+    TNodeUVMap&                      myUVMap;
+    TNodeUVMap&                      myUVMap2;
+    SMESH_MeshEditor::SmoothMethod   myMethod;
+    int                              myNbThreads;
+    vector< TNewPosition >           myNewPositions;
+#ifdef WITH_TBB
+    // surfaces are copied to threads as evaluation of some surfaces is not thread-safe
+    tbb::enumerable_thread_specific< Handle(Geom_Surface) > mySurfaces;
+#endif
+
+    ParallelSmoother( const set<const SMDS_MeshNode*>& nodesNearSeam,
+                      const Handle(Geom_Surface)&      surface,
+                      TNodeUVMap&                      uvMap,
+                      TNodeUVMap&                      uvMap2,
+                      SMESH_MeshEditor::SmoothMethod   method,
+                      int                              nbThreads )
+      : myNodesNearSeam( nodesNearSeam ), mySurface( surface ),
+        myUVMap( uvMap ), myUVMap2( uvMap2 ), myMethod( method ), myNbThreads( nbThreads )
+    {}
+
+    TNodeUVMap& uvMap( const SMDS_MeshNode* node )
+    {
+      bool map2 = ( myNodesNearSeam.find( node ) != myNodesNearSeam.end() );
+      return map2 ? myUVMap2 : myUVMap;
+    }
+
+    void compute( const vector< const SMDS_MeshNode* >& nodes,
+                  size_t iBeg, size_t iEnd, const Handle(Geom_Surface)& surface )
+    {
+      for ( size_t i = iBeg; i < iEnd; ++i )
+      {
+        TNewPosition& pos = myNewPositions[ i ];
+        if ( myMethod == SMESH_MeshEditor::LAPLACIAN )
+          pos._toMove = laplacianSmooth( nodes[ i ], surface, uvMap( nodes[ i ]), pos._xyz, pos._uv );
+        else
+          pos._toMove = centroidalSmooth( nodes[ i ], surface, uvMap( nodes[ i ]), pos._xyz, pos._uv );
+      }
+    }
+
+    //! Return max square displacement of nodes
+    double smooth( const vector< vector< const SMDS_MeshNode* > >& nodeGroups )
+    {
+      double maxDisplacement = 0;
+      for ( size_t iG = 0; iG < nodeGroups.size(); ++iG )
+      {
+        const vector< const SMDS_MeshNode* >& nodes = nodeGroups[ iG ];
+        myNewPositions.resize( nodes.size() );
+
+#ifdef WITH_TBB
+        if ( myNbThreads > 1 && nodes.size() >= 1000 ) // else no sense in parallel work
+        {
+          tbb::task_arena arena( myNbThreads );
+          arena.execute( [&]()
+          {
+            tbb::parallel_for( tbb::blocked_range<size_t>( 0, nodes.size() ),
+                               [&]( const tbb::blocked_range<size_t>& r )
+                               {
+                                 Handle(Geom_Surface)& surface = mySurfaces.local();
+                                 if ( surface.IsNull() && !mySurface.IsNull() )
+                                   surface = Handle(Geom_Surface)::DownCast( mySurface->Copy() );
+                                 compute( nodes, r.begin(), r.end(), surface );
+                               });
+          });
+        }
+        else
+#endif
+          compute( nodes, 0, nodes.size(), mySurface );
+
+        for ( size_t i = 0; i < nodes.size(); ++i )
+        {
+          const TNewPosition& pos = myNewPositions[ i ];
+          if ( !pos._toMove )
+            continue;
+          double displacement = ( SMESH_NodeXYZ( nodes[ i ]) - pos._xyz ).SquareModulus();
+          maxDisplacement = std::max( maxDisplacement, displacement );
+          moveSmoothedNode( nodes[ i ], mySurface, uvMap( nodes[ i ]), pos._xyz, pos._uv );
+        }
+      }
+      return maxDisplacement;
+    }
+  };
+}
+
 //=======================================================================
 //function : Smooth
 //purpose  : Smooth theElements during theNbIterations or until a worst
@@ -4110,6 +4299,9 @@ static bool getClosestUV (Extrema_GenExtPS& projector,
 //           If theElements is empty, the whole mesh is smoothed.
 //           theFixedNodes contains additionally fixed nodes. Nodes built
 //           on edges and boundary nodes are always fixed.
+//           If theNbThreads > 1, nodes not sharing faces are moved at once
+//           using theNbThreads threads. Smoothing stops as soon as no node
+//           moves by more than theMaxDisplacement.
 //=======================================================================
 
 void SMESH_MeshEditor::Smooth (TIDSortedElemSet &          theElems,
@@ -4117,7 +4309,9 @@ void SMESH_MeshEditor::Smooth (TIDSortedElemSet &          theElems,
                                const SmoothMethod          theSmoothMethod,
                                const int                   theNbIterations,
                                double                      theTgtAspectRatio,
-                               const bool                  the2D)
+                               const bool                  the2D,
+                               const int                   theNbThreads,
+                               const double                theMaxDisplacement)
 {
   ClearLastCreated();
 
@@ -4125,6 +4319,7 @@ void SMESH_MeshEditor::Smooth (TIDSortedElemSet &          theElems,
     theTgtAspectRatio = 1.0;
 
   const double disttol = 1.e-16;
+  const double displTol2 = std::max( disttol, theMaxDisplacement * theMaxDisplacement );
 
   SMESH::Controls::AspectRatio aQualityFunc;
 
@@ -4483,32 +4678,51 @@ void SMESH_MeshEditor::Smooth (TIDSortedElemSet &          theElems,
     // SMOOTHING //
     // -------------
 
+    // in parallel mode, nodes are moved by groups of nodes not sharing faces,
+    // the groups are found in the order of node IDs and hence do not depend
+    // on the number of threads
+    vector< vector< const SMDS_MeshNode* > > nodeGroups;
+    if ( theNbThreads > 1 )
+      colorNodes( setMovableNodes, nodeGroups );
+    ParallelSmoother parallelSmoother( nodesNearSeam, surface, uvMap, uvMap2,
+                                       theSmoothMethod, theNbThreads );
+
     int it = -1;
     double maxRatio = -1., maxDisplacement = -1.;
     set<const SMDS_MeshNode*>::iterator nodeToMove;
     for ( it = 0; it < theNbIterations; it++ ) {
       maxDisplacement = 0.;
-      nodeToMove = setMovableNodes.begin();
-      for ( ; nodeToMove != setMovableNodes.end(); nodeToMove++ ) {
-        const SMDS_MeshNode* node = (*nodeToMove);
-        gp_XYZ aPrevPos ( node->X(), node->Y(), node->Z() );
-
-        // smooth
-        bool map2 = ( nodesNearSeam.find( node ) != nodesNearSeam.end() );
-        if ( theSmoothMethod == LAPLACIAN )
-          laplacianSmooth( node, surface, map2 ? uvMap2 : uvMap );
-        else
-          centroidalSmooth( node, surface, map2 ? uvMap2 : uvMap );
+      if ( !nodeGroups.empty() )
+        maxDisplacement = parallelSmoother.smooth( nodeGroups );
+      else
+      {
+        nodeToMove = setMovableNodes.begin();
+        for ( ; nodeToMove != setMovableNodes.end(); nodeToMove++ ) {
+          const SMDS_MeshNode* node = (*nodeToMove);
+          gp_XYZ aPrevPos ( node->X(), node->Y(), node->Z() );
+
+          // smooth
+          bool map2 = ( nodesNearSeam.find( node ) != nodesNearSeam.end() );
+          gp_XYZ aNewPos;
+          gp_XY  aNewUV;
+          bool toMove;
+          if ( theSmoothMethod == LAPLACIAN )
+            toMove = laplacianSmooth( node, surface, map2 ? uvMap2 : uvMap, aNewPos, aNewUV );
+          else
+            toMove = centroidalSmooth( node, surface, map2 ? uvMap2 : uvMap, aNewPos, aNewUV );
+          if ( !toMove )
+            continue;
+          moveSmoothedNode( node, surface, map2 ? uvMap2 : uvMap, aNewPos, aNewUV );
 
-        // node displacement
-        gp_XYZ aNewPos ( node->X(), node->Y(), node->Z() );
-        Standard_Real aDispl = (aPrevPos - aNewPos).SquareModulus();
-        if ( aDispl > maxDisplacement )
-          maxDisplacement = aDispl;
+          // node displacement
+          Standard_Real aDispl = (aPrevPos - aNewPos).SquareModulus();
+          if ( aDispl > maxDisplacement )
+            maxDisplacement = aDispl;
+        }
       }
       // no node movement => exit
       //if ( maxDisplacement < 1.e-16 ) {
-      if ( maxDisplacement < disttol ) {
+      if ( maxDisplacement < displTol2 ) {
         MESSAGE("-- no node movement --");
         break;
       }
@@ -11111,7 +11325,7 @@ namespace // automatically find theAffectedElems for DoubleNodes()
  */
 //================================================================================
 
-void SMESH_MeshEditor::DoubleElements( const TIDSortedElemSet& theElements )
+void SMESH_MeshEditor::DoubleElements( const TIDSortedElemVec& theElements )
 {
   ClearLastCreated();
   SMESHDS_Mesh* mesh = GetMeshDS();
@@ -11178,9 +11392,9 @@ void SMESH_MeshEditor::DoubleElements( const TIDSortedElemSet& theElements )
 */
 //================================================================================
 
-bool SMESH_MeshEditor::DoubleNodes( const TIDSortedElemSet& theElems,
-                                    const TIDSortedElemSet& theNodesNot,
-                                    const TIDSortedElemSet& theAffectedElems )
+bool SMESH_MeshEditor::DoubleNodes( const TIDSortedElemVec& theElems,
+                                    const TIDSortedElemVec& theNodesNot,
+                                    const TIDSortedElemVec& theAffectedElems )
 {
   ClearLastCreated();
 
@@ -11213,8 +11427,8 @@ bool SMESH_MeshEditor::DoubleNodes( const TIDSortedElemSet& theElems,
 //================================================================================
 
 bool SMESH_MeshEditor::doubleNodes(SMESHDS_Mesh*           theMeshDS,
-                                   const TIDSortedElemSet& theElems,
-                                   const TIDSortedElemSet& theNodesNot,
+                                   const TIDSortedElemVec& theElems,
+                                   const TIDSortedElemVec& theNodesNot,
                                    TNodeNodeMap&           theNodeNodeMap,
                                    const bool              theIsDoubleElem )
 {
@@ -11223,7 +11437,7 @@ bool SMESH_MeshEditor::doubleNodes(SMESHDS_Mesh*           theMeshDS,
   std::vector<const SMDS_MeshNode*> newNodes;
   ElemFeatures elemType;
 
-  TIDSortedElemSet::const_iterator elemItr = theElems.begin();
+  TIDSortedElemVec::const_iterator elemItr = theElems.begin();
   for ( ;  elemItr != theElems.end(); ++elemItr )
   {
     const SMDS_MeshElement* anElem = *elemItr;
@@ -11495,8 +11709,8 @@ bool SMESH_MeshEditor::AffectedElemGroupsInRegion( const TIDSortedElemSet& theEl
 */
 //================================================================================
 
-bool SMESH_MeshEditor::DoubleNodesInRegion( const TIDSortedElemSet& theElems,
-                                            const TIDSortedElemSet& theNodesNot,
+bool SMESH_MeshEditor::DoubleNodesInRegion( const TIDSortedElemVec& theElems,
+                                            const TIDSortedElemVec& theNodesNot,
                                             const TopoDS_Shape&     theShape )
 {
   if ( theShape.IsNull() )
@@ -11516,8 +11730,8 @@ bool SMESH_MeshEditor::DoubleNodesInRegion( const TIDSortedElemSet& theElems,
   }
 
   // iterates on indicated elements and get elements by back references from their nodes
-  TIDSortedElemSet anAffected;
-  TIDSortedElemSet::const_iterator elemItr = theElems.begin();
+  std::vector< const SMDS_MeshElement* > affected;
+  TIDSortedElemVec::const_iterator elemItr = theElems.begin();
   for ( ;  elemItr != theElems.end(); ++elemItr )
   {
     SMDS_MeshElement* anElem = (SMDS_MeshElement*)*elemItr;
@@ -11538,10 +11752,12 @@ bool SMESH_MeshEditor::DoubleNodesInRegion( const TIDSortedElemSet& theElems,
              ( bsc3d ?
                isInside( curElem, *bsc3d, aTol ) :
                isInside( curElem, *aFaceClassifier, aTol )))
-          anAffected.insert( curElem );
+          affected.push_back( curElem );
       }
     }
   }
+  TIDSortedElemVec anAffected;
+  SMESHUtils::InsertSortedByID( affected, anAffected );
   return DoubleNodes( theElems, theNodesNot, anAffected );
 }
 
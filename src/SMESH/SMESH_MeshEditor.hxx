@@ -135,7 +135,7 @@ public:
   // Remove a node or an element.
   // Modify a compute state of sub-meshes which become empty
 
-  void Create0DElementsOnAllNodes( const TIDSortedElemSet& elements,
+  void Create0DElementsOnAllNodes( const TIDSortedElemVec& elements,
                                    TIDSortedElemSet&       all0DElems,
                                    const bool              duplicateElements);
   // Create 0D elements on all nodes of the given. \a all0DElems returns
@@ -277,7 +277,9 @@ public:
                const SmoothMethod               theSmoothMethod,
                const int                        theNbIterations,
                double                           theTgtAspectRatio = 1.0,
-               const bool                       the2D = true);
+               const bool                       the2D = true,
+               const int                        theNbThreads = 1,
+               const double                     theMaxDisplacement = 0.);
   // Smooth theElements using theSmoothMethod during theNbIterations
   // or until a worst element has aspect ratio <= theTgtAspectRatio.
   // Aspect Ratio varies in range [1.0, inf].
@@ -286,6 +288,9 @@ public:
   // on edges and boundary nodes are always fixed.
   // If the2D, smoothing is performed using UV parameters of nodes
   // on geometrical faces
+  // If theNbThreads > 1, nodes not sharing faces are moved simultaneously
+  // by theNbThreads threads; the result does not depend on theNbThreads.
+  // Smoothing stops as soon as no node moves by more than theMaxDisplacement.
 
   typedef TIDTypeCompare TElemSort;
   typedef std::map < const SMDS_MeshElement*,
@@ -699,22 +704,22 @@ public:
   // Return an index of the shape theElem is on
   // or zero if a shape not found
 
-  void DoubleElements( const TIDSortedElemSet& theElements );
+  void DoubleElements( const TIDSortedElemVec& theElements );
 
   bool DoubleNodes( const std::list< int >& theListOfNodes, 
                     const std::list< int >& theListOfModifiedElems );
   
-  bool DoubleNodes( const TIDSortedElemSet& theElems, 
-                    const TIDSortedElemSet& theNodesNot,
-                    const TIDSortedElemSet& theAffectedElems );
+  bool DoubleNodes( const TIDSortedElemVec& theElems, 
+                    const TIDSortedElemVec& theNodesNot,
+                    const TIDSortedElemVec& theAffectedElems );
 
   bool AffectedElemGroupsInRegion( const TIDSortedElemSet& theElems,
                                    const TIDSortedElemSet& theNodesNot,
                                    const TopoDS_Shape&     theShape,
                                    TIDSortedElemSet& theAffectedElems);
 
-  bool DoubleNodesInRegion( const TIDSortedElemSet& theElems, 
-                            const TIDSortedElemSet& theNodesNot,
+  bool DoubleNodesInRegion( const TIDSortedElemVec& theElems, 
+                            const TIDSortedElemVec& theNodesNot,
                             const TopoDS_Shape&     theShape );
   
   double OrientedAngle(const gp_Pnt& p0, const gp_Pnt& p1, const gp_Pnt& g1, const gp_Pnt& g2);
@@ -831,8 +836,8 @@ public:
                                    std::list<double>& theScales);
 
   bool doubleNodes( SMESHDS_Mesh*           theMeshDS,
-                    const TIDSortedElemSet& theElems,
-                    const TIDSortedElemSet& theNodesNot,
+                    const TIDSortedElemVec& theElems,
+                    const TIDSortedElemVec& theNodesNot,
                     TNodeNodeMap&           theNodeNodeMap,
                     const bool              theIsDoubleElem );
 
@@ -118,6 +118,18 @@ void SMESH_ParallelMesh::DeleteTmpFolder()
     fs::remove_all(tmp_folder);
 }
 
+//=============================================================================
+/*!
+ * \brief Return the MED file of the mesh of dimension lower than the parallelism
+ *        one. Algos running remotely read the mesh of the boundary from it
+ */
+//=============================================================================
+fs::path SMESH_ParallelMesh::GetLowerDimMeshFile()
+{
+  std::string file_name = "Mesh" + std::to_string(_paraDim - 1) + "D.med";
+  return tmp_folder / fs::path(file_name);
+}
+
 //=============================================================================
 /*!
  * \brief Get the number of Threads to be used for the pool of Threads
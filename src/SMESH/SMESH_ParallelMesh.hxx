@@ -79,6 +79,21 @@ class SMESH_EXPORT SMESH_ParallelMesh: public SMESH_Mesh
   boost::filesystem::path GetTmpFolder() {return tmp_folder;};
   void cleanup();
 
+  // MED file of the mesh of dimension lower than the parallelism one,
+  // written before computing sub-meshes of the parallelism dimension
+  boost::filesystem::path GetLowerDimMeshFile();
+
+  // Times [s] of stages of the last parallel compute
+  struct StageTimes
+  {
+    double _computeLowerDim = 0.; // compute of sub-meshes of lower dimension
+    double _exportLowerDim  = 0.; // export of the lower dimension mesh to MED
+    double _sendLowerDim    = 0.; // copy of the MED file to the remote resource
+    double _computeParaDim  = 0.; // compute of sub-meshes of the parallelism dimension
+  };
+  const StageTimes& GetStageTimes() const {return _stageTimes;};
+  void SetStageTimes(const StageTimes& times) {_stageTimes = times;};
+
   //
   bool IsParallel() override {return true;};
   int GetParallelElement() override;
@@ -132,8 +147,9 @@ class SMESH_EXPORT SMESH_ParallelMesh: public SMESH_Mesh
   SMESH_ParallelMesh(const SMESH_ParallelMesh& aMesh):SMESH_Mesh(aMesh) {};
  private:
   // Mutex for multhitreading write in SMESH_Mesh
+  // (recursive as a sub-mesh computed under the lock may lock the mesh again)
 #ifndef WIN32
-  boost::mutex _my_lock;
+  boost::recursive_mutex _my_lock;
   // thread pool for computation
   boost::asio::thread_pool *     _pool = nullptr;
 #endif
@@ -149,5 +165,7 @@ class SMESH_EXPORT SMESH_ParallelMesh: public SMESH_Mesh
   std::string _resource = "";
   std::string _wcKey = "P11N0:SALOME";
   std::string _walltime = "01:00:00";
+
+  StageTimes _stageTimes;
 };
 #endif
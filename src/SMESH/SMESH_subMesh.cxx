@@ -57,6 +57,7 @@
 #include <Standard_OutOfMemory.hxx>
 #include <Standard_ErrorHandler.hxx>
 
+#include <chrono>
 #include <numeric>
 
 using namespace std;
@@ -110,6 +111,7 @@ SMESH_subMesh::SMESH_subMesh(int                  Id,
   }
   _computeCost = 0; // how costly is to compute this sub-mesh
   _realComputeCost = 0;
+  _computeTime = 0.;
   _allowedSubShapes = nullptr;
 }
 
@@ -1559,6 +1561,7 @@ bool SMESH_subMesh::ComputeStateEngine(compute_event event)
         ret = false;
         _computeState = FAILED_TO_COMPUTE;
         _computeError = SMESH_ComputeError::New(COMPERR_OK,"",algo);
+        const auto computeStart = std::chrono::steady_clock::now();
         try {
           OCC_CATCH_SIGNALS;
 
@@ -1631,6 +1634,8 @@ bool SMESH_subMesh::ComputeStateEngine(compute_event event)
             ret = false;
         }
         std::cout.rdbuf( coutBuffer ); // restore cout that could be redirected by algo
+        _computeTime = std::chrono::duration< double >( std::chrono::steady_clock::now() -
+                                                        computeStart ).count();
 
         // check if an error reported on any sub-shape
         bool isComputeErrorSet = !checkComputeError( algo, ret, shape );
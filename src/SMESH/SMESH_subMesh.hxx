@@ -279,6 +279,9 @@ public:
   int GetComputeCost() const;
   // how costly is to compute this sub-mesh
 
+  double GetComputeTime() const { return _computeTime; }
+  // real time [s] spent by the algo at the last compute of this sub-mesh
+
   /*!
    * \brief  Find common submeshes (based on shared subshapes with other
    * \param theOther submesh to check
@@ -349,6 +352,7 @@ protected:
   SMESH_ComputeErrorPtr _computeError;
   int                   _computeCost;     // how costly is to compute this sub-mesh
   int                   _realComputeCost; // _computeCost depending on presence of needed hypotheses
+  double                _computeTime;     // real time [s] of the last algo->Compute()
 
   // allow algo->Compute() if a sub-shape of lower dim is meshed but
   // none mesh entity is bound to it. Eg StdMeshers_CompositeSegment_1D can
@@ -466,7 +466,7 @@ smIdType SMESHDS_Command::GetNumber()
 //function : 
 //purpose  : 
 //=======================================================================
-const list < smIdType >&SMESHDS_Command::GetIndexes()
+const vector < smIdType >&SMESHDS_Command::GetIndexes()
 {
         return myIntegers;
 }
@@ -475,7 +475,7 @@ const list < smIdType >&SMESHDS_Command::GetIndexes()
 //function : 
 //purpose  : 
 //=======================================================================
-const list < double >&SMESHDS_Command::GetCoords()
+const vector < double >&SMESHDS_Command::GetCoords()
 {
         return myReals;
 }
@@ -825,3 +825,33 @@ void SMESHDS_Command::AddBall(smIdType NewBallID, smIdType node, double diameter
   myReals.push_back(diameter);
   myNumber++;
 }
+
+//=======================================================================
+//function : AddElement
+//purpose  : Record adding an element of any type having a fixed number of nodes
+//=======================================================================
+
+void SMESHDS_Command::AddElement(smIdType NewElemID, const std::vector<smIdType>& nodes_ids)
+{
+  switch ( myType )
+  {
+  case SMESHDS_AddNode:
+  case SMESHDS_AddPolygon:
+  case SMESHDS_AddQuadPolygon:
+  case SMESHDS_AddPolyhedron:
+  case SMESHDS_AddBall:
+  case SMESHDS_RemoveNode:
+  case SMESHDS_RemoveElement:
+  case SMESHDS_MoveNode:
+  case SMESHDS_ChangeElementNodes:
+  case SMESHDS_ChangePolyhedronNodes:
+  case SMESHDS_Renumber:
+  case SMESHDS_ClearAll:
+    MESSAGE("SMESHDS_Command::AddElement : Bad Type");
+    return;
+  default:;
+  }
+  myIntegers.push_back(NewElemID);
+  myIntegers.insert(myIntegers.end(), nodes_ids.begin(), nodes_ids.end());
+  myNumber++;
+}
@@ -31,7 +31,6 @@
 
 #include "SMESHDS_CommandType.hxx"
 #include <smIdType.hxx>
-#include <list>
 #include <vector>
 
 class SMESHDS_EXPORT SMESHDS_Command
@@ -64,6 +63,8 @@ class SMESHDS_EXPORT SMESHDS_Command
                                   const std::vector<smIdType>& nodes_ids,
                                   const std::vector<int>&      quantities);
         void AddBall(smIdType NewBallID, smIdType node, double diameter);
+        // add an element of any type having a fixed number of nodes
+        void AddElement(smIdType NewElemID, const std::vector<smIdType>& nodes_ids);
         // special methods for quadratic elements
         void AddEdge(smIdType NewEdgeID, smIdType n1, smIdType n2, smIdType n12);
         void AddFace(smIdType NewFaceID, smIdType n1, smIdType n2, smIdType n3,
@@ -113,13 +114,13 @@ class SMESHDS_EXPORT SMESHDS_Command
         void Renumber (const bool isNodes, const smIdType startID, const smIdType deltaID);
         SMESHDS_CommandType GetType();
         smIdType GetNumber();
-        const std::list<smIdType> & GetIndexes();
-        const std::list<double> & GetCoords();
+        const std::vector<smIdType> & GetIndexes();
+        const std::vector<double> & GetCoords();
          ~SMESHDS_Command();
   private:
         SMESHDS_CommandType myType;
         int myNumber;
-        std::list<double> myReals;
-        std::list<smIdType> myIntegers;
+        std::vector<double> myReals;      // coordinates of all logged nodes
+        std::vector<smIdType> myIntegers; // IDs of all logged elements and their nodes
 };
 #endif
@@ -836,6 +836,173 @@ SMDS_MeshVolume* SMESHDS_Mesh::AddPolyhedralVolume
   return anElem;
 }
 
+//=======================================================================
+//function : AddNodesWithID
+//purpose  : Create nodes at once
+//=======================================================================
+
+smIdType SMESHDS_Mesh::AddNodesWithID( const smIdType                     nbNodes,
+                                       const double*                      coords,
+                                       const smIdType*                    nodeIDs,
+                                       std::vector<const SMDS_MeshNode*>* newNodes )
+{
+  if ( myIsEmbeddedMode )
+  {
+    smIdType nbAdded = 0;
+    try
+    {
+      nbAdded = SMDS_Mesh::AddNodesWithID( nbNodes, coords, nodeIDs, newNodes );
+    }
+    catch ( ... )
+    {
+      myScript->SetModified( true ); // some can be created before an exception
+      throw;
+    }
+    if ( nbAdded > 0 )
+      myScript->SetModified( true );
+    return nbAdded;
+  }
+
+  std::vector<const SMDS_MeshNode*> nodes;
+  if ( !newNodes )
+    newNodes = & nodes;
+  try
+  {
+    SMDS_Mesh::AddNodesWithID( nbNodes, coords, nodeIDs, newNodes );
+  }
+  catch ( ... )
+  {
+    // log nodes created before an exception
+    logNodes( *newNodes, coords );
+    throw;
+  }
+  logNodes( *newNodes, coords );
+
+  return newNodes->size();
+}
+
+//=======================================================================
+//function : AddElementsWithID
+//purpose  : Create elements of one type at once
+//=======================================================================
+
+smIdType SMESHDS_Mesh::AddElementsWithID( const SMDSAbs_EntityType              type,
+                                          const smIdType                        nbElems,
+                                          const smIdType*                       nodeIDs,
+                                          const smIdType*                       elemIDs,
+                                          std::vector<const SMDS_MeshElement*>* newElems )
+{
+  if ( myIsEmbeddedMode )
+  {
+    smIdType nbAdded = 0;
+    try
+    {
+      nbAdded = SMDS_Mesh::AddElementsWithID( type, nbElems, nodeIDs, elemIDs, newElems );
+    }
+    catch ( ... )
+    {
+      myScript->SetModified( true ); // some can be created before an exception
+      throw;
+    }
+    if ( nbAdded > 0 )
+      myScript->SetModified( true );
+    return nbAdded;
+  }
+
+  std::vector<const SMDS_MeshElement*> elems;
+  if ( !newElems )
+    newElems = & elems;
+  try
+  {
+    SMDS_Mesh::AddElementsWithID( type, nbElems, nodeIDs, elemIDs, newElems );
+  }
+  catch ( ... )
+  {
+    // log elements created before an exception
+    logElements( *newElems );
+    throw;
+  }
+  logElements( *newElems );
+
+  return newElems->size();
+}
+
+//=======================================================================
+//function : AddElementsWithID
+//purpose  : Create elements of any types at once
+//=======================================================================
+
+smIdType SMESHDS_Mesh::AddElementsWithID( const smIdType                        nbElems,
+                                          const SMDSAbs_EntityType*             types,
+                                          const smIdType*                       offsets,
+                                          const smIdType*                       nodeIDs,
+                                          const smIdType*                       elemIDs,
+                                          std::vector<const SMDS_MeshElement*>* newElems )
+{
+  if ( myIsEmbeddedMode )
+  {
+    smIdType nbAdded = 0;
+    try
+    {
+      nbAdded = SMDS_Mesh::AddElementsWithID( nbElems, types, offsets, nodeIDs, elemIDs, newElems );
+    }
+    catch ( ... )
+    {
+      myScript->SetModified( true ); // some can be created before an exception
+      throw;
+    }
+    if ( nbAdded > 0 )
+      myScript->SetModified( true );
+    return nbAdded;
+  }
+
+  std::vector<const SMDS_MeshElement*> elems;
+  if ( !newElems )
+    newElems = & elems;
+  try
+  {
+    SMDS_Mesh::AddElementsWithID( nbElems, types, offsets, nodeIDs, elemIDs, newElems );
+  }
+  catch ( ... )
+  {
+    // log elements created before an exception
+    logElements( *newElems );
+    throw;
+  }
+  logElements( *newElems );
+
+  return newElems->size();
+}
+
+//=======================================================================
+//function : logNodes
+//purpose  : Record creation of nodes in the script
+//=======================================================================
+
+void SMESHDS_Mesh::logNodes( const std::vector<const SMDS_MeshNode*>& nodes,
+                             const double*                            coords )
+{
+  for ( size_t i = 0; i < nodes.size(); ++i, coords += 3 )
+    myScript->AddNode( nodes[i]->GetID(), coords[0], coords[1], coords[2] );
+}
+
+//=======================================================================
+//function : logElements
+//purpose  : Record creation of elements in the script
+//=======================================================================
+
+void SMESHDS_Mesh::logElements( const std::vector<const SMDS_MeshElement*>& elems )
+{
+  std::vector<smIdType> nodes_ids;
+  for ( const SMDS_MeshElement* elem : elems )
+  {
+    nodes_ids.resize( elem->NbNodes() );
+    for ( size_t i = 0; i < nodes_ids.size(); ++i )
+      nodes_ids[i] = elem->GetNode( i )->GetID();
+    myScript->AddElement( elem->GetID(), elem->GetEntityType(), nodes_ids );
+  }
+}
+
 //=======================================================================
 //function : removeFromContainers
 //purpose  :
@@ -609,6 +609,22 @@ class SMESHDS_EXPORT SMESHDS_Mesh : public SMDS_Mesh
     (const std::vector<const SMDS_MeshNode*>& nodes,
      const std::vector<int>&                  quantities);
 
+  virtual smIdType AddNodesWithID( const smIdType                      nbNodes,
+                                   const double*                       coords,
+                                   const smIdType*                     nodeIDs = 0,
+                                   std::vector<const SMDS_MeshNode*>*  newNodes = 0 );
+  virtual smIdType AddElementsWithID( const SMDSAbs_EntityType              type,
+                                      const smIdType                        nbElems,
+                                      const smIdType*                       nodeIDs,
+                                      const smIdType*                       elemIDs = 0,
+                                      std::vector<const SMDS_MeshElement*>* newElems = 0 );
+  virtual smIdType AddElementsWithID( const smIdType                        nbElems,
+                                      const SMDSAbs_EntityType*             types,
+                                      const smIdType*                       offsets,
+                                      const smIdType*                       nodeIDs,
+                                      const smIdType*                       elemIDs = 0,
+                                      std::vector<const SMDS_MeshElement*>* newElems = 0 );
+
   virtual void MoveNode(const SMDS_MeshNode *, double x, double y, double z);
   virtual void RemoveNode(const SMDS_MeshNode *);
   void RemoveElement(const SMDS_MeshElement *);
@@ -709,6 +725,8 @@ class SMESHDS_EXPORT SMESHDS_Mesh : public SMDS_Mesh
   bool                       myIsEmbeddedMode;
 
   int add( const SMDS_MeshElement* elem, SMESHDS_SubMesh* subMesh );
+  void logNodes( const std::vector<const SMDS_MeshNode*>& nodes, const double* coords );
+  void logElements( const std::vector<const SMDS_MeshElement*>& elems );
   SMESHDS_SubMesh* getSubmesh( const TopoDS_Shape & shape);
 
   // Index the regular grid associated to the mesh in the geometry index
@@ -298,6 +298,54 @@ void SMESHDS_Script::AddBall(smIdType NewBallID, smIdType node, double diameter)
     getCommand(SMESHDS_AddBall)->AddBall(NewBallID, node, diameter);
 }
 
+//=======================================================================
+//function : AddElement
+//purpose  : Record adding an element of any type except polyhedron and ball
+//=======================================================================
+
+void SMESHDS_Script::AddElement(smIdType                     NewElemID,
+                                SMDSAbs_EntityType           type,
+                                const std::vector<smIdType>& nodes_ids)
+{
+  if(myIsEmbeddedMode){
+    myIsModified = true;
+    return;
+  }
+  SMESHDS_CommandType comType;
+  switch ( type )
+  {
+  case SMDSEntity_0D:               comType = SMESHDS_Add0DElement;         break;
+  case SMDSEntity_Edge:             comType = SMESHDS_AddEdge;              break;
+  case SMDSEntity_Quad_Edge:        comType = SMESHDS_AddQuadEdge;          break;
+  case SMDSEntity_Triangle:         comType = SMESHDS_AddTriangle;          break;
+  case SMDSEntity_Quad_Triangle:    comType = SMESHDS_AddQuadTriangle;      break;
+  case SMDSEntity_BiQuad_Triangle:  comType = SMESHDS_AddBiQuadTriangle;    break;
+  case SMDSEntity_Quadrangle:       comType = SMESHDS_AddQuadrangle;        break;
+  case SMDSEntity_Quad_Quadrangle:  comType = SMESHDS_AddQuadQuadrangle;    break;
+  case SMDSEntity_BiQuad_Quadrangle:comType = SMESHDS_AddBiQuadQuadrangle;  break;
+  case SMDSEntity_Tetra:            comType = SMESHDS_AddTetrahedron;       break;
+  case SMDSEntity_Quad_Tetra:       comType = SMESHDS_AddQuadTetrahedron;   break;
+  case SMDSEntity_Pyramid:          comType = SMESHDS_AddPyramid;           break;
+  case SMDSEntity_Quad_Pyramid:     comType = SMESHDS_AddQuadPyramid;       break;
+  case SMDSEntity_Hexa:             comType = SMESHDS_AddHexahedron;        break;
+  case SMDSEntity_Quad_Hexa:        comType = SMESHDS_AddQuadHexahedron;    break;
+  case SMDSEntity_TriQuad_Hexa:     comType = SMESHDS_AddTriQuadHexa;       break;
+  case SMDSEntity_Penta:            comType = SMESHDS_AddPrism;             break;
+  case SMDSEntity_Quad_Penta:       comType = SMESHDS_AddQuadPentahedron;   break;
+  case SMDSEntity_BiQuad_Penta:     comType = SMESHDS_AddBiQuadPentahedron; break;
+  case SMDSEntity_Hexagonal_Prism:  comType = SMESHDS_AddHexagonalPrism;    break;
+  case SMDSEntity_Polygon:
+    AddPolygonalFace( NewElemID, nodes_ids );
+    return;
+  case SMDSEntity_Quad_Polygon:
+    AddQuadPolygonalFace( NewElemID, nodes_ids );
+    return;
+  default: // polyhedra and balls are not defined by nodes only
+    return;
+  }
+  getCommand(comType)->AddElement(NewElemID, nodes_ids);
+}
+
 //=======================================================================
 //function : 
 //purpose  : 
@@ -31,6 +31,7 @@
 
 #include "SMESHDS_Command.hxx"
 
+#include <SMDSAbs_ElementType.hxx>
 #include <smIdType.hxx>
 
 #include <list>
@@ -72,6 +73,8 @@ class SMESHDS_EXPORT SMESHDS_Script
                                   const std::vector<smIdType>& nodes_ids,
                                   const std::vector<int>&      quantities);
         void AddBall(smIdType NewBallID, smIdType node, double diameter);
+        void AddElement(smIdType NewElemID, SMDSAbs_EntityType type,
+                        const std::vector<smIdType>& nodes_ids);
 
         // special methods for quadratic elements
         void AddEdge(smIdType NewEdgeID, smIdType n1, smIdType n2, smIdType n12);
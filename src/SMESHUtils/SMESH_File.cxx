@@ -38,6 +38,9 @@
 
 #include <Basics_Utils.hxx>
 
+#include <cmath>
+#include <cstdlib>
+
 namespace boofs = boost::filesystem;
 
 //================================================================================
@@ -311,6 +314,133 @@ bool SMESH_File::getInts(std::vector<int>& ints)
   return ( i == ints.size() );
 }
 
+namespace
+{
+  //================================================================================
+  /*!
+   * \brief Read a real number starting at \a pos independently of the current locale.
+   *        Return a position after the read number
+   */
+  //================================================================================
+
+  const char* readDouble( const char* pos, const char* end, double& value )
+  {
+    // powers of 10 exactly represented by a double
+    static const double p10[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                  1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                  1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    const int maxP10 = 22;
+    const unsigned long long maxExactMantissa = 1ULL << 53;
+
+    bool isNeg = false;
+    if ( *pos == '-' || *pos == '+' )
+      isNeg = ( *pos++ == '-' );
+
+    // 19 significant digits fit into unsigned long long
+    const char* digitsBeg = pos;
+    unsigned long long mantissa = 0;
+    int nbDigits = 0, exp10 = 0, nbFracDigits = 0;
+    bool isTruncated = false;
+    for ( ; pos < end && isdigit( *pos ); ++pos )
+    {
+      if ( nbDigits < 19 )
+      {
+        mantissa = 10 * mantissa + ( *pos - '0' );
+        nbDigits += ( mantissa > 0 );
+      }
+      else
+      {
+        ++exp10;
+        isTruncated |= ( *pos != '0' );
+      }
+    }
+    if ( pos < end && *pos == '.' )
+    {
+      for ( ++pos; pos < end && isdigit( *pos ); ++pos, ++nbFracDigits )
+        if ( nbDigits < 19 )
+        {
+          mantissa = 10 * mantissa + ( *pos - '0' );
+          nbDigits += ( mantissa > 0 );
+          --exp10;
+        }
+        else
+        {
+          isTruncated |= ( *pos != '0' );
+        }
+    }
+    const char* digitsEnd = pos;
+
+    // 'D' is an exponent mark in Fortran
+    int e = 0;
+    if ( pos < end && ( *pos == 'e' || *pos == 'E' || *pos == 'd' || *pos == 'D' ))
+    {
+      const char* ePos = pos + 1;
+      bool isNegExp = false;
+      if ( ePos < end && ( *ePos == '-' || *ePos == '+' ))
+        isNegExp = ( *ePos++ == '-' );
+      if ( ePos < end && isdigit( *ePos ))
+      {
+        for ( pos = ePos; pos < end && isdigit( *pos ); ++pos )
+          if ( e < 10000 )
+            e = 10 * e + ( *pos - '0' );
+        if ( isNegExp )
+          e = -e;
+        exp10 += e;
+      }
+    }
+
+    if ( !isTruncated && mantissa <= maxExactMantissa && std::abs( exp10 ) <= maxP10 )
+    {
+      // both the mantissa and the power of 10 are exact, so is their product
+      value = double( mantissa );
+      if ( exp10 > 0 )
+        value *= p10[ exp10 ];
+      else if ( exp10 < 0 )
+        value /= p10[ -exp10 ];
+    }
+    else
+    {
+      // let strtod() round correctly; the number is re-written without
+      // the decimal point in order not to depend on the current locale
+      std::string number;
+      number.reserve( digitsEnd - digitsBeg + 8 );
+      for ( const char* d = digitsBeg; d < digitsEnd; ++d )
+        if ( isdigit( *d ))
+          number += *d;
+      number += 'e';
+      number += std::to_string( e - nbFracDigits );
+      value = strtod( number.c_str(), nullptr );
+    }
+    if ( isNeg )
+      value = -value;
+
+    return pos;
+  }
+}
+
+//================================================================================
+/*!
+ * \brief Fill vector by reading out real numbers from file. Vector size gives number
+ * of numbers to read. Numbers are read independently of the current locale.
+ */
+//================================================================================
+
+bool SMESH_File::getDoubles(std::vector<double>& values)
+{
+  size_t i = 0;
+  while ( i < values.size() )
+  {
+    while ( !eof() &&
+            !isdigit( *_pos ) &&
+            !( *_pos == '.' && _pos + 1 < _end && isdigit( _pos[1] )))
+      ++_pos;
+    if ( eof() ) break;
+    if ( _pos > (const char*)_map && ( _pos[-1] == '-' || _pos[-1] == '+' )) --_pos;
+    _pos = readDouble( _pos, _end, values[ i++ ]);
+  }
+  return ( i == values.size() );
+}
+
 //================================================================================
 /*!
  * \brief Open for binary writing only.
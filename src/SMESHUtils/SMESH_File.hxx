@@ -86,6 +86,8 @@ public:
 
   bool getInts(std::vector<int>& ids);
 
+  bool getDoubles(std::vector<double>& values);
+
   // ------------------------
   // Writing a binary file
   // ------------------------
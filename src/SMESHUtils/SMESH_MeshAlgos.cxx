@@ -28,7 +28,6 @@
 
 #include "SMESH_MeshAlgos.hxx"
 
-#include "ObjectPool.hxx"
 #include "SMDS_FaceOfNodes.hxx"
 #include "SMDS_LinearEdge.hxx"
 #include "SMDS_Mesh.hxx"
@@ -48,10 +47,26 @@
 #include <NCollection_DataMap.hxx>
 
 #include <limits>
+#include <memory>
 #include <numeric>
 
 #include <boost/container/flat_set.hpp>
 
+#ifdef WITH_TBB
+
+#ifdef WIN32
+// See https://docs.microsoft.com/en-gb/cpp/porting/modifying-winver-and-win32-winnt?view=vs-2019
+// Windows 10 = 0x0A00  
+#define WINVER 0x0A00
+#define _WIN32_WINNT 0x0A00
+
+#endif
+
+#include <tbb/parallel_for.h>
+#include <tbb/enumerable_thread_specific.h>
+
+#endif
+
 //=======================================================================
 /*!
  * \brief Implementation of search for the node closest to point
@@ -219,11 +234,17 @@ namespace // Utils used in SMESH_ElementSearcherImpl::FindElementsByPoint()
 
   //=======================================================================
   /*!
-   * \brief Octal tree of bounding boxes of elements
+   * \brief Bounding volume hierarchy of bounding boxes of elements.
+   *
+   * The binary tree is built by splitting elements at the median of their box
+   * centers along the longest side. Tree nodes are stored depth-first in one
+   * array, the first child of a node follows it. Boxes of elements are stored
+   * contiguously in the order of leaves. Queries do not modify the tree and
+   * can be run by several threads.
    */
   //=======================================================================
 
-  class ElementBndBoxTree : public SMESH_Octree
+  class ElementBndBoxTree
   {
   public:
 
@@ -233,41 +254,36 @@ namespace // Utils used in SMESH_ElementSearcherImpl::FindElementsByPoint()
                       SMDSAbs_ElementType  elemType,
                       SMDS_ElemIteratorPtr theElemIt = SMDS_ElemIteratorPtr(),
                       double               tolerance = NodeRadius );
-    void getElementsNearPoint( const gp_Pnt& point, TElemSeq& foundElems );
-    void getElementsNearLine ( const gp_Ax1& line,  TElemSeq& foundElems );
-    void getElementsInBox    ( const Bnd_B3d& box,  TElemSeq& foundElems );
-    void getElementsInSphere ( const gp_XYZ& center, const double radius, TElemSeq& foundElems );
-    ElementBndBoxTree* getLeafAtPoint( const gp_XYZ& point );
-    int  getNbElements();
-
-  protected:
-    ElementBndBoxTree() {}
-    SMESH_Octree* newChild() const { return new ElementBndBoxTree; }
-    void          buildChildrenData();
-    Bnd_B3d*      buildRootBox();
+    void getElementsNearPoint( const gp_Pnt& point, TElemSeq& foundElems ) const;
+    void getElementsNearLine ( const gp_Ax1& line,  TElemSeq& foundElems ) const;
+    void getElementsInBox    ( const Bnd_B3d& box,  TElemSeq& foundElems ) const;
+    void getElementsInSphere ( const gp_XYZ& center, const double radius, TElemSeq& foundElems ) const;
+    const Bnd_B3d* getLeafBoxAtPoint( const gp_XYZ& point ) const;
+    const Bnd_B3d* getBox() const { return & _rootBox; }
+    double maxSize() const;
+    double leafSize() const { return _leafSize; }
+    int  getNbElements() const { return (int) _elements.size(); }
+
   private:
-    //!< Bounding box of element
-    struct ElementBox : public Bnd_B3d
+
+    struct TNode
     {
-      const SMDS_MeshElement* _element;
-      void init(const SMDS_MeshElement* elem, double tolerance);
+      Bnd_B3d _box;
+      int     _child2;  // index of the second child; -1 for a leaf
+      int     _first;   // index of the first element box of a leaf
+      int     _nbElems; // nb of elements of a leaf
     };
-    std::vector< ElementBox* > _elements;
-    //std::string _name;
+    std::vector< TNode >                   _nodes;
+    std::vector< Bnd_B3d >                 _boxes;    // boxes of _elements
+    std::vector< const SMDS_MeshElement* > _elements;
+    Bnd_B3d                                _rootBox;
+    double                                 _leafSize; // mean size of leaf boxes
 
-    typedef ObjectPool< ElementBox > TElementBoxPool;
+    int  build( std::vector< int >& order, const std::vector< gp_XYZ >& centers,
+                const std::vector< Bnd_B3d >& boxes, int begin, int end );
 
-    //!< allocator of ElementBox's and SMESH_TreeLimit
-    struct LimitAndPool : public SMESH_TreeLimit
-    {
-      TElementBoxPool _elBoPool;
-      LimitAndPool():SMESH_TreeLimit( MaxLevel, /*minSize=*/0. ) {}
-    };
-    LimitAndPool* getLimitAndPool() const
-    {
-      SMESH_TreeLimit* limitAndPool = const_cast< SMESH_TreeLimit* >( myLimit );
-      return static_cast< LimitAndPool* >( limitAndPool );
-    }
+    template< class IsOut >
+    void getElements( const IsOut& isOut, TElemSeq& foundElems ) const;
   };
 
   //================================================================================
@@ -280,235 +296,241 @@ namespace // Utils used in SMESH_ElementSearcherImpl::FindElementsByPoint()
                                        SMDSAbs_ElementType  elemType,
                                        SMDS_ElemIteratorPtr theElemIt,
                                        double               tolerance)
-    :SMESH_Octree( new LimitAndPool() )
+    : _leafSize( 0 )
   {
     smIdType nbElems = mesh.GetMeshInfo().NbElements( elemType );
-    _elements.reserve( nbElems );
-
-    TElementBoxPool& elBoPool = getLimitAndPool()->_elBoPool;
 
     if (SALOME::VerbosityActivated() && theElemIt && !theElemIt->more() )
       std::cout << "WARNING: ElementBndBoxTree constructed on empty iterator!" << std::endl;
 
+    std::vector< Bnd_B3d >                 boxes;
+    std::vector< const SMDS_MeshElement* > elements;
+    std::vector< gp_XYZ >                  centers;
+    boxes.reserve( nbElems );
+    elements.reserve( nbElems );
+    centers.reserve( nbElems );
+
     SMDS_ElemIteratorPtr elemIt = theElemIt ? theElemIt : mesh.elementsIterator( elemType );
     while ( elemIt->more() )
     {
-      ElementBox* eb = elBoPool.getNew();
-      eb->init( elemIt->next(), tolerance );
-      _elements.push_back( eb );
+      const SMDS_MeshElement* elem = elemIt->next();
+      boxes.push_back( Bnd_B3d() );
+      Bnd_B3d& box = boxes.back();
+      SMDS_ElemIteratorPtr nIt = elem->nodesIterator();
+      while ( nIt->more() )
+        box.Add( SMESH_NodeXYZ( nIt->next() ));
+      box.Enlarge( tolerance );
+      elements.push_back( elem );
+      centers.push_back( 0.5 * ( box.CornerMin() + box.CornerMax() ));
+      _rootBox.Add( box );
     }
-    compute();
-  }
+    if ( elements.empty() )
+      return;
 
-  //================================================================================
-  /*!
-   * \brief Return the maximal box
-   */
-  //================================================================================
+    std::vector< int > order( elements.size() );
+    for ( size_t i = 0; i < order.size(); ++i )
+      order[ i ] = (int) i;
 
-  Bnd_B3d* ElementBndBoxTree::buildRootBox()
-  {
-    Bnd_B3d* box = new Bnd_B3d;
-    for ( size_t i = 0; i < _elements.size(); ++i )
-      box->Add( *_elements[i] );
-    return box;
+    _nodes.reserve( 4 * elements.size() / MaxNbElemsInLeaf + 1 );
+    build( order, centers, boxes, 0, (int) order.size() );
+
+    // store element boxes in the order of leaves
+    _boxes.resize( order.size() );
+    _elements.resize( order.size() );
+    for ( size_t i = 0; i < order.size(); ++i )
+    {
+      _boxes   [ i ] = boxes   [ order[ i ]];
+      _elements[ i ] = elements[ order[ i ]];
+    }
+
+    int nbLeaves = 0;
+    for ( size_t i = 0; i < _nodes.size(); ++i )
+      if ( _nodes[ i ]._child2 < 0 )
+      {
+        gp_XYZ size = _nodes[ i ]._box.CornerMax() - _nodes[ i ]._box.CornerMin();
+        _leafSize += Max( size.X(), Max( size.Y(), size.Z() ));
+        ++nbLeaves;
+      }
+    _leafSize /= nbLeaves;
+    if ( _leafSize <= 0 )
+      _leafSize = maxSize();
   }
 
   //================================================================================
   /*!
-   * \brief Redistribute element boxes among children
+   * \brief Create a node of elements [begin,end) of order and its children.
+   *        Return index of the node
    */
   //================================================================================
 
-  void ElementBndBoxTree::buildChildrenData()
+  int ElementBndBoxTree::build( std::vector< int >&          order,
+                                const std::vector< gp_XYZ >&  centers,
+                                const std::vector< Bnd_B3d >& boxes,
+                                int                           begin,
+                                int                           end )
   {
-    for ( size_t i = 0; i < _elements.size(); ++i )
+    const int iNode = (int) _nodes.size();
+    _nodes.push_back( TNode() );
+
+    Bnd_B3d box, centerBox;
+    for ( int i = begin; i < end; ++i )
     {
-      for (int j = 0; j < 8; j++)
-      {
-        if ( !_elements[i]->IsOut( *myChildren[j]->getBox() ))
-          ((ElementBndBoxTree*)myChildren[j])->_elements.push_back( _elements[i]);
-      }
+      box.Add( boxes[ order[ i ]]);
+      centerBox.Add( centers[ order[ i ]]);
     }
-    //_size = _elements.size();
-    SMESHUtils::FreeVector( _elements ); // = _elements.clear() + free memory
+    _nodes[ iNode ]._box     = box;
+    _nodes[ iNode ]._child2  = -1;
+    _nodes[ iNode ]._first   = begin;
+    _nodes[ iNode ]._nbElems = end - begin;
 
-    for (int j = 0; j < 8; j++)
-    {
-      ElementBndBoxTree* child = static_cast<ElementBndBoxTree*>( myChildren[j]);
-      if ((int) child->_elements.size() <= MaxNbElemsInLeaf )
-        child->myIsLeaf = true;
+    if ( end - begin <= MaxNbElemsInLeaf )
+      return iNode;
 
-      if ( child->isLeaf() && child->_elements.capacity() > child->_elements.size() )
-        SMESHUtils::CompactVector( child->_elements );
+    // split by the median center along the longest side
+    gp_XYZ size = centerBox.CornerMax() - centerBox.CornerMin();
+    int axis = 1;
+    if ( size.Y() > size.Coord( axis )) axis = 2;
+    if ( size.Z() > size.Coord( axis )) axis = 3;
 
-      // child->_name = _name + char('0' + j);
-      // if ( child->isLeaf() && child->_elements.size() )
-      // {
-      //   cout << child->_name << " ";
-      //   for ( size_t i = 0; i < child->_elements.size(); ++i )
-      //     cout << child->_elements[i]->_element->GetID() << " ";
-      //   cout << endl;
-      // }
-    }
+    const int middle = begin + ( end - begin ) / 2;
+    std::nth_element( order.begin() + begin, order.begin() + middle, order.begin() + end,
+                      [&]( int i1, int i2 ) {
+                        return centers[ i1 ].Coord( axis ) < centers[ i2 ].Coord( axis ); });
+
+    build( order, centers, boxes, begin, middle );
+    int child2 = build( order, centers, boxes, middle, end );
+    _nodes[ iNode ]._child2  = child2;
+    _nodes[ iNode ]._nbElems = 0;
+
+    return iNode;
   }
 
   //================================================================================
   /*!
-   * \brief Return elements which can include the point
+   * \brief Return elements whose boxes are not out according to a given predicate
    */
   //================================================================================
 
-  void ElementBndBoxTree::getElementsNearPoint( const gp_Pnt& point, TElemSeq& foundElems)
+  template< class IsOut >
+  void ElementBndBoxTree::getElements( const IsOut& isOut, TElemSeq& foundElems ) const
   {
-    if ( getBox()->IsOut( point.XYZ() ))
+    if ( _nodes.empty() )
       return;
 
-    if ( isLeaf() )
-    {
-      for ( size_t i = 0; i < _elements.size(); ++i )
-        if ( !_elements[i]->IsOut( point.XYZ() ))
-          foundElems.insert( _elements[i]->_element );
-    }
-    else
+    std::vector< const SMDS_MeshElement* > found;
+
+    int stack[ 64 ]; // tree is balanced, its height is log2( nbElems )
+    int nbInStack = 0;
+    stack[ nbInStack++ ] = 0;
+    while ( nbInStack > 0 )
     {
-      for (int i = 0; i < 8; i++)
-        ((ElementBndBoxTree*) myChildren[i])->getElementsNearPoint( point, foundElems );
+      const int    iNode = stack[ --nbInStack ];
+      const TNode& node  = _nodes[ iNode ];
+      if ( isOut( node._box ))
+        continue;
+      if ( node._child2 < 0 )
+      {
+        const int end = node._first + node._nbElems;
+        for ( int i = node._first; i < end; ++i )
+          if ( !isOut( _boxes[ i ]))
+            found.push_back( _elements[ i ]);
+      }
+      else
+      {
+        stack[ nbInStack++ ] = node._child2;
+        stack[ nbInStack++ ] = iNode + 1;
+      }
     }
+    foundElems.insert( found.begin(), found.end() );
   }
 
   //================================================================================
   /*!
-   * \brief Return elements which can be intersected by the line
+   * \brief Return elements which can include the point
    */
   //================================================================================
 
-  void ElementBndBoxTree::getElementsNearLine( const gp_Ax1& line, TElemSeq& foundElems )
+  void ElementBndBoxTree::getElementsNearPoint( const gp_Pnt& point, TElemSeq& foundElems) const
   {
-    if ( getBox()->IsOut( line ))
-      return;
-
-    if ( isLeaf() )
-    {
-      for ( size_t i = 0; i < _elements.size(); ++i )
-        if ( !_elements[i]->IsOut( line ) )
-          foundElems.insert( _elements[i]->_element );
-    }
-    else
-    {
-      for (int i = 0; i < 8; i++)
-        ((ElementBndBoxTree*) myChildren[i])->getElementsNearLine( line, foundElems );
-    }
+    const gp_XYZ& p = point.XYZ();
+    getElements( [&]( const Bnd_B3d& box ) { return box.IsOut( p ); }, foundElems );
   }
 
   //================================================================================
   /*!
-   * \brief Return elements from leaves intersecting the sphere
+   * \brief Return elements which can be intersected by the line
    */
   //================================================================================
 
-  void ElementBndBoxTree::getElementsInSphere ( const gp_XYZ& center,
-                                                const double  radius,
-                                                TElemSeq&     foundElems)
+  void ElementBndBoxTree::getElementsNearLine( const gp_Ax1& line, TElemSeq& foundElems ) const
   {
-    if ( getBox()->IsOut( center, radius ))
-      return;
-
-    if ( isLeaf() )
-    {
-      for ( size_t i = 0; i < _elements.size(); ++i )
-        if ( !_elements[i]->IsOut( center, radius ))
-          foundElems.insert( _elements[i]->_element );
-    }
-    else
-    {
-      for (int i = 0; i < 8; i++)
-        ((ElementBndBoxTree*) myChildren[i])->getElementsInSphere( center, radius, foundElems );
-    }
+    getElements( [&]( const Bnd_B3d& box ) { return box.IsOut( line ); }, foundElems );
   }
 
   //================================================================================
   /*!
-   * \brief Return elements from leaves intersecting the box
+   * \brief Return elements whose boxes intersect the sphere
    */
   //================================================================================
 
-  void ElementBndBoxTree::getElementsInBox( const Bnd_B3d& box,  TElemSeq& foundElems )
+  void ElementBndBoxTree::getElementsInSphere ( const gp_XYZ& center,
+                                                const double  radius,
+                                                TElemSeq&     foundElems) const
   {
-    if ( getBox()->IsOut( box ))
-      return;
-
-    if ( isLeaf() )
-    {
-      for ( size_t i = 0; i < _elements.size(); ++i )
-        if ( !_elements[i]->IsOut( box ))
-          foundElems.insert( _elements[i]->_element );
-    }
-    else
-    {
-      for (int i = 0; i < 8; i++)
-        ((ElementBndBoxTree*) myChildren[i])->getElementsInBox( box, foundElems );
-    }
+    getElements( [&]( const Bnd_B3d& box ) { return box.IsOut( center, radius ); }, foundElems );
   }
 
   //================================================================================
   /*!
-   * \brief Return a leaf including a point
+   * \brief Return elements whose boxes intersect the box
    */
   //================================================================================
 
-  ElementBndBoxTree* ElementBndBoxTree::getLeafAtPoint( const gp_XYZ& point )
+  void ElementBndBoxTree::getElementsInBox( const Bnd_B3d& box,  TElemSeq& foundElems ) const
   {
-    if ( getBox()->IsOut( point ))
-      return 0;
-
-    if ( isLeaf() )
-    {
-      return this;
-    }
-    else
-    {
-      for (int i = 0; i < 8; i++)
-        if ( ElementBndBoxTree* l = ((ElementBndBoxTree*) myChildren[i])->getLeafAtPoint( point ))
-          return l;
-    }
-    return 0;
+    getElements( [&]( const Bnd_B3d& b ) { return b.IsOut( box ); }, foundElems );
   }
 
   //================================================================================
   /*!
-   * \brief Return number of elements
+   * \brief Return a box of a leaf including a point
    */
   //================================================================================
 
-  int ElementBndBoxTree::getNbElements()
+  const Bnd_B3d* ElementBndBoxTree::getLeafBoxAtPoint( const gp_XYZ& point ) const
   {
-    int nb = 0;
-    if ( isLeaf() )
-    {
-      nb = _elements.size();
-    }
-    else
+    if ( _nodes.empty() )
+      return 0;
+
+    int stack[ 64 ];
+    int nbInStack = 0;
+    stack[ nbInStack++ ] = 0;
+    while ( nbInStack > 0 )
     {
-      for (int i = 0; i < 8; i++)
-        nb += ((ElementBndBoxTree*) myChildren[i])->getNbElements();
+      const int    iNode = stack[ --nbInStack ];
+      const TNode& node  = _nodes[ iNode ];
+      if ( node._box.IsOut( point ))
+        continue;
+      if ( node._child2 < 0 )
+        return & node._box;
+      stack[ nbInStack++ ] = node._child2;
+      stack[ nbInStack++ ] = iNode + 1;
     }
-    return nb;
+    return 0;
   }
 
   //================================================================================
   /*!
-   * \brief Construct the element box
+   * \brief Return the biggest dimension of the tree box
    */
   //================================================================================
 
-  void ElementBndBoxTree::ElementBox::init(const SMDS_MeshElement* elem, double tolerance)
+  double ElementBndBoxTree::maxSize() const
   {
-    _element  = elem;
-    SMDS_ElemIteratorPtr nIt = elem->nodesIterator();
-    while ( nIt->more() )
-      Add( SMESH_NodeXYZ( nIt->next() ));
-    Enlarge( tolerance );
+    if ( _rootBox.IsVoid() )
+      return 0.;
+    gp_XYZ size = _rootBox.CornerMax() - _rootBox.CornerMin();
+    return Max( size.X(), Max( size.Y(), size.Z() ));
   }
 
 } // namespace
@@ -524,32 +546,95 @@ SMESH_ElementSearcher::~SMESH_ElementSearcher()
 {
 }
 
+//=======================================================================
+/*!
+ * \brief Find for each of given points an element of given type where the point is IN or ON
+ */
+//=======================================================================
+
+void SMESH_ElementSearcher::FindElementsByPoints( const std::vector< gp_XYZ >&            points,
+                                                  SMDSAbs_ElementType                     type,
+                                                  std::vector< const SMDS_MeshElement* >& foundElems)
+{
+  foundElems.assign( points.size(), 0 );
+  std::vector< const SMDS_MeshElement* > found;
+  for ( size_t i = 0; i < points.size(); ++i )
+    if ( FindElementsByPoint( gp_Pnt( points[i] ), type, found ))
+      foundElems[i] = found[0];
+}
+
+//=======================================================================
+/*!
+ * \brief Return projections of given points to a mesh and optionally the closest elements
+ */
+//=======================================================================
+
+void SMESH_ElementSearcher::ProjectPoints( const std::vector< gp_XYZ >&            points,
+                                           SMDSAbs_ElementType                     type,
+                                           std::vector< gp_XYZ >&                  projections,
+                                           std::vector< const SMDS_MeshElement* >* closestElems)
+{
+  projections.resize( points.size() );
+  if ( closestElems )
+    closestElems->assign( points.size(), 0 );
+  for ( size_t i = 0; i < points.size(); ++i )
+    projections[i] = Project( gp_Pnt( points[i] ), type, closestElems ? & (*closestElems)[i] : 0 );
+}
+
+//=======================================================================
+/*!
+ * \brief Classify given points in the closed 2D mesh
+ */
+//=======================================================================
+
+void SMESH_ElementSearcher::GetPointStates( const std::vector< gp_XYZ >& points,
+                                            std::vector< TopAbs_State >& states)
+{
+  states.resize( points.size() );
+  for ( size_t i = 0; i < points.size(); ++i )
+    states[i] = GetPointState( gp_Pnt( points[i] ));
+}
+
 struct SMESH_ElementSearcherImpl: public SMESH_ElementSearcher
 {
   SMDS_Mesh*                        _mesh;
   SMDS_ElemIteratorPtr              _meshPartIt;
   ElementBndBoxTree*                _ebbTree      [SMDSAbs_NbElementTypes];
-  int                               _ebbTreeHeight[SMDSAbs_NbElementTypes];
   SMESH_NodeSearcherImpl*           _nodeSearcher;
   SMDSAbs_ElementType               _elementType;
   double                            _tolerance;
   bool                              _outerFacesFound;
   std::set<const SMDS_MeshElement*> _outerFaces; // empty means "no internal faces at all"
+  bool                              _isWorker;   // trees are owned by another searcher
 
   SMESH_ElementSearcherImpl( SMDS_Mesh&           mesh,
                              double               tol=-1,
                              SMDS_ElemIteratorPtr elemIt=SMDS_ElemIteratorPtr())
-    : _mesh(&mesh),_meshPartIt(elemIt),_nodeSearcher(0),_tolerance(tol),_outerFacesFound(false)
+    : _mesh(&mesh),_meshPartIt(elemIt),_nodeSearcher(0),_tolerance(tol),_outerFacesFound(false),
+      _isWorker(false)
   {
     for ( int i = 0; i < SMDSAbs_NbElementTypes; ++i )
     {
       _ebbTree[i] = NULL;
-      _ebbTreeHeight[i] = -1;
     }
     _elementType = SMDSAbs_All;
   }
+  // Create a searcher used by a thread: it shares read-only trees of the master
+  // and has own data modified by search
+  SMESH_ElementSearcherImpl( const SMESH_ElementSearcherImpl& master )
+    : _mesh(master._mesh),_nodeSearcher(master._nodeSearcher),_elementType(master._elementType),
+      _tolerance(master._tolerance),_outerFacesFound(master._outerFacesFound),
+      _outerFaces(master._outerFaces),_isWorker(true)
+  {
+    for ( int i = 0; i < SMDSAbs_NbElementTypes; ++i )
+    {
+      _ebbTree[i] = master._ebbTree[i];
+    }
+  }
   virtual ~SMESH_ElementSearcherImpl()
   {
+    if ( _isWorker )
+      return;
     for ( int i = 0; i < SMDSAbs_NbElementTypes; ++i )
     {
       delete _ebbTree[i]; _ebbTree[i] = NULL;
@@ -577,6 +662,17 @@ struct SMESH_ElementSearcherImpl: public SMESH_ElementSearcher
   virtual gp_XYZ Project(const gp_Pnt&            point,
                          SMDSAbs_ElementType      type,
                          const SMDS_MeshElement** closestElem);
+  virtual void FindElementsByPoints( const std::vector< gp_XYZ >&            points,
+                                     SMDSAbs_ElementType                     type,
+                                     std::vector< const SMDS_MeshElement* >& foundElems);
+  virtual void ProjectPoints( const std::vector< gp_XYZ >&            points,
+                              SMDSAbs_ElementType                     type,
+                              std::vector< gp_XYZ >&                  projections,
+                              std::vector< const SMDS_MeshElement* >* closestElems);
+  virtual void GetPointStates( const std::vector< gp_XYZ >&  points,
+                               std::vector< TopAbs_State >&  states);
+  template< class TPointFun >
+  void forEachPoint( size_t nbPoints, TPointFun pointFun );
   double getTolerance();
   bool getIntersParamOnLine(const gp_Lin& line, const SMDS_MeshElement* face,
                             const double tolerance, double & param);
@@ -585,12 +681,6 @@ struct SMESH_ElementSearcherImpl: public SMESH_ElementSearcher
   {
     return _outerFaces.empty() || _outerFaces.count(face);
   }
-  int getTreeHeight()
-  {
-    if ( _ebbTreeHeight[ _elementType ] < 0 )
-      _ebbTreeHeight[ _elementType ] = _ebbTree[ _elementType ]->getHeight();
-    return _ebbTreeHeight[ _elementType ];
-  }
 
   struct TInters //!< data of intersection of the line and the mesh face (used in GetPointState())
   {
@@ -912,7 +1002,7 @@ SMESH_ElementSearcherImpl::FindClosestTo( const gp_Pnt&       point,
       if ( ebbTree->getBox()->IsOut( point.XYZ() ))
         radius = point.Distance( boxCenter ) - 0.5 * ebbTree->maxSize();
       if ( radius < 0 )
-        radius = ebbTree->maxSize() / pow( 2., getTreeHeight()) / 2;
+        radius = ebbTree->leafSize() / 2;
       while ( suspectElems.empty() && radius < 1e100 )
       {
         ebbTree->getElementsInSphere( point.XYZ(), radius, suspectElems );
@@ -1286,8 +1376,8 @@ gp_XYZ SMESH_ElementSearcherImpl::Project(const gp_Pnt&            point,
     ebbTree = new ElementBndBoxTree( *_mesh, _elementType, _meshPartIt );
 
   gp_XYZ p = point.XYZ();
-  ElementBndBoxTree* ebbLeaf = ebbTree->getLeafAtPoint( p );
-  const Bnd_B3d* box = ebbLeaf ? ebbLeaf->getBox() : ebbTree->getBox();
+  const Bnd_B3d* ebbLeaf = ebbTree->getLeafBoxAtPoint( p );
+  const Bnd_B3d* box = ebbLeaf ? ebbLeaf : ebbTree->getBox();
   gp_XYZ pMin = box->CornerMin(), pMax = box->CornerMax();
   double radius = Precision::Infinite();
   if ( ebbLeaf || !box->IsOut( p ))
@@ -1299,7 +1389,7 @@ gp_XYZ SMESH_ElementSearcherImpl::Project(const gp_Pnt&            point,
         radius = Min( d, radius );
     }
     if ( !ebbLeaf )
-      radius /= ebbTree->getHeight( /*full=*/true );
+      radius = Min( 0.5 * ebbTree->leafSize(), radius );
   }
   else // p outside of box
   {
@@ -1358,6 +1448,116 @@ gp_XYZ SMESH_ElementSearcherImpl::Project(const gp_Pnt&            point,
   return bestProj;
 }
 
+//=======================================================================
+/*!
+ * \brief Call pointFun( searcher, iPoint ) for all points but the first one.
+ *        The points are treated in parallel if possible, then each thread uses
+ *        an own searcher sharing trees of this one. So this searcher must be
+ *        fully initialized by treating the first point.
+ */
+//=======================================================================
+
+template< class TPointFun >
+void SMESH_ElementSearcherImpl::forEachPoint( size_t nbPoints, TPointFun pointFun )
+{
+#ifdef WITH_TBB
+  if ( nbPoints >= 100 ) // else no sense in parallel work
+  {
+    typedef std::unique_ptr< SMESH_ElementSearcherImpl > TSearcherPtr;
+    tbb::enumerable_thread_specific< TSearcherPtr > workers;
+
+    tbb::parallel_for ( tbb::blocked_range<size_t>( 1, nbPoints ),
+                        [&]( const tbb::blocked_range<size_t>& r )
+                        {
+                          TSearcherPtr& worker = workers.local();
+                          if ( !worker )
+                            worker.reset( new SMESH_ElementSearcherImpl( *this ));
+                          for ( size_t i = r.begin(); i != r.end(); ++i )
+                            pointFun( *worker, i );
+                        });
+    return;
+  }
+#endif
+
+  for ( size_t i = 1; i < nbPoints; ++i )
+    pointFun( *this, i );
+}
+
+//=======================================================================
+/*!
+ * \brief Find for each of given points an element of given type where the point is IN or ON
+ */
+//=======================================================================
+
+void SMESH_ElementSearcherImpl::
+FindElementsByPoints( const std::vector< gp_XYZ >&            points,
+                      SMDSAbs_ElementType                     type,
+                      std::vector< const SMDS_MeshElement* >& foundElems)
+{
+  foundElems.assign( points.size(), 0 );
+  if ( points.empty() )
+    return;
+
+  std::vector< const SMDS_MeshElement* > found;
+  if ( FindElementsByPoint( gp_Pnt( points[0] ), type, found ))
+    foundElems[0] = found[0];
+
+  forEachPoint( points.size(), [&]( SMESH_ElementSearcherImpl& searcher, size_t i )
+                {
+                  std::vector< const SMDS_MeshElement* > elems;
+                  if ( searcher.FindElementsByPoint( gp_Pnt( points[i] ), type, elems ))
+                    foundElems[i] = elems[0];
+                });
+}
+
+//=======================================================================
+/*!
+ * \brief Return projections of given points to a mesh and optionally the closest elements
+ */
+//=======================================================================
+
+void SMESH_ElementSearcherImpl::
+ProjectPoints( const std::vector< gp_XYZ >&            points,
+               SMDSAbs_ElementType                     type,
+               std::vector< gp_XYZ >&                  projections,
+               std::vector< const SMDS_MeshElement* >* closestElems)
+{
+  projections.resize( points.size() );
+  if ( closestElems )
+    closestElems->assign( points.size(), 0 );
+  if ( points.empty() )
+    return;
+
+  projections[0] = Project( gp_Pnt( points[0] ), type, closestElems ? & (*closestElems)[0] : 0 );
+
+  forEachPoint( points.size(), [&]( SMESH_ElementSearcherImpl& searcher, size_t i )
+                {
+                  projections[i] = searcher.Project( gp_Pnt( points[i] ), type,
+                                                     closestElems ? & (*closestElems)[i] : 0 );
+                });
+}
+
+//=======================================================================
+/*!
+ * \brief Classify given points in the closed 2D mesh
+ */
+//=======================================================================
+
+void SMESH_ElementSearcherImpl::GetPointStates( const std::vector< gp_XYZ >& points,
+                                                std::vector< TopAbs_State >& states)
+{
+  states.resize( points.size() );
+  if ( points.empty() )
+    return;
+
+  states[0] = GetPointState( gp_Pnt( points[0] ));
+
+  forEachPoint( points.size(), [&]( SMESH_ElementSearcherImpl& searcher, size_t i )
+                {
+                  states[i] = searcher.GetPointState( gp_Pnt( points[i] ));
+                });
+}
+
 //=======================================================================
 /*!
  * \brief Return true if the point is IN or ON of the element
@@ -119,6 +119,29 @@ struct SMESHUtils_EXPORT SMESH_ElementSearcher
                          SMDSAbs_ElementType      type,
                          const SMDS_MeshElement** closestFace= 0) = 0;
 
+  /*!
+   * \brief Find for each of given points an element of given type where the point is IN or ON.
+   *        NULL is returned for a point out of all elements.
+   *        Points are treated in parallel if possible.
+   */
+  virtual void FindElementsByPoints( const std::vector< gp_XYZ >&            points,
+                                     SMDSAbs_ElementType                     type,
+                                     std::vector< const SMDS_MeshElement* >& foundElems);
+  /*!
+   * \brief Return projections of given points to a mesh and optionally the closest elements.
+   *        Points are treated in parallel if possible.
+   */
+  virtual void ProjectPoints( const std::vector< gp_XYZ >&            points,
+                              SMDSAbs_ElementType                     type,
+                              std::vector< gp_XYZ >&                  projections,
+                              std::vector< const SMDS_MeshElement* >* closestElems = 0);
+  /*!
+   * \brief Classify given points in the closed 2D mesh.
+   *        Points are treated in parallel if possible.
+   */
+  virtual void GetPointStates( const std::vector< gp_XYZ >&  points,
+                               std::vector< TopAbs_State >&  states);
+
   virtual ~SMESH_ElementSearcher();
 };
 
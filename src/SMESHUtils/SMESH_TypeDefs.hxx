@@ -40,12 +40,15 @@
 #include <gp_XY.hxx>
 #include <NCollection_Sequence.hxx>
 
+#include <algorithm>
 #include <map>
 #include <list>
 #include <set>
+#include <vector>
 #include <cassert>
 
 #include <boost/make_shared.hpp>
+#include <boost/container/flat_set.hpp>
 
 typedef std::map<const SMDS_MeshElement*,
                  std::list<const SMDS_MeshElement*>, TIDCompare > TElemOfElemListMap;
@@ -58,6 +61,11 @@ typedef std::map<const SMDS_MeshNode*,
 typedef std::set< const SMDS_MeshElement*, TIDCompare >      TIDSortedElemSet;
 typedef std::set< const SMDS_MeshNode*,    TIDCompare >      TIDSortedNodeSet;
 
+//!< Set of elements sorted by ID stored in a vector. It is faster to fill and to iterate
+//!< than TIDSortedElemSet but its modification invalidates iterators, so it suits
+//!< read-only arguments of edition
+typedef boost::container::flat_set< const SMDS_MeshElement*, TIDCompare > TIDSortedElemVec;
+
 typedef std::pair< const SMDS_MeshNode*, const SMDS_MeshNode* >   NLink;
 
 struct FaceQuadStruct; // defined in StdMeshers_Quadrangle_2D.hxx
@@ -113,6 +121,36 @@ namespace SMESHUtils
     ArrayDeleter( const ArrayDeleter& );
   };
 
+  /*!
+   * \brief Sort elements by ID and remove duplicates; sorting is skipped if elements
+   *        are already sorted, as IDs of groups and sub-meshes usually are
+   */
+  inline void SortByID( std::vector< const SMDS_MeshElement* >& elems )
+  {
+    TIDCompare idLess;
+    if ( !std::is_sorted( elems.begin(), elems.end(), idLess ))
+      std::sort( elems.begin(), elems.end(), idLess );
+    elems.erase( std::unique( elems.begin(), elems.end() ), elems.end() );
+  }
+
+  /*!
+   * \brief Add elements to a set sorted by ID at once
+   *  \param [in,out] elems - elements to add, they get sorted by ID
+   *  \param [in,out] elemSet - the set to fill
+   */
+  inline void InsertSortedByID( std::vector< const SMDS_MeshElement* >& elems,
+                                TIDSortedElemSet&                       elemSet )
+  {
+    SortByID( elems );
+    elemSet.insert( elems.begin(), elems.end() ); // sorted input is inserted in linear time
+  }
+  inline void InsertSortedByID( std::vector< const SMDS_MeshElement* >& elems,
+                                TIDSortedElemVec&                       elemSet )
+  {
+    SortByID( elems );
+    elemSet.insert( boost::container::ordered_unique_range, elems.begin(), elems.end() );
+  }
+
   /*!
    * \return SMDS_ElemIteratorPtr on an std container of SMDS_MeshElement's
    */
@@ -346,6 +346,7 @@ SMESH_Gen_i::SMESH_Gen_i( CORBA::ORB_ptr            orb,
   mySMESHGen = this;
   myIsHistoricalPythonDump = true;
   myToForgetMeshDataOnHypModif = false;
+  myIsLastSavedMedFileTmp = false;
 
   // set it in standalone mode only
   //OSD::SetSignal( true );
@@ -404,6 +405,9 @@ SMESH_Gen_i::~SMESH_Gen_i()
   // Clear study contexts data
   delete myStudyContext;
 
+  // remove the copy of the last saved MED file
+  forgetLastSavedMedFile();
+
   // delete shape reader
   if ( myShapeReader )
     delete myShapeReader;
@@ -1144,6 +1148,31 @@ void SMESH_Gen_i::SetDefaultNbSegments(CORBA::Long theNbSegments)
     THROW_SALOME_CORBA_EXCEPTION( "non-positive number of segments", SALOME::BAD_PARAM );
 }
 
+//=============================================================================
+/*!
+ * \brief Set a limit of memory in MB used by all meshes
+ */
+//=============================================================================
+
+void SMESH_Gen_i::SetMemoryBudget( CORBA::Long theMegabytes )
+{
+  if ( theMegabytes >= 0 )
+    ::SMESH_Gen::SetMemoryBudget( int( theMegabytes ));
+  else
+    THROW_SALOME_CORBA_EXCEPTION( "negative memory budget", SALOME::BAD_PARAM );
+}
+
+//=============================================================================
+/*!
+ * \brief Return a limit of memory in MB used by all meshes
+ */
+//=============================================================================
+
+CORBA::Long SMESH_Gen_i::GetMemoryBudget()
+{
+  return ::SMESH_Gen::GetMemoryBudget();
+}
+
 //=============================================================================
 /*!
  * Set an option value
@@ -1524,9 +1553,31 @@ SMESH::SMESH_Mesh_ptr SMESH_Gen_i::ReloadMeshesFromUNV(const char* theFileName,
 
 SMESH::mesh_array* SMESH_Gen_i::CreateMeshesFromMED( const char*                  theFileName,
                                                      SMESH::DriverMED_ReadStatus& theStatus )
+{
+  SMESH::string_array noGroups;
+  return CreateMeshesFromMEDGroups( theFileName, noGroups, theStatus );
+}
+
+//=============================================================================
+/*!
+ *  SMESH_Gen_i::CreateMeshesFromMEDGroups
+ *
+ *  Create mesh and import from MED file elements of given groups;
+ *  all elements are imported if no group is given
+ */
+//=============================================================================
+
+SMESH::mesh_array*
+SMESH_Gen_i::CreateMeshesFromMEDGroups( const char*                  theFileName,
+                                        const SMESH::string_array&   theGroupNames,
+                                        SMESH::DriverMED_ReadStatus& theStatus )
 {
   checkFileReadable( theFileName );
 
+  std::set<std::string> aGroupsToRead;
+  for ( CORBA::ULong i = 0; i < theGroupNames.length(); ++i )
+    aGroupsToRead.insert( theGroupNames[ i ].in() );
+
   // Retrieve mesh names from the file
   DriverMED_R_SMESHDS_Mesh myReader;
   myReader.SetFile( theFileName );
@@ -1576,7 +1627,7 @@ SMESH::mesh_array* SMESH_Gen_i::CreateMeshesFromMED( const char*
         SMESH_Mesh_i* meshServant = dynamic_cast<SMESH_Mesh_i*>( GetServant( mesh ).in() );
         ASSERT( meshServant );
         SMESH::DriverMED_ReadStatus status1 =
-          meshServant->ImportMEDFile( theFileName, meshName.c_str() );
+          meshServant->ImportMEDFile( theFileName, meshName.c_str(), aGroupsToRead );
         if (status1 > theStatus)
           theStatus = status1;
 
@@ -1588,7 +1639,10 @@ SMESH::mesh_array* SMESH_Gen_i::CreateMeshesFromMED( const char*
     }
 
     // Update Python script
-    aPythonDump << "], status) = " << this << ".CreateMeshesFromMED( r'" << theFileName << "' )";
+    aPythonDump << "], status) = " << this << ".CreateMeshesFromMED( r'" << theFileName << "'";
+    if ( theGroupNames.length() > 0 )
+      aPythonDump << ", " << theGroupNames;
+    aPythonDump << " )";
   }
   // Dump creation of groups
   for ( CORBA::ULong  i = 0; i < aResult->length(); ++i )
@@ -4854,6 +4908,25 @@ SALOMEDS::TMPFile* SMESH_Gen_i::Save( SALOMEDS::SComponent_ptr theComponent,
   hdf_size    aSize[ 1 ];
 
 
+  // In multi-file mode the MED file of the previous save can be at the place of the
+  // new one; move it aside to copy unchanged meshes from it
+  if ( isMultiFile && !myIsLastSavedMedFileTmp && myLastSavedMedFile == meshfile.ToCString() )
+  {
+    fs::path prevFile = fs::path( myLastSavedMedFile );
+    fs::path movedFile = prevFile.parent_path() / fs::unique_path("SMESH_saved-%%%%%%.med");
+    boost::system::error_code err;
+    fs::rename( prevFile, movedFile, err );
+    if ( err )
+    {
+      forgetLastSavedMedFile();
+    }
+    else
+    {
+      myLastSavedMedFile = movedFile.string();
+      myIsLastSavedMedFileTmp = true;
+    }
+  }
+
   //Remove the files if they exist: BugID: 11225
 #ifndef WIN32 /* unix functionality */
   TCollection_AsciiString cmd("rm -f \"");
@@ -4875,6 +4948,11 @@ SALOMEDS::TMPFile* SMESH_Gen_i::Save( SALOMEDS::SComponent_ptr theComponent,
   writer.SetFile( meshfile.ToCString() );
   //writer.SetSaveNumbers( false ); // bos #24400 -- it leads to change of element IDs
 
+  // meshes not modified since the previous save are copied from the previously saved MED file
+  std::map< int, std::string > savedMeshSignatures;
+  const bool canCopyMeshes = ( !myLastSavedMedFile.empty() &&
+                               SMESH_File( myLastSavedMedFile, /*open=*/false ).exists() );
+
   // IMP issue 20918
   // SetStoreName() to groups before storing hypotheses to let them refer to
   // groups using "store name", which is "Group <group_persistent_id>"
@@ -5077,6 +5155,7 @@ SALOMEDS::TMPFile* SMESH_Gen_i::Save( SALOMEDS::SComponent_ptr theComponent,
 
             // --> put dataset to hdf file which is a flag that mesh has data
             string strHasData = "0";
+            std::vector< SMESHDS_GroupBase* > medGroups; // groups to write to the MED file
             // check if the mesh is not empty
             if ( mySMESHDSMesh->NbNodes() > 0 ) {
               // write mesh data to med file
@@ -5555,7 +5634,7 @@ SALOMEDS::TMPFile* SMESH_Gen_i::Save( SALOMEDS::SComponent_ptr theComponent,
                     // Pass SMESHDS_Group to MED writer
                     SMESHDS_Group* aGrpDS = dynamic_cast<SMESHDS_Group*>( aGrpBaseDS );
                     if ( aGrpDS )
-                      writer.AddGroup( aGrpDS );
+                      medGroups.push_back( aGrpDS );
 
                     // write reference on a shape if exists
                     SMESHDS_GroupOnGeom* aGeomGrp =
@@ -5580,7 +5659,7 @@ SALOMEDS::TMPFile* SMESH_Gen_i::Save( SALOMEDS::SComponent_ptr theComponent,
                       else // shape ref is invalid:
                       {
                         // save a group on geometry as ordinary group
-                        writer.AddGroup( aGeomGrp );
+                        medGroups.push_back( aGeomGrp );
                       }
                     }
                     else if ( SMESH_GroupOnFilter_i* aFilterGrp_i =
@@ -5602,8 +5681,31 @@ SALOMEDS::TMPFile* SMESH_Gen_i::Save( SALOMEDS::SComponent_ptr theComponent,
 
             if ( strcmp( strHasData.c_str(), "1" ) == 0 )
             {
-              // Flush current mesh information into MED file
-              writer.Perform();
+              // Flush current mesh information into MED file, unless neither the mesh
+              // nor its groups changed since the previous save, then copy it from there.
+              // Any change of nodes and elements increments GetNbModifications()
+              SMESH_Comment signature;
+              signature << objStr.in()
+                        << " " << mySMESHDSMesh->GetNbModifications()
+                        << " " << mySMESHDSMesh->NbNodes()
+                        << " " << mySMESHDSMesh->MaxNodeID()
+                        << " " << mySMESHDSMesh->GetMeshInfo().NbElements()
+                        << " " << mySMESHDSMesh->MaxElementID();
+              for ( SMESHDS_GroupBase* medGroup : medGroups )
+                signature << " " << medGroup->GetStoreName() << ":" << medGroup->GetTic();
+              savedMeshSignatures[ id ] = signature;
+
+              std::map< int, std::string >::iterator id2sig = mySavedMeshSignatures.find( id );
+              bool isCopied = ( canCopyMeshes &&
+                                id2sig != mySavedMeshSignatures.end() &&
+                                id2sig->second == signature &&
+                                MED::CopyMesh( myLastSavedMedFile, meshfile.ToCString(), SMESH_Comment( id )));
+              if ( !isCopied )
+              {
+                for ( SMESHDS_GroupBase* medGroup : medGroups )
+                  writer.AddGroup( medGroup );
+                writer.Perform();
+              }
 
               // save info on nb of elements
               SMESH_PreMeshInfo::SaveToFile( myImpl, id, aFile );
@@ -5794,6 +5896,34 @@ SALOMEDS::TMPFile* SMESH_Gen_i::Save( SALOMEDS::SComponent_ptr theComponent,
   // Convert temporary files to stream
   aStreamFile = SALOMEDS_Tool::PutFilesToStream( tmpDir.ToCString(), aFileSeq, isMultiFile );
 
+  // Keep the MED file to copy meshes unchanged till the next save
+  forgetLastSavedMedFile();
+  if ( !savedMeshSignatures.empty() && isMultiFile )
+  {
+    // the saved file stays in the study directory
+    myLastSavedMedFile = meshfile.ToCString();
+    mySavedMeshSignatures.swap( savedMeshSignatures );
+  }
+  else if ( !savedMeshSignatures.empty() )
+  {
+    try
+    {
+      // the file is to be removed with the temporary directory, so move it
+      fs::path lastSavedFile = fs::temp_directory_path() / fs::unique_path("SMESH_saved-%%%%%%.med");
+      boost::system::error_code err;
+      fs::rename( meshfile.ToCString(), lastSavedFile, err );
+      if ( err ) // on another file system
+        fs::copy_file( meshfile.ToCString(), lastSavedFile );
+      myLastSavedMedFile = lastSavedFile.string();
+      myIsLastSavedMedFileTmp = true;
+      mySavedMeshSignatures.swap( savedMeshSignatures );
+    }
+    catch ( const fs::filesystem_error& ex )
+    {
+      MESSAGE( "Can't keep saved MED file: " << ex.what() );
+    }
+  }
+
   // Remove temporary files and directory
   if ( !isMultiFile )
     SALOMEDS_Tool::RemoveTemporaryFiles( tmpDir.ToCString(), aFileSeq, true );
@@ -5801,6 +5931,21 @@ SALOMEDS::TMPFile* SMESH_Gen_i::Save( SALOMEDS::SComponent_ptr theComponent,
   return aStreamFile._retn();
 }
 
+//=============================================================================
+/*!
+ *  Remove a temporary copy of the last saved MED file and forget signatures of its meshes
+ */
+//=============================================================================
+
+void SMESH_Gen_i::forgetLastSavedMedFile()
+{
+  if ( myIsLastSavedMedFileTmp && !myLastSavedMedFile.empty() )
+    SMESH_File( myLastSavedMedFile, /*open=*/false ).remove();
+  myLastSavedMedFile.clear();
+  myIsLastSavedMedFileTmp = false;
+  mySavedMeshSignatures.clear();
+}
+
 //=============================================================================
 /*!
  *  SMESH_Gen_i::SaveASCII
@@ -6811,6 +6956,9 @@ void SMESH_Gen_i::Close( SALOMEDS::SComponent_ptr theComponent )
   // remove the tmp files meshes are loaded from
   SMESH_PreMeshInfo::RemoveStudyFiles_TMP_METHOD( theComponent );
 
+  // remove the copy of the last saved MED file
+  forgetLastSavedMedFile();
+
   // Clean trace of API methods calls
   CleanPythonTrace();
 
@@ -212,6 +212,14 @@ public:
    * \brief Sets default number of segments per edge
    */
   void SetDefaultNbSegments(CORBA::Long theNbSegments);
+  /*!
+   * \brief Sets a limit of memory in MB used by all meshes
+   */
+  void SetMemoryBudget( CORBA::Long theMegabytes );
+  /*!
+   * \brief Returns a limit of memory in MB used by all meshes
+   */
+  CORBA::Long GetMemoryBudget();
 
   /*!
     Set an option value
@@ -249,6 +257,11 @@ public:
   SMESH::mesh_array* CreateMeshesFromMED( const char* theFileName,
                                           SMESH::DriverMED_ReadStatus& theStatus );
 
+  //  Create mesh(es) and import elements of given groups from MED file
+  SMESH::mesh_array* CreateMeshesFromMEDGroups( const char*                  theFileName,
+                                                const SMESH::string_array&   theGroupNames,
+                                                SMESH::DriverMED_ReadStatus& theStatus );
+
   SMESH::mesh_array* ReloadMeshesFromMED(const char*                  theFileName,
                                          SMESH::SMESH_Mesh_ptr        sourceMesh,
                                          SMESH::DriverMED_ReadStatus& theStatus);
@@ -679,6 +692,9 @@ private:
 
   void highLightInvalid( SALOMEDS::SObject_ptr theSObject, bool isInvalid );
 
+  // Remove a temporary copy of the last saved MED file and forget signatures of its meshes
+  void forgetLastSavedMedFile();
+
   std::vector<long> _GetInside(SMESH::SMESH_IDSource_ptr meshPart,
                                SMESH::ElementType        ElemType,
                                const TopoDS_Shape&       Shape,
@@ -709,6 +725,12 @@ private:
   // To load full mesh data from study at hyp modification or not
   bool myToForgetMeshDataOnHypModif;
 
+  // Last saved MED file and signatures of meshes stored in it, used at Save()
+  // to copy meshes not modified since the previous save instead of re-writing them
+  std::string                myLastSavedMedFile;
+  bool                         myIsLastSavedMedFileTmp; // is a temporary copy to remove
+  std::map< int, std::string > mySavedMeshSignatures; // mesh id -> signature
+
   // Dump Python: trace of API methods calls
   Handle(TColStd_HSequenceOfAsciiString) myPythonScript;
   bool                                   myIsHistoricalPythonDump;
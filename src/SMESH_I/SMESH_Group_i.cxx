@@ -507,6 +507,22 @@ SMESH::smIdType_array* SMESH_GroupBase_i::GetListOfID()
   return aRes._retn();
 }
 
+//================================================================================
+/*!
+ * \brief Return a number changed when contents of the group may change
+ */
+//================================================================================
+
+CORBA::Long SMESH_GroupBase_i::GetTic()
+{
+  if ( myPreMeshInfo )
+    return -1;
+
+  if ( SMESHDS_GroupBase* aGroupDS = GetGroupDS() )
+    return aGroupDS->GetTic();
+  return -1;
+}
+
 namespace
 {
   //================================================================================
@@ -66,6 +66,7 @@ class SMESH_I_EXPORT SMESH_GroupBase_i:
   CORBA::Boolean Contains(SMESH::smIdType elem_id);
   SMESH::smIdType GetID(SMESH::smIdType elem_index);
   SMESH::smIdType_array* GetListOfID();
+  CORBA::Long GetTic();
   SMESH::smIdType_array* GetNodeIDs();
   SMESH::smIdType GetNumberOfNodes();
   CORBA::Boolean IsNodeInfoAvailable(); // for gui
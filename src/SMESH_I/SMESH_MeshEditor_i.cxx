@@ -79,6 +79,7 @@
 
 #include <sstream>
 #include <limits>
+#include <thread>
 
 #include "SMESH_TryCatch.hxx" // include after OCCT headers!
 
@@ -256,7 +257,7 @@ namespace MeshEditor_I {
   }
   //================================================================================
   /*!
-   * \brief function for conversion of long_array to TIDSortedElemSet
+   * \brief function for conversion of long_array to TIDSortedElemSet or TIDSortedElemVec
    * \param IDs - array of IDs
    * \param aMesh - mesh
    * \param aMap - collection to fill
@@ -264,9 +265,10 @@ namespace MeshEditor_I {
    */
   //================================================================================
 
+  template< class TElemSet >
   void arrayToSet(const SMESH::smIdType_array & IDs,
                   const SMESHDS_Mesh*           aMesh,
-                  TIDSortedElemSet&             aMap,
+                  TElemSet&                     aMap,
                   const SMDSAbs_ElementType     aType = SMDSAbs_All,
                   SMDS_MeshElement::Filter*     aFilter = NULL)
   {
@@ -278,18 +280,22 @@ namespace MeshEditor_I {
     
     SMDS_MeshElement::Filter & filter = *aFilter;
 
+    // collect elements and add them sorted to aMap at once
+    std::vector< const SMDS_MeshElement* > elems;
+    elems.reserve( IDs.length() );
     if ( aType == SMDSAbs_Node )
       for ( CORBA::ULong i = 0; i < IDs.length(); i++ ) {
         const SMDS_MeshElement * elem = aMesh->FindNode( IDs[i] );
         if ( filter( elem ))
-          aMap.insert( aMap.end(), elem );
+          elems.push_back( elem );
       }
     else
       for ( CORBA::ULong i = 0; i<IDs.length(); i++) {
         const SMDS_MeshElement * elem = aMesh->FindElement( IDs[i] );
         if ( filter( elem ))
-          aMap.insert( aMap.end(), elem );
+          elems.push_back( elem );
       }
+    SMESHUtils::InsertSortedByID( elems, aMap );
   }
 
   //================================================================================
@@ -1320,7 +1326,8 @@ SMESH_MeshEditor_i::Create0DElementsOnAllNodes(SMESH::SMESH_IDSource_ptr theObje
   SMESH::SMESH_IDSource_var result;
   TPythonDump pyDump;
 
-  TIDSortedElemSet elements, elems0D;
+  TIDSortedElemVec elements;
+  TIDSortedElemSet elems0D;
   if ( idSourceToSet( theObject, getMeshDS(), elements, SMDSAbs_All, /*emptyIfIsMesh=*/1))
     getEditor().Create0DElementsOnAllNodes( elements, elems0D, theDuplicateElements );
 
@@ -2467,7 +2474,9 @@ SMESH_MeshEditor_i::smooth(const SMESH::smIdType_array &          IDsOfElements,
                            CORBA::Short                           MaxNbOfIterations,
                            CORBA::Double                          MaxAspectRatio,
                            SMESH::SMESH_MeshEditor::Smooth_Method Method,
-                           bool                                   IsParametric)
+                           bool                                   IsParametric,
+                           int                                    NbThreads,
+                           double                                 MaxDisplacement)
 {
   SMESH_TRY;
   initData();
@@ -2489,7 +2498,8 @@ SMESH_MeshEditor_i::smooth(const SMESH::smIdType_array &          IDsOfElements,
     method = ::SMESH_MeshEditor::CENTROIDAL;
 
   getEditor().Smooth(elements, fixedNodes, method,
-                  MaxNbOfIterations, MaxAspectRatio, IsParametric );
+                     MaxNbOfIterations, MaxAspectRatio, IsParametric,
+                     NbThreads, MaxDisplacement );
 
   declareMeshModified( /*isReComputeSafe=*/true ); // does not prevent re-compute
 
@@ -2547,6 +2557,51 @@ SMESH_MeshEditor_i::smoothObject(SMESH::SMESH_IDSource_ptr              theObjec
   return 0;
 }
 
+//=======================================================================
+//function : SmoothParallel
+//purpose  : Smooth theObject using several threads
+//=======================================================================
+
+CORBA::Boolean
+SMESH_MeshEditor_i::SmoothParallel(SMESH::SMESH_IDSource_ptr              theObject,
+                                   const SMESH::smIdType_array &          IDsOfFixedNodes,
+                                   CORBA::Short                           MaxNbOfIterations,
+                                   CORBA::Double                          MaxAspectRatio,
+                                   SMESH::SMESH_MeshEditor::Smooth_Method Method,
+                                   CORBA::Boolean                         IsParametric,
+                                   CORBA::Short                           NbThreads,
+                                   CORBA::Double                          MaxDisplacement)
+{
+  SMESH_TRY;
+  initData();
+
+  TPythonDump aTPythonDump;  // suppress dump in smooth()
+
+  int nbThreads = NbThreads;
+  if ( nbThreads <= 0 )
+    nbThreads = std::max( 1U, std::thread::hardware_concurrency() );
+
+  prepareIdSource( theObject );
+  SMESH::smIdType_array_var anElementsId = theObject->GetIDs();
+  CORBA::Boolean isDone = smooth (anElementsId, IDsOfFixedNodes, MaxNbOfIterations,
+                                  MaxAspectRatio, Method, IsParametric,
+                                  nbThreads, MaxDisplacement);
+
+  // Update Python script
+  aTPythonDump << "isDone = " << this << ".SmoothParallel( "
+               << theObject << ", " << IDsOfFixedNodes << ", "
+               << TVar( MaxNbOfIterations ) << ", " << TVar( MaxAspectRatio ) << ", "
+               << "SMESH.SMESH_MeshEditor."
+               << ( Method == SMESH::SMESH_MeshEditor::CENTROIDAL_SMOOTH ?
+                    "CENTROIDAL_SMOOTH, " : "LAPLACIAN_SMOOTH, ")
+               << IsParametric << ", " << NbThreads << ", " << TVar( MaxDisplacement ) << " )";
+
+  return isDone;
+
+  SMESH_CATCH( SMESH::throwCorbaException );
+  return 0;
+}
+
 //=============================================================================
 /*!
  *
@@ -4966,6 +5021,162 @@ CORBA::Short SMESH_MeshEditor_i::GetPointState(CORBA::Double x,
   return 0;
 }
 
+namespace
+{
+  //================================================================================
+  /*!
+   * \brief Return points given by coordinates [x1,y1,z1, x2,y2,z2, ...]
+   */
+  //================================================================================
+
+  void getPoints( const SMESH::double_array& coords, std::vector< gp_XYZ >& points )
+  {
+    if ( coords.length() % 3 )
+      THROW_SALOME_CORBA_EXCEPTION("Number of coordinates is not a multiple of 3",
+                                   SALOME::BAD_PARAM);
+    points.resize( coords.length() / 3 );
+    for ( size_t i = 0; i < points.size(); ++i )
+      points[i].SetCoord( coords[ 3*i ], coords[ 3*i+1 ], coords[ 3*i+2 ]);
+  }
+}
+
+//=======================================================================
+//function : FindElementsByPoints
+//purpose  : Return for each of points an element of given type where the point is IN or ON.
+//           Zero ID is returned for a point out of all elements.
+//=======================================================================
+
+SMESH::smIdType_array*
+SMESH_MeshEditor_i::FindElementsByPoints(const SMESH::double_array& coords,
+                                         SMESH::ElementType         type)
+{
+  std::vector< gp_XYZ > points;
+  getPoints( coords, points );
+
+  SMESH_TRY;
+  SMESH::smIdType_array_var res = new SMESH::smIdType_array;
+  std::vector< const SMDS_MeshElement* > foundElems;
+
+  theSearchersDeleter.Set( myMesh );
+  if ( !theElementSearcher ) {
+    theElementSearcher = SMESH_MeshAlgos::GetElementSearcher( *getMeshDS() );
+  }
+  theElementSearcher->FindElementsByPoints( points, SMDSAbs_ElementType( type ), foundElems );
+
+  res->length( foundElems.size() );
+  for ( size_t i = 0; i < foundElems.size(); ++i )
+    res[i] = foundElems[i] ? foundElems[i]->GetID() : 0;
+
+  return res._retn();
+
+  SMESH_CATCH( SMESH::throwCorbaException );
+  return 0;
+}
+
+//=======================================================================
+//function : ProjectPoints
+//purpose  : Project points to a mesh object.
+//           Return IDs of elements of given type where the points are projected
+//           and coordinates of the projection points.
+//           In the case if nothing found for a point, its ID is -1
+//=======================================================================
+
+SMESH::smIdType_array*
+SMESH_MeshEditor_i::ProjectPoints(const SMESH::double_array& coords,
+                                  SMESH::ElementType         type,
+                                  SMESH::SMESH_IDSource_ptr  meshObject,
+                                  SMESH::double_array_out    projections)
+{
+  if ( CORBA::is_nil( meshObject ))
+    THROW_SALOME_CORBA_EXCEPTION("NULL meshObject", SALOME::BAD_PARAM);
+
+  std::vector< gp_XYZ > points;
+  getPoints( coords, points );
+
+  SMESH_TRY;
+
+  SMESH::SMESH_Mesh_var mesh = meshObject->GetMesh();
+  SMESH_Mesh_i*       mesh_i = SMESH::DownCast<SMESH_Mesh_i*>( mesh );
+  if ( mesh_i != myMesh_i )
+  {
+    SMESH::SMESH_MeshEditor_var editor=
+      myIsPreviewMode ? mesh_i->GetMeshEditPreviewer() : mesh_i->GetMeshEditor();
+    return editor->ProjectPoints( coords, type, meshObject, projections );
+  }
+
+  SMESH::smIdType_array_var res = new SMESH::smIdType_array;
+  projections = new SMESH::double_array();
+  projections->length( coords.length() );
+  res->length( points.size() );
+  for ( size_t i = 0; i < coords.length(); ++i )
+    projections[i] = 0;
+  for ( size_t i = 0; i < points.size(); ++i )
+    res[i] = -1;
+
+  theSearchersDeleter.Set( myMesh, getPartIOR( meshObject, type ));
+  if ( !theElementSearcher )
+  {
+    // create a searcher from meshObject
+
+    SMDS_ElemIteratorPtr elemIt;
+    if ( ! SMESH::DownCast<SMESH_Mesh_i*>( meshObject ))
+    {
+      prepareIdSource( meshObject );
+      elemIt = myMesh_i->GetElements( meshObject, type );
+      if ( !elemIt )
+        return res._retn();
+    }
+    theElementSearcher = SMESH_MeshAlgos::GetElementSearcher( *getMeshDS(), elemIt );
+  }
+
+  std::vector< gp_XYZ >                  pProj;
+  std::vector< const SMDS_MeshElement* > elems;
+  theElementSearcher->ProjectPoints( points, SMDSAbs_ElementType( type ), pProj, &elems );
+
+  for ( size_t i = 0; i < points.size(); ++i )
+    if ( elems[i] && !elems[i]->IsNull() )
+    {
+      res[i] = elems[i]->GetID();
+      projections[ 3*i   ] = pProj[i].X();
+      projections[ 3*i+1 ] = pProj[i].Y();
+      projections[ 3*i+2 ] = pProj[i].Z();
+    }
+
+  return res._retn();
+
+  SMESH_CATCH( SMESH::throwCorbaException );
+  return 0;
+}
+
+//=======================================================================
+//function : GetPointStates
+//purpose  : Return states of points in a closed 2D mesh in terms of TopAbs_State enumeration.
+//=======================================================================
+
+SMESH::long_array* SMESH_MeshEditor_i::GetPointStates(const SMESH::double_array& coords)
+{
+  std::vector< gp_XYZ > points;
+  getPoints( coords, points );
+
+  SMESH_TRY;
+  theSearchersDeleter.Set( myMesh );
+  if ( !theElementSearcher ) {
+    theElementSearcher = SMESH_MeshAlgos::GetElementSearcher( *getMeshDS() );
+  }
+  std::vector< TopAbs_State > states;
+  theElementSearcher->GetPointStates( points, states );
+
+  SMESH::long_array_var res = new SMESH::long_array;
+  res->length( states.size() );
+  for ( size_t i = 0; i < states.size(); ++i )
+    res[i] = states[i];
+
+  return res._retn();
+
+  SMESH_CATCH( SMESH::throwCorbaException );
+  return 0;
+}
+
 //=======================================================================
 //function : IsManifold
 //purpose  : Check if a 2D mesh is manifold
@@ -5983,9 +6194,10 @@ void SMESH_MeshEditor_i::prepareIdSource(SMESH::SMESH_IDSource_ptr theObject)
  */
 //================================================================================
 
+template< class TElemSet >
 bool SMESH_MeshEditor_i::idSourceToSet(SMESH::SMESH_IDSource_ptr  theIDSource,
                                        const SMESHDS_Mesh*        theMeshDS,
-                                       TIDSortedElemSet&          theElemSet,
+                                       TElemSet&                  theElemSet,
                                        const SMDSAbs_ElementType  theType,
                                        const bool                 emptyIfIsMesh,
                                        IDSource_Error*            error)
@@ -6073,7 +6285,7 @@ SMESH_MeshEditor_i::DoubleElements(SMESH::SMESH_IDSource_ptr theElements,
 
   TPythonDump pyDump;
 
-  TIDSortedElemSet elems;
+  TIDSortedElemVec elems;
   if ( idSourceToSet( theElements, getMeshDS(), elems, SMDSAbs_All, /*emptyIfIsMesh=*/true))
   {
     getEditor().DoubleElements( elems );
@@ -6398,7 +6610,7 @@ CORBA::Boolean SMESH_MeshEditor_i::DoubleNodeElem( const SMESH::smIdType_array&
   initData();
 
   SMESHDS_Mesh* aMeshDS = getMeshDS();
-  TIDSortedElemSet anElems, aNodes, anAffected;
+  TIDSortedElemVec anElems, aNodes, anAffected;
   arrayToSet(theElems, aMeshDS, anElems, SMDSAbs_All);
   arrayToSet(theNodesNot, aMeshDS, aNodes, SMDSAbs_Node);
   arrayToSet(theAffectedElems, aMeshDS, anAffected, SMDSAbs_All);
@@ -6439,7 +6651,7 @@ CORBA::Boolean SMESH_MeshEditor_i::DoubleNodeElemInRegion ( const SMESH::smIdTyp
 
 
   SMESHDS_Mesh* aMeshDS = getMeshDS();
-  TIDSortedElemSet anElems, aNodes;
+  TIDSortedElemVec anElems, aNodes;
   arrayToSet(theElems, aMeshDS, anElems, SMDSAbs_All);
   arrayToSet(theNodesNot, aMeshDS, aNodes, SMDSAbs_Node);
 
@@ -6482,7 +6694,7 @@ SMESH_MeshEditor_i::DoubleNodeElemGroup(SMESH::SMESH_GroupBase_ptr theElems,
 
 
   SMESHDS_Mesh* aMeshDS = getMeshDS();
-  TIDSortedElemSet anElems, aNodes, anAffected;
+  TIDSortedElemVec anElems, aNodes, anAffected;
   idSourceToSet( theElems, aMeshDS, anElems, SMDSAbs_All );
   idSourceToSet( theNodesNot, aMeshDS, aNodes, SMDSAbs_Node );
   idSourceToSet( theAffectedElems, aMeshDS, anAffected, SMDSAbs_All );
@@ -6566,7 +6778,7 @@ SMESH_MeshEditor_i::DoubleNodeElemGroup2New(SMESH::SMESH_GroupBase_ptr theElems,
 
 
   SMESHDS_Mesh* aMeshDS = getMeshDS();
-  TIDSortedElemSet anElems, aNodes, anAffected;
+  TIDSortedElemVec anElems, aNodes, anAffected;
   idSourceToSet( theElems, aMeshDS, anElems, SMDSAbs_All );
   idSourceToSet( theNodesNot, aMeshDS, aNodes, SMDSAbs_Node );
   idSourceToSet( theAffectedElems, aMeshDS, anAffected, SMDSAbs_All );
@@ -6646,7 +6858,7 @@ SMESH_MeshEditor_i::DoubleNodeElemGroupInRegion(SMESH::SMESH_GroupBase_ptr theEl
 
 
   SMESHDS_Mesh* aMeshDS = getMeshDS();
-  TIDSortedElemSet anElems, aNodes, anAffected;
+  TIDSortedElemVec anElems, aNodes, anAffected;
   idSourceToSet( theElems, aMeshDS, anElems, SMDSAbs_All );
   idSourceToSet( theNodesNot, aMeshDS, aNodes, SMDSAbs_Node );
 
@@ -6667,7 +6879,7 @@ SMESH_MeshEditor_i::DoubleNodeElemGroupInRegion(SMESH::SMESH_GroupBase_ptr theEl
 
 //================================================================================
 /*!
- * \brief Re-load elements from a list of groups into a TIDSortedElemSet
+ * \brief Re-load elements from a list of groups into a TIDSortedElemSet or TIDSortedElemVec
  *  \param [in] theGrpList - groups
  *  \param [in] theMeshDS -  mesh
  *  \param [out] theElemSet - set of elements
@@ -6675,9 +6887,10 @@ SMESH_MeshEditor_i::DoubleNodeElemGroupInRegion(SMESH::SMESH_GroupBase_ptr theEl
  */
 //================================================================================
 
+template< class TElemSet >
 static void listOfGroupToSet(const SMESH::ListOfGroups& theGrpList,
                              SMESHDS_Mesh*              theMeshDS,
-                             TIDSortedElemSet&          theElemSet,
+                             TElemSet&                  theElemSet,
                              const bool                 theIsNodeGrp)
 {
   for ( int i = 0, n = theGrpList.length(); i < n; i++ )
@@ -6715,7 +6928,7 @@ SMESH_MeshEditor_i::DoubleNodeElemGroups(const SMESH::ListOfGroups& theElems,
 
 
   SMESHDS_Mesh* aMeshDS = getMeshDS();
-  TIDSortedElemSet anElems, aNodes, anAffected;
+  TIDSortedElemVec anElems, aNodes, anAffected;
   listOfGroupToSet(theElems, aMeshDS, anElems, false );
   listOfGroupToSet(theNodesNot, aMeshDS, aNodes, true );
   listOfGroupToSet(theAffectedElems, aMeshDS, anAffected, false );
@@ -6796,7 +7009,7 @@ SMESH_MeshEditor_i::DoubleNodeElemGroups2New(const SMESH::ListOfGroups& theElems
 
 
   SMESHDS_Mesh* aMeshDS = getMeshDS();
-  TIDSortedElemSet anElems, aNodes, anAffected;
+  TIDSortedElemVec anElems, aNodes, anAffected;
   listOfGroupToSet(theElems, aMeshDS, anElems, false );
   listOfGroupToSet(theNodesNot, aMeshDS, aNodes, true );
   listOfGroupToSet(theAffectedElems, aMeshDS, anAffected, false );
@@ -6872,7 +7085,7 @@ SMESH_MeshEditor_i::DoubleNodeElemGroupsInRegion(const SMESH::ListOfGroups& theE
 
 
   SMESHDS_Mesh* aMeshDS = getMeshDS();
-  TIDSortedElemSet anElems, aNodes;
+  TIDSortedElemVec anElems, aNodes;
   listOfGroupToSet(theElems, aMeshDS, anElems,false );
   listOfGroupToSet(theNodesNot, aMeshDS, aNodes, true );
 
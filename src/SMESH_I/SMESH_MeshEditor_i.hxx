@@ -290,12 +290,22 @@ public:
                                         CORBA::Short                           MaxNbOfIterations,
                                         CORBA::Double                          MaxAspectRatio,
                                         SMESH::SMESH_MeshEditor::Smooth_Method Method);
+  CORBA::Boolean SmoothParallel(SMESH::SMESH_IDSource_ptr              theObject,
+                                const SMESH::smIdType_array &          IDsOfFixedNodes,
+                                CORBA::Short                           MaxNbOfIterations,
+                                CORBA::Double                          MaxAspectRatio,
+                                SMESH::SMESH_MeshEditor::Smooth_Method Method,
+                                CORBA::Boolean                         IsParametric,
+                                CORBA::Short                           NbThreads,
+                                CORBA::Double                          MaxDisplacement);
   CORBA::Boolean smooth(const SMESH::smIdType_array &          IDsOfElements,
                         const SMESH::smIdType_array &          IDsOfFixedNodes,
                         CORBA::Short                           MaxNbOfIterations,
                         CORBA::Double                          MaxAspectRatio,
                         SMESH::SMESH_MeshEditor::Smooth_Method Method,
-                        bool                                   IsParametric);
+                        bool                                   IsParametric,
+                        int                                    NbThreads = 1,
+                        double                                 MaxDisplacement = 0.);
   CORBA::Boolean smoothObject(SMESH::SMESH_IDSource_ptr              theObject,
                               const SMESH::smIdType_array &          IDsOfFixedNodes,
                               CORBA::Short                           MaxNbOfIterations,
@@ -530,6 +540,26 @@ public:
    */
   CORBA::Short GetPointState(CORBA::Double x, CORBA::Double y, CORBA::Double z);
 
+  /*!
+   * Return for each of points an element of given type where the point is IN or ON.
+   * Zero ID is returned for a point out of all elements.
+   */
+  SMESH::smIdType_array* FindElementsByPoints(const SMESH::double_array& coords,
+                                              SMESH::ElementType         type);
+  /*!
+   * Project points to a mesh object.
+   * Return IDs of elements of given type where the points are projected
+   * and coordinates of the projection points.
+   */
+  SMESH::smIdType_array* ProjectPoints(const SMESH::double_array& coords,
+                                       SMESH::ElementType         type,
+                                       SMESH::SMESH_IDSource_ptr  meshObject,
+                                       SMESH::double_array_out    projections);
+  /*!
+   * Return states of points in a closed 2D mesh in terms of TopAbs_State enumeration.
+   */
+  SMESH::long_array* GetPointStates(const SMESH::double_array& coords);
+
   /*!
    * Check if a 2D mesh is manifold
    */
@@ -930,9 +960,10 @@ public:
 
   enum IDSource_Error { IDSource_OK, IDSource_INVALID, IDSource_EMPTY };
 
+  template< class TElemSet > // TIDSortedElemSet or TIDSortedElemVec
   bool idSourceToSet(SMESH::SMESH_IDSource_ptr  theIDSource,
                      const SMESHDS_Mesh*        theMeshDS,
-                     TIDSortedElemSet&          theElemSet,
+                     TElemSet&                  theElemSet,
                      const SMDSAbs_ElementType  theType,
                      const bool                 emptyIfIsMesh = false,
                      IDSource_Error*            error = 0);
@@ -35,6 +35,7 @@
 #include "SMDS_FacePosition.hxx"
 #include "SMDS_IteratorOnIterators.hxx"
 #include "SMDS_MeshGroup.hxx"
+#include "SMDS_MeshVolume.hxx"
 #include "SMDS_SetIterator.hxx"
 #include "SMDS_StdIterator.hxx"
 #include "SMDS_VolumeTool.hxx"
@@ -391,12 +392,14 @@ static SMESH::ComputeError* ConvertComputeError( SMESH_ComputeErrorPtr errorPtr
 //=============================================================================
 
 SMESH::DriverMED_ReadStatus
-SMESH_Mesh_i::ImportMEDFile( const char* theFileName, const char* theMeshName )
+SMESH_Mesh_i::ImportMEDFile( const char*                  theFileName,
+                             const char*                  theMeshName,
+                             const std::set<std::string>& theGroupsToRead )
 {
   Unexpect aCatch(SALOME_SalomeException);
   int status;
   try {
-    status = _impl->MEDToMesh( theFileName, theMeshName );
+    status = _impl->MEDToMesh( theFileName, theMeshName, theGroupsToRead );
   }
   catch( SALOME_Exception& S_ex ) {
     THROW_SALOME_CORBA_EXCEPTION(S_ex.what(), SALOME::BAD_PARAM);
@@ -3381,34 +3384,29 @@ SMESH::log_array * SMESH_Mesh_i::GetLog(CORBA::Boolean clearAfterGet)
   if ( _preMeshInfo )
     _preMeshInfo->FullLoadFromFile();
 
-  list < SMESHDS_Command * >logDS = _impl->GetLog();
+  const list < SMESHDS_Command * >& logDS = _impl->GetLog();
   aLog = new SMESH::log_array;
   int indexLog = 0;
   int lg = logDS.size();
   aLog->length(lg);
-  list < SMESHDS_Command * >::iterator its = logDS.begin();
+  list < SMESHDS_Command * >::const_iterator its = logDS.begin();
   while(its != logDS.end()){
     SMESHDS_Command *com = *its;
     int comType = com->GetType();
     smIdType lgcom = com->GetNumber();
-    const list < smIdType >&intList = com->GetIndexes();
-    int inum = intList.size();
-    list < smIdType >::const_iterator ii = intList.begin();
-    const list < double >&coordList = com->GetCoords();
-    int rnum = coordList.size();
-    list < double >::const_iterator ir = coordList.begin();
-    aLog[indexLog].commandType = comType;
-    aLog[indexLog].number = lgcom;
-    aLog[indexLog].coords.length(rnum);
-    aLog[indexLog].indexes.length(inum);
-    for(int i = 0; i < rnum; i++){
-      aLog[indexLog].coords[i] = *ir;
-      ir++;
-    }
-    for(int i = 0; i < inum; i++){
-      aLog[indexLog].indexes[i] = *ii;
-      ii++;
-    }
+    const vector < smIdType >& intList = com->GetIndexes();
+    const vector < double >& coordList = com->GetCoords();
+    CORBA::ULong inum = intList.size();
+    CORBA::ULong rnum = coordList.size();
+    SMESH::log_block& block = aLog[indexLog];
+    block.commandType = comType;
+    block.number = lgcom;
+    block.coords.length(rnum);
+    block.indexes.length(inum);
+    for ( CORBA::ULong i = 0; i < rnum; i++ )
+      block.coords[i] = coordList[i];
+    for ( CORBA::ULong i = 0; i < inum; i++ )
+      block.indexes[i] = intList[i];
     indexLog++;
     its++;
   }
@@ -5931,6 +5929,138 @@ SMESH::double_array* SMESH_Mesh_i::BaryCenter(const SMESH::smIdType id)
   return aResult._retn();
 }
 
+//================================================================================
+/*!
+ * \brief Return an iterator on elements of given type of a mesh part. A nil
+ *        mesh part stands for the whole mesh
+ */
+//================================================================================
+
+namespace
+{
+  SMDS_ElemIteratorPtr getPartIterator( SMESH_Mesh_i*             mesh_i,
+                                        SMESH::SMESH_IDSource_ptr meshPart,
+                                        SMESH::ElementType        type )
+  {
+    if ( CORBA::is_nil( meshPart ) || SMESH::DownCast< SMESH_Mesh_i* >( meshPart ))
+      return mesh_i->GetImpl().GetMeshDS()->elementsIterator( SMDSAbs_ElementType( type ));
+
+    SMESH::SMESH_Mesh_var mesh = meshPart->GetMesh();
+    if ( mesh->GetId() != mesh_i->GetId() )
+      THROW_SALOME_CORBA_EXCEPTION("Wrong mesh of IDSource", SALOME::BAD_PARAM);
+
+    return SMESH_Mesh_i::GetElements( meshPart, type );
+  }
+}
+
+//=============================================================================
+/*!
+ * Return XYZ coordinates of all nodes of a mesh part as one array
+ * [ x1, y1, z1, x2, y2, z2, ... ] and IDs of the nodes via nodeIDs
+ */
+//=============================================================================
+
+SMESH::double_array* SMESH_Mesh_i::GetNodesXYZ(SMESH::SMESH_IDSource_ptr  meshPart,
+                                               SMESH::smIdType_array_out nodeIDs)
+{
+  SMESH::double_array_var   coords = new SMESH::double_array();
+  SMESH::smIdType_array_var ids    = new SMESH::smIdType_array();
+  SMESH_TRY;
+
+  if ( _preMeshInfo )
+    _preMeshInfo->FullLoadFromFile();
+
+  std::vector< const SMDS_MeshElement* > nodes;
+  if ( CORBA::is_nil( meshPart ) || SMESH::DownCast< SMESH_Mesh_i* >( meshPart ))
+    nodes.reserve( _impl->GetMeshDS()->NbNodes() );
+  if ( SMDS_ElemIteratorPtr nIt = getPartIterator( this, meshPart, SMESH::NODE ))
+    while ( nIt->more() )
+      nodes.push_back( nIt->next() );
+
+  coords->length( 3 * nodes.size() );
+  ids->length( nodes.size() );
+  for ( size_t i = 0; i < nodes.size(); ++i )
+  {
+    const SMDS_MeshNode* node = static_cast< const SMDS_MeshNode* >( nodes[ i ]);
+    node->GetXYZ( & coords[ 3 * i ]);
+    ids[ i ] = node->GetID();
+  }
+
+  SMESH_CATCH( SMESH::throwCorbaException );
+
+  nodeIDs = ids._retn();
+  return coords._retn();
+}
+
+//=============================================================================
+/*!
+ * Return connectivity of elements of a mesh part in compressed sparse row format
+ */
+//=============================================================================
+
+SMESH::ElementsConnectivity*
+SMESH_Mesh_i::GetElementsConnectivity(SMESH::SMESH_IDSource_ptr meshPart,
+                                      SMESH::ElementType        elemType)
+{
+  SMESH::ElementsConnectivity_var conn = new SMESH::ElementsConnectivity();
+  SMESH_TRY;
+
+  if ( elemType == SMESH::NODE )
+    THROW_SALOME_CORBA_EXCEPTION("Use GetNodesXYZ() to get nodes", SALOME::BAD_PARAM);
+
+  if ( _preMeshInfo )
+    _preMeshInfo->FullLoadFromFile();
+
+  // collect elements to allocate the arrays at once
+
+  std::vector< const SMDS_MeshElement* > elems;
+  if ( CORBA::is_nil( meshPart ) || SMESH::DownCast< SMESH_Mesh_i* >( meshPart ))
+    elems.reserve( _impl->GetMeshDS()->GetMeshInfo().NbElements( SMDSAbs_ElementType( elemType )));
+  size_t nbNodes = 0, nbQuant = 0;
+  if ( SMDS_ElemIteratorPtr eIt = getPartIterator( this, meshPart, elemType ))
+    while ( eIt->more() )
+    {
+      const SMDS_MeshElement* elem = eIt->next();
+      if ( elem->GetType() == SMDSAbs_Node )
+        continue;
+      elems.push_back( elem );
+      nbNodes += elem->NbNodes();
+      if ( elem->GetEntityType() == SMDSEntity_Polyhedra )
+        nbQuant += elem->NbFaces();
+    }
+
+  conn->elemIDs.length( elems.size() );
+  conn->entityTypes.length( elems.size() );
+  conn->offsets.length( elems.size() + 1 );
+  conn->nodeIDs.length( nbNodes );
+  conn->polyQuantities.length( nbQuant );
+
+  size_t iN = 0, iQ = 0;
+  for ( size_t i = 0; i < elems.size(); ++i )
+  {
+    const SMDS_MeshElement* elem = elems[ i ];
+    conn->elemIDs    [ i ] = elem->GetID();
+    conn->entityTypes[ i ] = elem->GetEntityType();
+    conn->offsets    [ i ] = iN;
+
+    for ( SMDS_NodeIteratorPtr nIt = elem->nodeIterator(); nIt->more(); )
+      conn->nodeIDs[ iN++ ] = nIt->next()->GetID();
+
+    if ( elem->GetEntityType() == SMDSEntity_Polyhedra )
+    {
+      const SMDS_MeshVolume* poly = static_cast< const SMDS_MeshVolume* >( elem );
+      std::vector<int> quantities = poly->GetQuantities();
+      for ( size_t iF = 0; iF < quantities.size(); ++iF )
+        conn->polyQuantities[ iQ++ ] = quantities[ iF ];
+    }
+  }
+  conn->offsets[ elems.size() ] = iN;
+
+  SMESH_CATCH( SMESH::throwCorbaException );
+
+  return conn._retn();
+}
+
 //================================================================================
 /*!
  * \brief Create a group of elements preventing computation of a sub-shape
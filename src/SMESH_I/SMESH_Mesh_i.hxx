@@ -42,6 +42,7 @@
 #include CORBA_CLIENT_HEADER(GEOM_Gen)
 
 #include <map>
+#include <set>
 
 class SMESH_Gen_i;
 class SMESH_GroupBase_i;
@@ -175,9 +176,13 @@ public:
                                       bool        theMakeRequiredGroups);
 
   /*!
-   * consult DriverMED_R_SMESHDS_Mesh::ReadStatus for returned value
+   * consult DriverMED_R_SMESHDS_Mesh::ReadStatus for returned value.
+   * If theGroupsToRead is not empty, only elements of these groups are read
    */
-  SMESH::DriverMED_ReadStatus ImportMEDFile( const char* theFileName, const char* theMeshName );
+  SMESH::DriverMED_ReadStatus
+  ImportMEDFile( const char*                  theFileName,
+                 const char*                  theMeshName,
+                 const std::set<std::string>& theGroupsToRead = std::set<std::string>() );
 
   SMESH::DriverMED_ReadStatus ImportCGNSFile( const char*  theFileName,
                                               const int    theMeshIndex,
@@ -565,6 +570,18 @@ public:
    */
   SMESH::double_array* BaryCenter(SMESH::smIdType id);
 
+  /*!
+   * Returns XYZ coordinates of all nodes of a mesh part as one array
+   */
+  SMESH::double_array* GetNodesXYZ(SMESH::SMESH_IDSource_ptr  meshPart,
+                                   SMESH::smIdType_array_out nodeIDs);
+
+  /*!
+   * Returns connectivity of elements of a mesh part in compressed sparse row format
+   */
+  SMESH::ElementsConnectivity* GetElementsConnectivity(SMESH::SMESH_IDSource_ptr meshPart,
+                                                       SMESH::ElementType        elemType);
+
   /*!
    * Returns information about imported MED file
    */
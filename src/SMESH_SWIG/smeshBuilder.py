@@ -696,16 +696,27 @@ class smeshBuilder( SMESH._objref_SMESH_Gen, object ):
         aMesh = Mesh(self, self.geompyD, aSmeshMesh)
         return aMesh
 
-    def CreateMeshesFromMED( self,theFileName ):
+    def CreateMeshesFromMED( self, theFileName, theGroupNames=[] ):
         """
         Create a Mesh object(s) importing data from the given MED file
 
+        Parameters:
+                theFileName: MED file name
+                theGroupNames: names of groups to read. If given, only elements of these
+                        groups and nodes they are built on are read
+
         Returns:
                 a tuple ( list of class :class:`Mesh` instances,
                 :class:`SMESH.DriverMED_ReadStatus` )
         """
 
-        aSmeshMeshes, aStatus = SMESH._objref_SMESH_Gen.CreateMeshesFromMED(self,theFileName)
+        if theGroupNames:
+            if isinstance( theGroupNames, str ):
+                theGroupNames = [ theGroupNames ]
+            aSmeshMeshes, aStatus = SMESH._objref_SMESH_Gen.CreateMeshesFromMEDGroups( self, theFileName,
+                                                                                       theGroupNames )
+        else:
+            aSmeshMeshes, aStatus = SMESH._objref_SMESH_Gen.CreateMeshesFromMED( self, theFileName )
         aMeshes = [ Mesh(self, self.geompyD, m) for m in aSmeshMeshes ]
         return aMeshes, aStatus
 
@@ -921,6 +932,22 @@ class smeshBuilder( SMESH._objref_SMESH_Gen, object ):
 
         SMESH._objref_SMESH_Gen.SetBoundaryBoxSegmentation(self,nbSegments)
 
+    def SetMemoryBudget(self, megabytes):
+        """
+        Set a limit of memory in megabytes used by all meshes. Compute of a mesh
+        exceeding it stops with "Not enough memory" compute error instead of a crash.
+        Zero value (default) means no limit.
+        """
+
+        SMESH._objref_SMESH_Gen.SetMemoryBudget(self,megabytes)
+
+    def GetMemoryBudget(self):
+        """
+        Return a limit of memory in megabytes used by all meshes, zero means no limit.
+        """
+
+        return SMESH._objref_SMESH_Gen.GetMemoryBudget(self)
+
     # Filtering. Auxiliary functions:
     # ------------------------------
 
@@ -4025,6 +4052,41 @@ class Mesh(metaclass = MeshMeta):
 
         return self.mesh.BaryCenter(id)
 
+    def GetNodesXYZ(self, meshPart=None):
+        """
+        Get XYZ coordinates of all nodes of a mesh part by one call.
+
+        Parameters:
+                meshPart: :class:`sub-mesh, group or filter <SMESH.SMESH_IDSource>`;
+                        if None, nodes of the whole mesh are returned
+
+        Returns:
+            a flat list of coordinates [x1, y1, z1, x2, y2, z2, ...] and a list of node IDs
+        """
+
+        if isinstance( meshPart, Mesh ):
+            meshPart = meshPart.GetMesh()
+        return self.mesh.GetNodesXYZ( meshPart )
+
+    def GetElementsConnectivity(self, meshPart=None, elemType=SMESH.ALL):
+        """
+        Get connectivity of elements of a mesh part by one call.
+
+        Parameters:
+                meshPart: :class:`sub-mesh, group or filter <SMESH.SMESH_IDSource>`;
+                        if None, elements of the whole mesh are returned
+                elemType: type of elements (:class:`SMESH.ElementType`)
+
+        Returns:
+            :class:`SMESH.ElementsConnectivity` with fields *elemIDs*, *entityTypes*,
+            *offsets*, *nodeIDs* and *polyQuantities*. Nodes of i-th element are
+            *nodeIDs[ offsets[i] : offsets[i+1] ]*
+        """
+
+        if isinstance( meshPart, Mesh ):
+            meshPart = meshPart.GetMesh()
+        return self.mesh.GetElementsConnectivity( meshPart, elemType )
+
     def GetIdsFromFilter(self, filter, meshParts=[] ):
         """
         Pass mesh elements through the given filter and return IDs of fitting elements
@@ -4637,6 +4699,59 @@ class Mesh(metaclass = MeshMeta):
 
         return self.editor.GetPointState(x, y, z)
 
+    def FindElementsByPoints(self, points, elementType = SMESH.ALL):
+        """
+        Find for each of points an element where the point lays IN or ON.
+        Points are treated in parallel if possible.
+
+        Parameters:
+                points: list of points, each defined by its coordinates (x,y,z)
+                elementType (SMESH.ElementType): type of elements to find; SMESH.ALL type
+                        means elements of any type excluding nodes, discrete and 0D elements.
+
+        Returns:
+            list of IDs of found elements, zero ID for a point out of all elements
+        """
+        coords = [ float(c) for p in points for c in p ]
+        return self.editor.FindElementsByPoints( coords, elementType )
+
+    def ProjectPoints(self, points, elementType, meshObject=None):
+        """
+        Project points to a mesh object.
+        Points are treated in parallel if possible.
+
+        Parameters:
+                points: list of points, each defined by its coordinates (x,y,z)
+                elementType (SMESH.ElementType): type of elements to project to
+                meshObject: a mesh or a part of mesh to project to
+
+        Returns:
+            list of IDs of elements where the points are projected (-1 if nothing found)
+            and list of coordinates (x,y,z) of the projection points
+        """
+        if isinstance( meshObject, Mesh ):
+            meshObject = meshObject.GetMesh()
+        if not meshObject:
+            meshObject = self.GetMesh()
+        coords = [ float(c) for p in points for c in p ]
+        ids, proj = self.editor.ProjectPoints( coords, elementType, meshObject )
+        return ids, [ proj[ i : i+3 ] for i in range( 0, len( proj ), 3 )]
+
+    def GetPointStates(self, points):
+        """
+        Return states of points in a closed 2D mesh in terms of TopAbs_State enumeration:
+        smesh.TopAbs_IN, smesh.TopAbs_OUT, smesh.TopAbs_ON and smesh.TopAbs_UNKNOWN.
+        Points are treated in parallel if possible.
+
+        Parameters:
+                points: list of points, each defined by its coordinates (x,y,z)
+
+        Returns:
+            list of states of the points
+        """
+        coords = [ float(c) for p in points for c in p ]
+        return self.editor.GetPointStates( coords )
+
     def IsManifold(self):
         """
         Check if a 2D mesh is manifold
@@ -5450,6 +5565,39 @@ class Mesh(metaclass = MeshMeta):
         return self.editor.SmoothParametricObject(theObject, IDsOfFixedNodes,
                                                   MaxNbOfIterations, MaxAspectRatio, Method)
 
+    def SmoothParallel(self, theObject, IDsOfFixedNodes,
+                       MaxNbOfIterations, MaxAspectRatio, Method,
+                       IsParametric=False, NbThreads=0, MaxDisplacement=0.):
+        """
+        Smooth elements which belong to the given object using several threads.
+        Nodes not sharing faces are moved simultaneously, so the result does not
+        depend on the number of threads.
+
+        Parameters:
+                theObject: the object to smooth
+                IDsOfFixedNodes: the list of ids of fixed nodes.
+                        Note that nodes built on edges and boundary nodes are always fixed.
+                MaxNbOfIterations: the maximum number of iterations
+                MaxAspectRatio: varies in range [1.0, inf]
+                Method: is either Laplacian (smesh.LAPLACIAN_SMOOTH)
+                        or Centroidal (smesh.CENTROIDAL_SMOOTH)
+                IsParametric: if True, smooth using UV parameters of nodes on geometrical faces
+                NbThreads: number of threads; if <= 0, all available cores are used
+                MaxDisplacement: stop as soon as no node moves by more than this value
+
+        Returns:
+            True in case of success, False otherwise.
+        """
+
+        if ( isinstance( theObject, Mesh )):
+            theObject = theObject.GetMesh()
+        MaxNbOfIterations,MaxAspectRatio,MaxDisplacement,Parameters,hasVars = \
+            ParseParameters(MaxNbOfIterations,MaxAspectRatio,MaxDisplacement)
+        self.mesh.SetParameters(Parameters)
+        return self.editor.SmoothParallel(theObject, IDsOfFixedNodes,
+                                          MaxNbOfIterations, MaxAspectRatio, Method,
+                                          IsParametric, NbThreads, MaxDisplacement)
+
     def ConvertToQuadratic(self, theForce3d=False, theSubMesh=None, theToBiQuad=False):
         """
         Convert the mesh to quadratic or bi-quadratic, deletes old elements, replacing
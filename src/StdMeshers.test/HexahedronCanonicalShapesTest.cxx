@@ -36,8 +36,10 @@
 #include <BRepPrimAPI_MakeSphere.hxx>
 #include <BRepPrimAPI_MakeCone.hxx>
 
+#include <chrono>
 #include <iostream>
 #include <memory>
+#include <thread>
 
 using namespace StdMeshers::Cartesian3D;
 
@@ -93,14 +95,14 @@ void GridInitAndIntersectWithShape (Grid& grid,
 }
 
 /*!
-  * \brief Test runner
+  * \brief Mesh a shape and return the number of created elements
   */
-bool testShape (const TopoDS_Shape theShape,
-                const bool toAddEdges,
-                const bool toCreateFaces,
-                const double theGridSpacing,
-                const double theSizeThreshold,
-                const int theNbCreatedExpected)
+int makeElements (const TopoDS_Shape theShape,
+                  const bool toAddEdges,
+                  const bool toCreateFaces,
+                  const double theGridSpacing,
+                  const double theSizeThreshold,
+                  const int theNumOfThreads = 1)
 {
   std::unique_ptr<SMESH_Mesh> aMesh( new SMESH_Mesh_Test() );
   aMesh->ShapeToMesh( theShape );
@@ -117,13 +119,27 @@ bool testShape (const TopoDS_Shape theShape,
 
   TEdge2faceIDsMap edge2faceIDsMap;
   GridInitAndIntersectWithShape( grid, theGridSpacing, theSizeThreshold,
-                                 theShape, edge2faceIDsMap, 1 );
+                                 theShape, edge2faceIDsMap, theNumOfThreads );
 
   SMESH_subMesh * aSubMesh = aMesh->GetSubMesh(theShape);
   aSubMesh->DependsOn(); // init sub-meshes
 
   Hexahedron hex( &grid );
-  int nbAdded = hex.MakeElements( helper, edge2faceIDsMap, 1 );
+  return hex.MakeElements( helper, edge2faceIDsMap, theNumOfThreads );
+}
+
+/*!
+  * \brief Test runner
+  */
+bool testShape (const TopoDS_Shape theShape,
+                const bool toAddEdges,
+                const bool toCreateFaces,
+                const double theGridSpacing,
+                const double theSizeThreshold,
+                const int theNbCreatedExpected)
+{
+  int nbAdded = makeElements( theShape, toAddEdges, toCreateFaces,
+                              theGridSpacing, theSizeThreshold );
   if (nbAdded != theNbCreatedExpected) {
     std::stringstream buffer;
     buffer << "Number of computed elements does not match: obtained " << nbAdded << " != expected " << theNbCreatedExpected;
@@ -237,9 +253,56 @@ bool testPrimitives()
   return isOK;
 }
 
+/*!
+  * \brief Check that meshing in several threads gives the same elements
+  *        and report the time spent for each number of threads
+  */
+bool testThreadScaling()
+{
+  bool isOK = true;
+
+  gp_Ax2 anAxes (gp::Origin(), gp::DZ());
+  std::vector< std::pair< std::string, TopoDS_Shape > > shapes;
+  shapes.push_back({ "box",      BRepPrimAPI_MakeBox (10, 20, 30).Shape() });
+  shapes.push_back({ "cylinder", BRepPrimAPI_MakeCylinder (anAxes, 20., 30.).Shape() });
+  shapes.push_back({ "sphere",   BRepPrimAPI_MakeSphere (anAxes, 30.).Shape() });
+  shapes.push_back({ "cone",     BRepPrimAPI_MakeCone (anAxes, 30., 15., 20.).Shape() });
+
+  const int maxNbThreads = std::max( 1u, std::thread::hardware_concurrency() );
+  for ( auto& name2shape : shapes )
+  {
+    int nbAdded1 = 0;
+    double time1 = 0;
+    for ( int nbThreads = 1; nbThreads <= maxNbThreads; nbThreads *= 2 )
+    {
+      auto start = std::chrono::steady_clock::now();
+      int nbAdded = makeElements( name2shape.second, /*toAddEdges*/false, /*toCreateFaces*/true,
+                                  /*gridSpacing*/1, /*theSizeThreshold*/4, nbThreads );
+      std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+      if ( nbThreads == 1 )
+      {
+        nbAdded1 = nbAdded;
+        time1    = time.count();
+      }
+      std::cout << name2shape.first << ": " << nbThreads << " threads, "
+                << nbAdded << " elements, " << time.count() << " s, speedup "
+                << time1 / time.count() << std::endl;
+      if ( nbAdded != nbAdded1 )
+      {
+        std::cerr << name2shape.first << ": number of elements computed in " << nbThreads
+                  << " threads " << nbAdded << " != " << nbAdded1 << std::endl;
+        isOK = false;
+      }
+    }
+  }
+  return isOK;
+}
+
 // Entry point for test
 int main()
 {
   bool isOK = testPrimitives();
+  if ( !testThreadScaling() )
+    isOK = false;
   return isOK ? 0 : 1;
 }
@@ -36,9 +36,11 @@
 #include <BRepPrimAPI_MakeSphere.hxx>
 #include <BRepPrimAPI_MakeCone.hxx>
 
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <numeric>
+#include <set>
 
 using namespace StdMeshers::Cartesian3D;
 
@@ -193,12 +195,155 @@ bool testNRTJ4()
   return true;
 }
 
+/*!
+  * \brief Check that memory of the storages of Hexahedron's and of grid node intersections
+  *        depends on the number of cells cut by the geometry rather than on the number
+  *        of grid cells
+  */
+bool testHexaTilesMemory()
+{
+  // radius is not a multiple of the grid spacing to have few intersections at grid nodes
+  TopoDS_Shape aShape = BRepPrimAPI_MakeSphere( 9.87 ).Shape();
+
+  std::unique_ptr<SMESH_Mesh> aMesh( new SMESH_Mesh_Test() );
+  aMesh->ShapeToMesh( aShape );
+  SMESH_MesherHelper helper( *aMesh );
+
+  Grid grid;
+  grid._helper = &helper;
+  grid._toAddEdges = false;
+  grid._toCreateFaces = false;
+  grid._toConsiderInternalFaces = false;
+  grid._toUseThresholdForInternalFaces = false;
+  grid._toUseQuanta = false;
+  grid._sizeThreshold = 4.0;
+
+  TEdge2faceIDsMap edge2faceIDsMap;
+  GridInitAndIntersectWithShape( grid, 0.2, 4.0, aShape, edge2faceIDsMap, 1 );
+
+  // store a Hexahedron in each cell cut by the sphere, as Hexahedron::MakeElements() does
+
+  CellsAroundLink c( &grid, 0 );
+  HexaTiles tiles( c._nbCells );
+  CPPUNIT_ASSERT_MESSAGE( "Empty storage should not allocate tiles", tiles.NbTiles() == 0 );
+
+  Hexahedron hex( &grid );
+  std::set< size_t > cutCells;
+  int i,j,k, cellIndex, iLink;
+  for ( int iDir = 0; iDir < 3; ++iDir )
+  {
+    LineIndexer lineInd = grid.GetLineIndexer( iDir );
+    CellsAroundLink fourCells( &grid, iDir );
+    for ( ; lineInd.More(); ++lineInd )
+    {
+      GridLine& line = grid._lines[ iDir ][ lineInd.LineIndex() ];
+      for ( const F_IntersectPoint& ip : line._intPoints )
+      {
+        lineInd.SetIndexOnLine( ip._indexOnLine );
+        fourCells.Init( lineInd.I(), lineInd.J(), lineInd.K() );
+        for ( int iL = 0; iL < 4; ++iL )
+          if ( fourCells.GetCell( iL, i,j,k, cellIndex, iLink ))
+          {
+            tiles.Set( cellIndex ) = &hex;
+            cutCells.insert( cellIndex );
+          }
+      }
+    }
+  }
+  CPPUNIT_ASSERT_MESSAGE( "The sphere does not cut the grid", !cutCells.empty() );
+
+  const size_t denseHexaSize = tiles.size() * sizeof( Hexahedron* );
+  std::cout << "Memory of Hexahedron storage of " << tiles.size() << " cells, "
+            << cutCells.size() << " cut by a sphere: " << tiles.MemorySize() / 1024
+            << " KB instead of " << denseHexaSize / 1024 << " KB" << std::endl;
+  CPPUNIT_ASSERT_MESSAGE( "Too much memory used by the storage of Hexahedron's",
+                          tiles.MemorySize() < denseHexaSize / 2 );
+
+  std::vector< Hexahedron* > hexes;
+  tiles.GetHexahedra( hexes );
+  CPPUNIT_ASSERT_MESSAGE( "Wrong number of stored hexahedra", hexes.size() == cutCells.size() );
+  CPPUNIT_ASSERT_MESSAGE( "Wrong cell in storage", tiles.Get( *cutCells.rbegin() ) == &hex );
+  const size_t centerCell = grid.CellIndex( c._nbCells[0] / 2, c._nbCells[1] / 2, c._nbCells[2] / 2 );
+  CPPUNIT_ASSERT_MESSAGE( "Wrong empty cell in storage", !tiles.Get( centerCell ));
+
+  // intersections at grid nodes are stored near the sphere only
+
+  const size_t nbGridNodes = grid._coords[0].size() * grid._coords[1].size() * grid._coords[2].size();
+  const size_t denseIntPSize = nbGridNodes * sizeof( F_IntersectPoint* );
+  std::cout << "Memory of grid node intersections of " << nbGridNodes << " nodes: "
+            << grid._gridIntP.MemorySize() / 1024 << " KB instead of "
+            << denseIntPSize / 1024 << " KB" << std::endl;
+  CPPUNIT_ASSERT_MESSAGE( "Too much memory used by the storage of grid node intersections",
+                          grid._gridIntP.MemorySize() < denseIntPSize / 2 );
+  const size_t centerNode = grid.NodeIndex( grid._coords[0].size() / 2,
+                                            grid._coords[1].size() / 2,
+                                            grid._coords[2].size() / 2 );
+  CPPUNIT_ASSERT_MESSAGE( "Intersection at a grid node inside the sphere",
+                          !grid._gridIntP.Get( centerNode ));
+  CPPUNIT_ASSERT_MESSAGE( "No mesh node at a grid node inside the sphere",
+                          grid._nodes[ centerNode ] );
+
+  return true;
+}
+
+/*!
+  * \brief Check that number of elements and computation time grow proportionally
+  *        to the number of grid cells when a box is meshed with a finer grid
+  */
+bool testBoxScaling()
+{
+  TopoDS_Shape aShape = BRepPrimAPI_MakeBox( 10, 10, 10 ).Shape();
+
+  int prevNbAdded = 0;
+  for ( double spacing = 1.0; spacing > 0.2; spacing /= 2 )
+  {
+    std::unique_ptr<SMESH_Mesh> aMesh( new SMESH_Mesh_Test() );
+    aMesh->ShapeToMesh( aShape );
+    SMESH_MesherHelper helper( *aMesh );
+
+    Grid grid;
+    grid._helper = &helper;
+    grid._toAddEdges = false;
+    grid._toCreateFaces = false;
+    grid._toConsiderInternalFaces = false;
+    grid._toUseThresholdForInternalFaces = false;
+    grid._toUseQuanta = false;
+    grid._sizeThreshold = 4.0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    TEdge2faceIDsMap edge2faceIDsMap;
+    GridInitAndIntersectWithShape( grid, spacing, 4.0, aShape, edge2faceIDsMap, 1 );
+
+    SMESH_subMesh * aSubMesh = aMesh->GetSubMesh(aShape);
+    aSubMesh->DependsOn(); // init sub-meshes
+
+    Hexahedron hex( &grid );
+    int nbAdded = hex.MakeElements( helper, edge2faceIDsMap, 1 );
+
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    std::cout << "Box meshed with spacing " << spacing << ": " << nbAdded
+              << " elements in " << time.count() << " s" << std::endl;
+
+    CPPUNIT_ASSERT_MESSAGE( "No elements computed", nbAdded > 0 );
+    if ( prevNbAdded > 0 )
+      CPPUNIT_ASSERT_MESSAGE( "Number of elements does not scale with the number of cells",
+                              nbAdded > 6 * prevNbAdded && nbAdded < 10 * prevNbAdded );
+    prevNbAdded = nbAdded;
+  }
+  return true;
+}
+
 // Entry point for test
 int main()
 {
   bool isOK = testNRTM1();
   if (!testNRTJ4())
     isOK = false;
+  if (!testHexaTilesMemory())
+    isOK = false;
+  if (!testBoxScaling())
+    isOK = false;
 
   return isOK ? 0 : 1;
 }
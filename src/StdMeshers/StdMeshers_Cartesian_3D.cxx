@@ -86,6 +86,7 @@ StdMeshers_Cartesian_3D::StdMeshers_Cartesian_3D(int hypId, SMESH_Gen * gen)
   _onlyUnaryInput = false;          // to mesh all SOLIDs at once
   _requireDiscreteBoundary = false; // 2D mesh not needed
   _supportSubmeshes = false;        // do not use any existing mesh
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
 }
 
 //=============================================================================
@@ -239,7 +240,7 @@ bool StdMeshers_Cartesian_3D::Compute(SMESH_Mesh &         theMesh,
         vector< GridLine >& lines = grid._lines[ iDir ];
         for ( size_t i = 0; i < lines.size(); ++i )
         {
-          multiset< F_IntersectPoint >::iterator ip = lines[i]._intPoints.begin();
+          vector< F_IntersectPoint >::iterator ip = lines[i]._intPoints.begin();
           for ( ; ip != lines[i]._intPoints.end(); ++ip )
             if ( ip->_node &&
                  !ip->_node->IsNull() &&
@@ -262,13 +263,14 @@ bool StdMeshers_Cartesian_3D::Compute(SMESH_Mesh &         theMesh,
           grid._nodes[i]->setIsMarked( true );
         }
 
-      for ( size_t i = 0; i < grid._allBorderNodes.size(); ++i )
-        if ( grid._allBorderNodes[i] &&
-             !grid._allBorderNodes[i]->IsNull() &&
-             grid._allBorderNodes[i]->NbInverseElements() == 0 )
+      std::vector< const SMDS_MeshNode* > borderNodes;
+      grid._allBorderNodes.GetValues( borderNodes );
+      for ( size_t i = 0; i < borderNodes.size(); ++i )
+        if ( !borderNodes[i]->IsNull() &&
+             borderNodes[i]->NbInverseElements() == 0 )
         {
-          nodesToRemove.push_back( grid._allBorderNodes[i] );
-          grid._allBorderNodes[i]->setIsMarked( true );
+          nodesToRemove.push_back( borderNodes[i] );
+          borderNodes[i]->setIsMarked( true );
         }
 
       // do remove
@@ -43,42 +43,49 @@ std::mutex _bMutex;
 
 //=============================================================================
 /*
-  * Remove coincident intersection points
+  * Sort intersection points along the line and remove coincident ones
   */
 void GridLine::RemoveExcessIntPoints( const double tol )
 {
+  // stable sort keeps points with equal parameters in the order of their addition
+  std::stable_sort( _intPoints.begin(), _intPoints.end() );
+
   if ( _intPoints.size() < 2 ) return;
 
   set< Transition > tranSet;
-  multiset< F_IntersectPoint >::iterator ip1, ip2 = _intPoints.begin();
-  while ( ip2 != _intPoints.end() )
+  size_t i1, i2 = 0, nbKept = 0;
+  while ( i2 < _intPoints.size() )
   {
     tranSet.clear();
-    ip1 = ip2++;
-    while ( ip2 != _intPoints.end() && ip2->_paramOnLine - ip1->_paramOnLine <= tol )
+    i1 = i2++;
+    while ( i2 < _intPoints.size() &&
+            _intPoints[ i2 ]._paramOnLine - _intPoints[ i1 ]._paramOnLine <= tol )
     {
-      tranSet.insert( ip1->_transition );
-      tranSet.insert( ip2->_transition );
-      ip2->Add( ip1->_faceIDs );
-      _intPoints.erase( ip1 );
-      ip1 = ip2++;
+      tranSet.insert( _intPoints[ i1 ]._transition );
+      tranSet.insert( _intPoints[ i2 ]._transition );
+      _intPoints[ i2 ].Add( _intPoints[ i1 ]._faceIDs );
+      i1 = i2++;
     }
     if ( tranSet.size() > 1 ) // points with different transition coincide
     {
       bool isIN  = tranSet.count( Trans_IN );
       bool isOUT = tranSet.count( Trans_OUT );
       if ( isIN && isOUT )
-        (*ip1)._transition = Trans_TANGENT;
+        _intPoints[ i1 ]._transition = Trans_TANGENT;
       else
-        (*ip1)._transition = isIN ? Trans_IN : Trans_OUT;
+        _intPoints[ i1 ]._transition = isIN ? Trans_IN : Trans_OUT;
     }
+    if ( nbKept != i1 )
+      _intPoints[ nbKept ] = std::move( _intPoints[ i1 ]);
+    ++nbKept;
   }
+  _intPoints.resize( nbKept );
 }
 //================================================================================
 /*
   * Return ID of SOLID for nodes before the given intersection point
   */
-TGeomID GridLine::GetSolidIDBefore( multiset< F_IntersectPoint >::iterator ip,
+TGeomID GridLine::GetSolidIDBefore( vector< F_IntersectPoint >::iterator ip,
                                     const TGeomID                          prevID,
                                     const Geometry&                        geom )
 {
@@ -95,7 +102,7 @@ TGeomID GridLine::GetSolidIDBefore( multiset< F_IntersectPoint >::iterator ip,
     case Trans_APEX:
     {
       // singularity point (apex of a cone)
-      multiset< F_IntersectPoint >::iterator ipBef = ip, ipAft = ++ip;
+      vector< F_IntersectPoint >::iterator ipBef = ip, ipAft = ++ip;
       if ( ipAft == _intPoints.end() )
         isOut = false;
       else
@@ -763,11 +770,12 @@ void Grid::ComputeUVW(const gp_XYZ& P, double UVW[3])
 void Grid::ComputeNodes(SMESH_MesherHelper& helper)
 {
   // state of each node of the grid relative to the geometry
-  const size_t nbGridNodes = _coords[0].size() * _coords[1].size() * _coords[2].size();
+  const size_t nbNodes[3] = { _coords[0].size(), _coords[1].size(), _coords[2].size() };
+  const size_t nbGridNodes = nbNodes[0] * nbNodes[1] * nbNodes[2];
   vector< TGeomID > shapeIDVec( nbGridNodes, theUndefID );
   _nodes.resize( nbGridNodes, 0 );
-  _allBorderNodes.resize( nbGridNodes, 0 );
-  _gridIntP.resize( nbGridNodes, NULL );
+  _allBorderNodes.Init( nbNodes );
+  _gridIntP.Init( nbNodes );
 
   SMESHDS_Mesh* mesh = helper.GetMeshDS();
 
@@ -792,8 +800,8 @@ void Grid::ComputeNodes(SMESH_MesherHelper& helper)
       const gp_XYZ lineDir = line._line.Direction().XYZ();
 
       line.RemoveExcessIntPoints( _tol );
-      multiset< F_IntersectPoint >&     intPnts = line._intPoints;
-      multiset< F_IntersectPoint >::iterator ip = intPnts.begin();
+      vector< F_IntersectPoint >&     intPnts = line._intPoints;
+      vector< F_IntersectPoint >::iterator ip = intPnts.begin();
 
       // Create mesh nodes at intersections with geometry
       // and set OUT state of nodes between intersections
@@ -843,10 +851,11 @@ void Grid::ComputeNodes(SMESH_MesherHelper& helper)
             //_gridIntP[ nodeIndex ] = & * ip;
             //SetOnShape( _nodes[ nodeIndex ], *ip );
           }
-          if ( _gridIntP[ nodeIndex ] )
-            _gridIntP[ nodeIndex ]->Add( ip->_faceIDs );
+          const F_IntersectPoint* & gridIntP = _gridIntP.Set( nodeIndex );
+          if ( gridIntP )
+            gridIntP->Add( ip->_faceIDs );
           else
-            _gridIntP[ nodeIndex ] = & (*ip);
+            gridIntP = & (*ip);
           // ip->_node        = _nodes[ nodeIndex ]; -- to differ from ip on links
           ip->_indexOnLine = nodeCoord-coord0;
           if ( ++nodeCoord < coordEnd )
@@ -875,20 +884,21 @@ void Grid::ComputeNodes(SMESH_MesherHelper& helper)
           _nodes[ nodeIndex ] = mesh->AddNode( xyz.X(), xyz.Y(), xyz.Z() );
           mesh->SetNodeInVolume( _nodes[ nodeIndex ], shapeIDVec[ nodeIndex ]);
         }
-        else if ( _nodes[ nodeIndex ] && _gridIntP[ nodeIndex ] /*&&
+        else if ( _nodes[ nodeIndex ] && _gridIntP.Get( nodeIndex ) /*&&
                   !_nodes[ nodeIndex]->GetShapeID()*/ )
         {
           TopoDS_Vertex v;
-          SetOnShape( _nodes[ nodeIndex ], *_gridIntP[ nodeIndex ], & v );
-          UpdateFacesOfVertex( *_gridIntP[ nodeIndex ], v );
+          SetOnShape( _nodes[ nodeIndex ], *_gridIntP.Get( nodeIndex ), & v );
+          UpdateFacesOfVertex( *_gridIntP.Get( nodeIndex ), v );
         }
-        else if ( _toUseQuanta && !_allBorderNodes[ nodeIndex ] /*add all nodes outside the body. Used to reconstruct the hexahedrals when polys are not desired!*/)
+        else if ( _toUseQuanta && !_allBorderNodes.Get( nodeIndex ) /*add all nodes outside the body. Used to reconstruct the hexahedrals when polys are not desired!*/)
         {
           gp_XYZ xyz = ( _coords[0][x] * _axes[0] +
                           _coords[1][y] * _axes[1] +
                           _coords[2][z] * _axes[2] );
-          _allBorderNodes[ nodeIndex ] = mesh->AddNode( xyz.X(), xyz.Y(), xyz.Z() );
-          mesh->SetNodeInVolume( _allBorderNodes[ nodeIndex ], shapeIDVec[ nodeIndex ]);
+          const SMDS_MeshNode* & borderNode = _allBorderNodes.Set( nodeIndex );
+          borderNode = mesh->AddNode( xyz.X(), xyz.Y(), xyz.Z() );
+          mesh->SetNodeInVolume( borderNode, shapeIDVec[ nodeIndex ]);
         }
       }
 #ifdef _MY_DEBUG_
@@ -899,7 +909,7 @@ void Grid::ComputeNodes(SMESH_MesherHelper& helper)
     LineIndexer li = GetLineIndexer( iDir );
     for ( ; li.More(); ++li )
     {
-      multiset< F_IntersectPoint >& intPnts = _lines[ iDir ][ li.LineIndex() ]._intPoints;
+      vector< F_IntersectPoint >& intPnts = _lines[ iDir ][ li.LineIndex() ]._intPoints;
       if ( intPnts.empty() ) continue;
       if ( intPnts.size() == 1 )
       {
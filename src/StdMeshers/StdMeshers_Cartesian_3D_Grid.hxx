@@ -290,6 +290,10 @@ namespace Cartesian3D
     mutable std::vector< TGeomID > _faceIDs;
 
     B_IntersectPoint(): _node(NULL) {}
+    B_IntersectPoint( const B_IntersectPoint& ) = default;
+    B_IntersectPoint( B_IntersectPoint&& ) = default; // to sort F_IntersectPoint's fast
+    B_IntersectPoint& operator=( const B_IntersectPoint& ) = default;
+    B_IntersectPoint& operator=( B_IntersectPoint&& ) = default;
     bool Add( const std::vector< TGeomID >& fIDs, const SMDS_MeshNode* n=NULL ) const;
     TGeomID HasCommonFace( const B_IntersectPoint * other, TGeomID avoidFace=-1 ) const;
     size_t GetCommonFaces( const B_IntersectPoint * other, TGeomID * commonFaces ) const;
@@ -332,10 +336,10 @@ namespace Cartesian3D
   {
     gp_Lin _line;
     double _length; // line length
-    std::multiset< F_IntersectPoint > _intPoints;
+    std::vector< F_IntersectPoint > _intPoints; // sorted by RemoveExcessIntPoints()
 
     void RemoveExcessIntPoints( const double tol );
-    TGeomID GetSolidIDBefore( std::multiset< F_IntersectPoint >::iterator ip,
+    TGeomID GetSolidIDBefore( std::vector< F_IntersectPoint >::iterator ip,
                               const TGeomID                          prevID,
                               const Geometry&                        geom);
   };
@@ -410,6 +414,99 @@ namespace Cartesian3D
       static void GetExactBndBox( const std::vector< TopoDS_Shape >& faceVec, const double* axesDirs, Bnd_Box& shapeBox );
   };
 
+  // --------------------------------------------------------------------------
+  /*!
+   * \brief Sparse storage of values at grid nodes, most of which are not set.
+   *
+   * Nodes are grouped into cubic tiles of TileSize^3 nodes. An array of values
+   * is allocated for a tile only when a value of any of its nodes is set, so the
+   * used memory depends on the number of tiles crossed by the geometry boundary
+   * rather than on the number of grid nodes. A value not set is T().
+   * Set() is not thread safe, Get() is.
+   */
+  template< typename T >
+  class GridNodeTiles
+  {
+  public:
+    enum { TileShift = 3, TileSize = 1 << TileShift, TileMask = TileSize - 1,
+           NbNodesInTile = TileSize * TileSize * TileSize };
+
+    //! Remove all values and set nb of grid nodes in 3 directions
+    void Init( const size_t nbNodes[3] )
+    {
+      _tiles.clear();
+      for ( int iDir = 0; iDir < 3; ++iDir )
+      {
+        _nbNodes[ iDir ] = nbNodes[ iDir ];
+        _nbTiles[ iDir ] = ( nbNodes[ iDir ] + TileMask ) >> TileShift;
+      }
+      _tiles.resize( _nbTiles[0] * _nbTiles[1] * _nbTiles[2] );
+    }
+
+    //! Return a value at a node
+    T Get( size_t nodeIndex ) const
+    {
+      size_t indexInTile, iTile = tileIndex( nodeIndex, indexInTile );
+      return _tiles[ iTile ] ? _tiles[ iTile ][ indexInTile ] : T();
+    }
+
+    //! Return a reference to a value at a node, allocate a tile if necessary
+    T& Set( size_t nodeIndex )
+    {
+      size_t indexInTile, iTile = tileIndex( nodeIndex, indexInTile );
+      std::unique_ptr< T[] >& tile = _tiles[ iTile ];
+      if ( !tile )
+        tile.reset( new T[ NbNodesInTile ]() );
+      return tile[ indexInTile ];
+    }
+
+    //! Return all set values, tile by tile
+    void GetValues( std::vector< T >& values ) const
+    {
+      values.clear();
+      for ( const std::unique_ptr< T[] >& tile : _tiles )
+        if ( tile )
+          for ( size_t i = 0; i < NbNodesInTile; ++i )
+            if ( tile[ i ] != T() )
+              values.push_back( tile[ i ]);
+    }
+
+    //! Return nb of allocated tiles
+    size_t NbTiles() const
+    {
+      return std::count_if( _tiles.begin(), _tiles.end(),
+                            []( const std::unique_ptr< T[] >& t ) { return bool( t ); });
+    }
+
+    //! Return size of memory used by the storage, in bytes
+    size_t MemorySize() const
+    {
+      return ( sizeof( *this ) + _tiles.capacity() * sizeof( _tiles[0] ) +
+               NbTiles() * NbNodesInTile * sizeof( T ));
+    }
+
+  private:
+    size_t tileIndex( size_t nodeIndex, size_t& indexInTile ) const
+    {
+      size_t i  = nodeIndex % _nbNodes[0];
+      size_t jk = nodeIndex / _nbNodes[0];
+      size_t j  = jk % _nbNodes[1];
+      size_t k  = jk / _nbNodes[1];
+
+      indexInTile = (( i & TileMask ) +
+                     (( j & TileMask ) << TileShift ) +
+                     (( k & TileMask ) << ( 2 * TileShift )));
+
+      return (( i >> TileShift ) +
+              ( j >> TileShift ) * _nbTiles[0] +
+              ( k >> TileShift ) * _nbTiles[0] * _nbTiles[1] );
+    }
+
+    size_t                                _nbNodes[3] = { 0, 0, 0 };
+    size_t                                _nbTiles[3] = { 0, 0, 0 };
+    std::vector< std::unique_ptr< T[] > > _tiles; // NULL for a tile with no values
+  };
+
   class STDMESHERS_EXPORT Grid
   {
     public:
@@ -423,10 +520,13 @@ namespace Cartesian3D
     // index shift within _nodes of nodes of a cell from the 1st node
     int                    _nodeShift[8];
 
-    std::vector< const SMDS_MeshNode* >    _nodes;          // mesh nodes at grid nodes
-    std::vector< const SMDS_MeshNode* >    _allBorderNodes; // mesh nodes between the bounding box and the geometry boundary
-
-    std::vector< const F_IntersectPoint* > _gridIntP; // grid node intersection with geometry
+    // mesh nodes at grid nodes. It is dense, i.e. it takes a pointer per grid node,
+    // since most grid nodes inside the geometry get a mesh node
+    std::vector< const SMDS_MeshNode* >    _nodes;
+    // mesh nodes between the bounding box and the geometry boundary
+    GridNodeTiles< const SMDS_MeshNode* >    _allBorderNodes;
+    // grid node intersection with geometry, set near the geometry boundary only
+    GridNodeTiles< const F_IntersectPoint* > _gridIntP;
     ObjectPool< E_IntersectPoint >        _edgeIntPool; // intersections with EDGEs
     ObjectPool< F_IntersectPoint >        _extIntPool; // intersections with extended INTERNAL FACEs
     //list< E_IntersectPoint >          _edgeIntP; // intersections with EDGEs
@@ -602,10 +702,10 @@ namespace Cartesian3D
     {
       for ( size_t i = 0; i < _intersections.size(); ++i )
       {
-        std::multiset< F_IntersectPoint >::iterator ip =
-          _intersections[i].first->_intPoints.insert( _intersections[i].second );
-        ip->_faceIDs.reserve( 1 );
-        ip->_faceIDs.push_back( _faceID );
+        std::vector< F_IntersectPoint >& intPoints = _intersections[i].first->_intPoints;
+        intPoints.push_back( _intersections[i].second );
+        intPoints.back()._faceIDs.reserve( 1 );
+        intPoints.back()._faceIDs.push_back( _faceID );
       }
     }
     const Bnd_Box& GetFaceBndBox()
@@ -49,6 +49,20 @@ std::mutex _eMutex;
   };
 #endif
 
+  // --------------------------------------------------------------------------
+  /*!
+   * \brief Range of grid cells treated by one thread and not split hexahedra
+   *        found in it, to be added to the mesh at once
+   */
+  struct HexaRange
+  {
+    size_t                _firstCell, _endCell;
+    vector< smIdType >    _nodeIDs;    // 8 nodes per hexahedron
+    vector< TGeomID >     _solidIDs;   // SOLID per hexahedron
+    vector< bool >        _isBoundary; // whether a hexahedron is to be used to create faces
+    vector< size_t >      _intCells;   // indices of cells to split
+  };
+
 //=============================================================================
 // Implementation of internal utils
 //=============================================================================
@@ -269,6 +283,120 @@ TGeomID findCommonFace( const std::vector< const SMDS_MeshNode* > & nn,
   return faceID;
 }
 
+//================================================================================
+/*!
+  * \brief Create a storage of Hexahedron's for a grid of given nb of cells
+  */
+HexaTiles::HexaTiles( const size_t nbCells[3] )
+{
+  for ( int iDir = 0; iDir < 3; ++iDir )
+  {
+    _nbCells[ iDir ] = nbCells[ iDir ];
+    _nbTiles[ iDir ] = ( nbCells[ iDir ] + TileMask ) >> TileShift;
+  }
+  _tiles.resize( _nbTiles[0] * _nbTiles[1] * _nbTiles[2], 0 );
+}
+
+//================================================================================
+/*!
+  * \brief Release tiles; Hexahedron's are not deleted
+  */
+HexaTiles::~HexaTiles()
+{
+  for ( size_t i = 0; i < _usedTiles.size(); ++i )
+    delete [] _tiles[ _usedTiles[ i ]];
+}
+
+//================================================================================
+/*!
+  * \brief Return index of a tile including a cell and index of the cell within the tile
+  */
+size_t HexaTiles::tileIndex( size_t cellIndex, size_t& indexInTile ) const
+{
+  size_t i  = cellIndex % _nbCells[0];
+  size_t jk = cellIndex / _nbCells[0];
+  size_t j  = jk % _nbCells[1];
+  size_t k  = jk / _nbCells[1];
+
+  indexInTile = (( i & TileMask ) +
+                 (( j & TileMask ) << TileShift ) +
+                 (( k & TileMask ) << ( 2 * TileShift )));
+
+  return (( i >> TileShift ) +
+          ( j >> TileShift ) * _nbTiles[0] +
+          ( k >> TileShift ) * _nbTiles[0] * _nbTiles[1] );
+}
+
+//================================================================================
+/*!
+  * \brief Return a Hexahedron of a cell or NULL
+  */
+Hexahedron* HexaTiles::Get( size_t cellIndex ) const
+{
+  if ( cellIndex >= size() )
+    return 0;
+  size_t indexInTile, iTile = tileIndex( cellIndex, indexInTile );
+  return _tiles[ iTile ] ? _tiles[ iTile ][ indexInTile ] : 0;
+}
+
+//================================================================================
+/*!
+  * \brief Return a reference to a Hexahedron of a cell, allocate a tile if necessary
+  */
+Hexahedron*& HexaTiles::Set( size_t cellIndex )
+{
+  size_t indexInTile, iTile = tileIndex( cellIndex, indexInTile );
+  Hexahedron** & tile = _tiles[ iTile ];
+  if ( !tile )
+  {
+    tile = new Hexahedron*[ NbCellsInTile ];
+    std::fill( tile, tile + NbCellsInTile, (Hexahedron*) 0 );
+    _usedTiles.push_back( iTile );
+  }
+  return tile[ indexInTile ];
+}
+
+//================================================================================
+/*!
+  * \brief Return all stored Hexahedron's in the order of cell indices
+  */
+void HexaTiles::GetHexahedra( std::vector< Hexahedron* >& hexes ) const
+{
+  std::vector< std::pair< size_t, Hexahedron* > > index2hex;
+  for ( size_t iT = 0; iT < _usedTiles.size(); ++iT )
+  {
+    const size_t       iTile = _usedTiles[ iT ];
+    Hexahedron** const  tile = _tiles[ iTile ];
+    const size_t        i0 = ( iTile % _nbTiles[0] ) << TileShift;
+    const size_t        j0 = ( iTile / _nbTiles[0] % _nbTiles[1] ) << TileShift;
+    const size_t        k0 = ( iTile / _nbTiles[0] / _nbTiles[1] ) << TileShift;
+    for ( size_t iC = 0; iC < NbCellsInTile; ++iC )
+      if ( tile[ iC ])
+      {
+        size_t i = i0 + ( iC & TileMask );
+        size_t j = j0 + (( iC >> TileShift ) & TileMask );
+        size_t k = k0 + ( iC >> ( 2 * TileShift ));
+        index2hex.push_back( std::make_pair( i + _nbCells[0] * ( j + _nbCells[1] * k ), tile[ iC ]));
+      }
+  }
+  std::sort( index2hex.begin(), index2hex.end() );
+
+  hexes.resize( index2hex.size() );
+  for ( size_t i = 0; i < index2hex.size(); ++i )
+    hexes[ i ] = index2hex[ i ].second;
+}
+
+//================================================================================
+/*!
+  * \brief Return size of memory used by the storage, in bytes
+  */
+size_t HexaTiles::MemorySize() const
+{
+  return ( sizeof( *this ) +
+           _tiles.capacity()     * sizeof( Hexahedron** ) +
+           _usedTiles.capacity() * sizeof( size_t ) +
+           _usedTiles.size()     * NbCellsInTile * sizeof( Hexahedron* ));
+}
 
 //================================================================================
 /*!
@@ -436,7 +564,7 @@ size_t Hexahedron::getSolids( TGeomID ids[] )
   for ( int iN = 0; iN < 8; ++iN )
   {
     _hexNodes[iN]._node     = _grid->_nodes   [ _origNodeInd + _grid->_nodeShift[iN] ];
-    _hexNodes[iN]._intPoint = _grid->_gridIntP[ _origNodeInd + _grid->_nodeShift[iN] ];
+    _hexNodes[iN]._intPoint = _grid->_gridIntP.Get( _origNodeInd + _grid->_nodeShift[iN] );
 
     if ( _hexNodes[iN]._intPoint ) // intersection with a FACE
     {
@@ -598,10 +726,10 @@ void Hexahedron::init( size_t i, size_t j, size_t k, const Solid* solid )
 
     // Grid  node
     _hexNodes[iN]._node     = _grid->_nodes   [ _origNodeInd + _grid->_nodeShift[iN] ];
-    _hexNodes[iN]._intPoint = _grid->_gridIntP[ _origNodeInd + _grid->_nodeShift[iN] ];
+    _hexNodes[iN]._intPoint = _grid->_gridIntP.Get( _origNodeInd + _grid->_nodeShift[iN] );
 
-    if ( _grid->_allBorderNodes[ _origNodeInd + _grid->_nodeShift[iN] ] )
-      _hexNodes[iN]._boundaryCornerNode = _grid->_allBorderNodes [ _origNodeInd + _grid->_nodeShift[iN] ];
+    if ( const SMDS_MeshNode* n = _grid->_allBorderNodes.Get( _origNodeInd + _grid->_nodeShift[iN] ))
+      _hexNodes[iN]._boundaryCornerNode = n;
 
     if ( _hexNodes[iN]._node && !solid->Contains( _hexNodes[iN]._node->GetShapeID() ))
       _hexNodes[iN]._node = 0;
@@ -1682,9 +1810,9 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
 {
   SMESHDS_Mesh* mesh = helper.GetMeshDS();
 
+  // only intersected cells get Hexahedron's, they are stored by tiles of cells
   CellsAroundLink c( _grid, 0 );
-  const size_t nbGridCells = c._nbCells[0] * c._nbCells[1] * c._nbCells[2];
-  vector< Hexahedron* > allHexa( nbGridCells, 0 );
+  HexaTiles allHexa( c._nbCells );
   int nbIntHex = 0;
 
   // set intersection nodes from GridLine's to links of allHexa
@@ -1697,7 +1825,7 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
     for ( ; lineInd.More(); ++lineInd )
     {
       GridLine& line = _grid->_lines[ iDir ][ lineInd.LineIndex() ];
-      multiset< F_IntersectPoint >::const_iterator ip = line._intPoints.begin();
+      vector< F_IntersectPoint >::const_iterator ip = line._intPoints.begin();
       for ( ; ip != line._intPoints.end(); ++ip )
       {
         // if ( !ip->_node ) continue; // intersection at a grid node
@@ -1707,7 +1835,7 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
         {
           if ( !fourCells.GetCell( iL, i,j,k, cellIndex, iLink ))
             continue;
-          Hexahedron *& hex = allHexa[ cellIndex ];
+          Hexahedron *& hex = allHexa.Set( cellIndex );
           if ( !hex)
           {
             hex = new Hexahedron( *this, i, j, k, cellIndex );
@@ -1723,64 +1851,146 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
   // implement geom edges into the mesh
   addEdges( helper, allHexa, edge2faceIDsMap );
 
-  // add not split hexahedra to the mesh
+  // add not split hexahedra to the mesh; cells not intersected are treated
+  // one by one without storing them. First connectivity of hexahedra is found
+  // by ranges of cells in parallel, then the hexahedra are added in one go
   int nbAdded = 0;
-  TGeomID solidIDs[20];
   vector< Hexahedron* > intHexa; intHexa.reserve( nbIntHex );
   vector< const SMDS_MeshElement* > boundaryVolumes; boundaryVolumes.reserve( nbIntHex * 1.1 );
 
-  for ( size_t i = 0; i < allHexa.size(); ++i )
+  const size_t nbCells  = allHexa.size();
+  const size_t nbRanges = std::max( 1, std::min( numOfThreads, int( nbCells / HexaTiles::NbCellsInTile ) + 1 ));
+  vector< HexaRange > ranges( nbRanges );
+  for ( size_t iR = 0; iR < nbRanges; ++iR )
   {
-    // initialize this by not cut allHexa[ i ]
-    Hexahedron * & hex = allHexa[ i ];
-    if ( hex ) // split hexahedron
-    {
-      intHexa.push_back( hex );
-      if ( hex->_nbFaceIntNodes > 0 ||
-            hex->_eIntPoints.size() > 0 ||
-            hex->getSolids( solidIDs ) > 1 )
-        continue; // treat intersected hex later in parallel
-      this->init( hex->_i, hex->_j, hex->_k );
-    }
-    else
-    {
-      this->init( i ); // == init(i,j,k)
-    }
-    if (( _nbCornerNodes == 8 ) &&
-        ( _nbBndNodes < _nbCornerNodes || !isInHole() ))
+    ranges[ iR ]._firstCell = nbCells * iR / nbRanges;
+    ranges[ iR ]._endCell   = nbCells * ( iR + 1 ) / nbRanges;
+  }
+  auto findHexa = [&]( HexaRange& range )
+  {
+    Hexahedron cell( *this, 0, 0, 0, 0 ); // own buffer of the thread
+    TGeomID solidIDs[20];
+    for ( size_t i = range._firstCell; i < range._endCell; ++i )
     {
-      // order of _hexNodes is defined by enum SMESH_Block::TShapeID
-      SMDS_MeshElement* el =
-        mesh->AddVolume( _hexNodes[0].Node(), _hexNodes[2].Node(),
-                          _hexNodes[3].Node(), _hexNodes[1].Node(),
-                          _hexNodes[4].Node(), _hexNodes[6].Node(),
-                          _hexNodes[7].Node(), _hexNodes[5].Node() );
-      TGeomID solidID = 0;
-      if ( _nbBndNodes < _nbCornerNodes )
+      // initialize cell by not cut allHexa[ i ]
+      Hexahedron * hex = allHexa.Get( i );
+      if ( hex ) // split hexahedron
       {
-        for ( int iN = 0; iN < 8 &&  !solidID; ++iN )
-          if ( !_hexNodes[iN]._intPoint ) // no intersection
-            solidID = _hexNodes[iN].Node()->GetShapeID();
+        if ( hex->_nbFaceIntNodes > 0 ||
+             hex->_eIntPoints.size() > 0 ||
+             hex->getSolids( solidIDs ) > 1 )
+        {
+          range._intCells.push_back( i ); // treat intersected hex later in parallel
+          continue;
+        }
+        cell.init( hex->_i, hex->_j, hex->_k );
       }
       else
       {
-        getSolids( solidIDs );
-        solidID = solidIDs[0];
+        cell.init( i ); // == init(i,j,k)
       }
-      mesh->SetMeshElementOnShape( el, solidID );
+      if (( cell._nbCornerNodes == 8 ) &&
+          ( cell._nbBndNodes < cell._nbCornerNodes || !cell.isInHole() ))
+      {
+        // order of _hexNodes is defined by enum SMESH_Block::TShapeID
+        const int order[8] = { 0, 2, 3, 1, 4, 6, 7, 5 };
+        for ( int iN = 0; iN < 8; ++iN )
+          range._nodeIDs.push_back( cell._hexNodes[ order[ iN ]].Node()->GetID() );
+
+        TGeomID solidID = 0;
+        if ( cell._nbBndNodes < cell._nbCornerNodes )
+        {
+          for ( int iN = 0; iN < 8 &&  !solidID; ++iN )
+            if ( !cell._hexNodes[iN]._intPoint ) // no intersection
+              solidID = cell._hexNodes[iN].Node()->GetShapeID();
+        }
+        else
+        {
+          cell.getSolids( solidIDs );
+          solidID = solidIDs[0];
+        }
+        range._solidIDs.push_back( solidID );
+        range._isBoundary.push_back( _grid->_toCreateFaces && cell._nbBndNodes >= 3 );
+      }
+      else if ( hex || cell._nbCornerNodes > 3 )
+      {
+        // cut hex or all intersections of hex with geometry are at grid nodes
+        range._intCells.push_back( i );
+      }
+    }
+  };
+#ifdef WITH_TBB
+  parallel_for( ranges.begin(), ranges.end(), findHexa, nbRanges );
+#else
+  for ( size_t iR = 0; iR < nbRanges; ++iR )
+    findHexa( ranges[ iR ]);
+#endif
+
+  // add found hexahedra in the order of cells
+  size_t nbHexa = 0;
+  for ( size_t iR = 0; iR < nbRanges; ++iR )
+    nbHexa += ranges[ iR ]._solidIDs.size();
+  vector< smIdType > nodeIDs; nodeIDs.reserve( 8 * nbHexa );
+  for ( size_t iR = 0; iR < nbRanges; ++iR )
+  {
+    nodeIDs.insert( nodeIDs.end(), ranges[ iR ]._nodeIDs.begin(), ranges[ iR ]._nodeIDs.end() );
+    vector< smIdType >().swap( ranges[ iR ]._nodeIDs );
+  }
+  vector< const SMDS_MeshElement* > newHexa;
+  auto removeNewHexa = [&]()
+  {
+    // remove the created hexahedra, they are not bound to solids yet
+    for ( const SMDS_MeshElement* el : newHexa )
+      mesh->RemoveFreeElement( el, /*subMesh=*/0, /*fromGroups=*/false );
+    allHexa.GetHexahedra( intHexa );
+    for ( size_t i = 0; i < intHexa.size(); ++i )
+      delete intHexa[ i ];
+  };
+  smIdType nbNewHexa = 0;
+  try
+  {
+    nbNewHexa = mesh->AddElementsWithID( SMDSEntity_Hexa, nbHexa, nodeIDs.data(),
+                                         /*elemIDs=*/0, &newHexa );
+  }
+  catch ( ... ) // e.g. std::bad_alloc if the memory budget is exceeded
+  {
+    removeNewHexa();
+    throw;
+  }
+  vector< smIdType >().swap( nodeIDs );
+  if ( nbNewHexa != (smIdType) nbHexa )
+  {
+    removeNewHexa();
+    throw SMESH_ComputeError( COMPERR_ALGO_FAILED,
+                              SMESH_Comment("Failed to create hexahedra: ") << nbNewHexa
+                              << " of " << nbHexa << " are created" );
+  }
+
+  size_t iHexa = 0;
+  for ( size_t iR = 0; iR < nbRanges; ++iR )
+  {
+    HexaRange& range = ranges[ iR ];
+    for ( size_t iH = 0; iH < range._solidIDs.size(); ++iH, ++iHexa )
+    {
+      const SMDS_MeshElement* el = newHexa[ iHexa ];
+      mesh->SetMeshElementOnShape( el, range._solidIDs[ iH ]);
       ++nbAdded;
-      if ( hex )
-        intHexa.pop_back();
-      if ( _grid->_toCreateFaces && _nbBndNodes >= 3 )
+      if ( range._isBoundary[ iH ])
       {
         boundaryVolumes.push_back( el );
         el->setIsMarked( true );
       }
     }
-    else if ( _nbCornerNodes > 3 && !hex )
+    for ( size_t iC = 0; iC < range._intCells.size(); ++iC )
     {
-      // all intersections of hex with geometry are at grid nodes
-      hex = new Hexahedron( *this, _i, _j, _k, i );
+      const size_t i = range._intCells[ iC ];
+      Hexahedron *& hex = allHexa.Set( i );
+      if ( !hex )
+      {
+        // all intersections of hex with geometry are at grid nodes
+        hex = new Hexahedron( *this, 0, 0, 0, i );
+        hex->setIJK( i );
+      }
       intHexa.push_back( hex );
     }
   }
@@ -1841,9 +2051,9 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
   // create mesh edges
   addSegments( helper, edge2faceIDsMap );
 
-  for ( size_t i = 0; i < allHexa.size(); ++i )
-    if ( allHexa[ i ] )
-      delete allHexa[ i ];
+  allHexa.GetHexahedra( intHexa );
+  for ( size_t i = 0; i < intHexa.size(); ++i )
+    delete intHexa[ i ];
 
   return nbAdded;
 }
@@ -1853,7 +2063,7 @@ int Hexahedron::MakeElements(SMESH_MesherHelper&                      helper,
   * \brief Implements geom edges into the mesh
   */
 void Hexahedron::addEdges(SMESH_MesherHelper&                      helper,
-                          vector< Hexahedron* >&                   hexes,
+                          HexaTiles&                               hexes,
                           const map< TGeomID, vector< TGeomID > >& edge2faceIDsMap)
 {
   if ( edge2faceIDsMap.empty() ) return;
@@ -2034,16 +2244,20 @@ void Hexahedron::addEdges(SMESH_MesherHelper&                      helper,
   * \brief Fully cut hexes that are partially cut by INTERNAL FACE.
   *        Cut them by extended INTERNAL FACE.
   */
-void Hexahedron::cutByExtendedInternal( std::vector< Hexahedron* >& hexes,
+void Hexahedron::cutByExtendedInternal( HexaTiles&                  hexes,
                                         const TColStd_MapOfInteger& intEdgeIDs )
 {
   IntAna_IntConicQuad intersection;
   SMESHDS_Mesh* meshDS = _grid->_helper->GetMeshDS();
   const double tol2 = _grid->_tol * _grid->_tol;
 
-  for ( size_t iH = 0; iH < hexes.size(); ++iH )
+  // hexes added in the loop are not cut by EDGEs, so they need not to be visited
+  vector< Hexahedron* > cutHexes;
+  hexes.GetHexahedra( cutHexes );
+
+  for ( size_t iH = 0; iH < cutHexes.size(); ++iH )
   {
-    Hexahedron* hex = hexes[ iH ];
+    Hexahedron* hex = cutHexes[ iH ];
     if ( !hex || hex->_eIntPoints.size() < 2 )
       continue;
     if ( !intEdgeIDs.Contains( hex->_eIntPoints.back()->_shapeID ))
@@ -2052,7 +2266,7 @@ void Hexahedron::cutByExtendedInternal( std::vector< Hexahedron* >& hexes,
     // get 3 points on INTERNAL FACE to construct a cutting plane
     gp_Pnt p1 = hex->_eIntPoints[0]->_point;
     gp_Pnt p2 = hex->_eIntPoints[1]->_point;
-    gp_Pnt p3 = hex->mostDistantInternalPnt( iH, p1, p2 );
+    gp_Pnt p3 = hex->mostDistantInternalPnt( _grid->CellIndex( hex->_i, hex->_j, hex->_k ), p1, p2 );
 
     gp_Vec norm = gp_Vec( p1, p2 ) ^ gp_Vec( p1, p3 );
     gp_Pln pln;
@@ -2124,8 +2338,8 @@ void Hexahedron::cutByExtendedInternal( std::vector< Hexahedron* >& hexes,
         int  i = ! ( u < _grid->_tol ); // [0,1]
         int iN = link._nodes[ i ] - hex->_hexNodes; // [0-7]
 
-        const F_IntersectPoint * & ip = _grid->_gridIntP[ hex->_origNodeInd +
-                                                          _grid->_nodeShift[iN] ];
+        const F_IntersectPoint * & ip = _grid->_gridIntP.Set( hex->_origNodeInd +
+                                                              _grid->_nodeShift[iN] );
         if ( !ip )
         {
           ip = _grid->_extIntPool.getNew();
@@ -2155,9 +2369,9 @@ void Hexahedron::cutByExtendedInternal( std::vector< Hexahedron* >& hexes,
         {
           if ( !fourCells.GetCell( iC, i,j,k, cellIndex, iLink ))
             continue;
-          Hexahedron * h = hexes[ cellIndex ];
+          Hexahedron * & h = hexes.Set( cellIndex );
           if ( !h )
-            h = hexes[ cellIndex ] = new Hexahedron( *this, i, j, k, cellIndex );
+            h = new Hexahedron( *this, i, j, k, cellIndex );
           h->_hexLinks[iLink]._fIntPoints.push_back( ip );
           h->_nbFaceIntNodes++;
           //isCut = true;
@@ -2219,7 +2433,7 @@ gp_Pnt Hexahedron::mostDistantInternalPnt( int hexIndex, const gp_Pnt& p1, const
   for ( size_t iN = 0; iN < 8; ++iN ) // check corners
   {
     _hexNodes[iN]._node     = _grid->_nodes   [ _origNodeInd + _grid->_nodeShift[iN] ];
-    _hexNodes[iN]._intPoint = _grid->_gridIntP[ _origNodeInd + _grid->_nodeShift[iN] ];
+    _hexNodes[iN]._intPoint = _grid->_gridIntP.Get( _origNodeInd + _grid->_nodeShift[iN] );
     if ( _hexNodes[iN]._intPoint )
       for ( size_t iF = 0; iF < _hexNodes[iN]._intPoint->_faceIDs.size(); ++iF )
       {
@@ -2358,7 +2572,7 @@ int Hexahedron::getEntity( const E_IntersectPoint* ip, int* facets, int& sub )
   * \brief Adds intersection with an EDGE
   */
 bool Hexahedron::addIntersection( const E_IntersectPoint* ip,
-                                  vector< Hexahedron* >&  hexes,
+                                  HexaTiles&              hexes,
                                   int ijk[], int dIJK[] )
 {
   bool added = false;
@@ -2371,9 +2585,8 @@ bool Hexahedron::addIntersection( const E_IntersectPoint* ip,
   };
   for ( int i = 0; i < 4; ++i )
   {
-    if ( hexIndex[i] < hexes.size() && hexes[ hexIndex[i] ] )
+    if ( Hexahedron* h = hexes.Get( hexIndex[i] ))
     {
-      Hexahedron* h = hexes[ hexIndex[i] ];
       h->_eIntPoints.reserve(2);
       h->_eIntPoints.push_back( ip );
       added = true;
@@ -3082,8 +3295,8 @@ bool Hexahedron::isInHole() const
         const GridLine& line = _grid->_lines[ iDir ][ lineIndex[ iL ]];
         if ( !line._intPoints.empty() )
         {
-          multiset< F_IntersectPoint >::const_iterator ip =
-            line._intPoints.upper_bound( curIntPnt );
+          vector< F_IntersectPoint >::const_iterator ip =
+            std::upper_bound( line._intPoints.begin(), line._intPoints.end(), curIntPnt );
           --ip;
           firstIntPnt = &(*ip);
         }
@@ -4419,7 +4632,7 @@ void Hexahedron::getBoundaryElems( vector< const SMDS_MeshElement* > & boundaryE
   */
 //================================================================================
 
-void Hexahedron::removeExcessSideDivision(const vector< Hexahedron* >& allHexa)
+void Hexahedron::removeExcessSideDivision(const HexaTiles& allHexa)
 {
   if ( ! _volumeDefs.IsPolyhedron() )
     return; // not a polyhedron
@@ -4435,9 +4648,8 @@ void Hexahedron::removeExcessSideDivision(const vector< Hexahedron* >& allHexa)
     size_t neighborIndex = _grid->CellIndex( _i + di[iF],
                                               _j + dj[iF],
                                               _k + dk[iF] );
-    if ( neighborIndex >= allHexa.size() ||
-          !allHexa[ neighborIndex ]       ||
-          !allHexa[ neighborIndex ]->_hasTooSmall )
+    const Hexahedron* neighbor = allHexa.Get( neighborIndex );
+    if ( !neighbor || !neighbor->_hasTooSmall )
       continue;
 
     // check if a side is divided into several polygons
@@ -4572,7 +4784,7 @@ void Hexahedron::removeExcessSideDivision(const vector< Hexahedron* >& allHexa)
   */
 //================================================================================
 
-void Hexahedron::removeExcessNodes(vector< Hexahedron* >& allHexa)
+void Hexahedron::removeExcessNodes(HexaTiles& allHexa)
 {
   if ( ! _volumeDefs.IsPolyhedron() )
     return; // not a polyhedron
@@ -4613,7 +4825,7 @@ void Hexahedron::removeExcessNodes(vector< Hexahedron* >& allHexa)
           hexa       [ iC ] = 0;
           if ( !fourCells.GetCell( iC, i,j,k, cellIndex, iCellLink ))
             continue;
-          hexa[ iC ] = allHexa[ cellIndex ];
+          hexa[ iC ] = allHexa.Get( cellIndex );
           if ( !hexa[ iC ])
             continue;
           for ( size_t i = 0, nb = hexa[ iC ]->_volumeDefs.size(); i < nb; ++i )
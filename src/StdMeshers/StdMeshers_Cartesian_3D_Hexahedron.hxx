@@ -86,6 +86,54 @@ namespace Cartesian3D
     }
   };
 
+  class Hexahedron;
+
+  // --------------------------------------------------------------------------
+  /*!
+   * \brief Sparse storage of Hexahedron's of grid cells.
+   *
+   * Cells are grouped into cubic tiles of TileSize^3 cells. An array of pointers
+   * is allocated for a tile only when a Hexahedron is stored in any of its cells,
+   * so the used memory depends on the number of intersected tiles rather than
+   * on the number of grid cells. Hexahedron's are not owned by the storage.
+   */
+  class STDMESHERS_EXPORT HexaTiles
+  {
+  public:
+    enum { TileShift = 3, TileSize = 1 << TileShift, TileMask = TileSize - 1,
+           NbCellsInTile = TileSize * TileSize * TileSize };
+
+    HexaTiles( const size_t nbCells[3] );
+    ~HexaTiles();
+
+    //! Return nb of grid cells
+    size_t size() const { return _nbCells[0] * _nbCells[1] * _nbCells[2]; }
+
+    //! Return a Hexahedron of a cell or NULL
+    Hexahedron* Get( size_t cellIndex ) const;
+
+    //! Return a reference to a Hexahedron of a cell, allocate a tile if necessary
+    Hexahedron*& Set( size_t cellIndex );
+
+    //! Return all stored Hexahedron's in the order of cell indices
+    void GetHexahedra( std::vector< Hexahedron* >& hexes ) const;
+
+    //! Return nb of allocated tiles
+    size_t NbTiles() const { return _usedTiles.size(); }
+
+    //! Return size of memory used by the storage, in bytes
+    size_t MemorySize() const;
+
+  private:
+    HexaTiles( const HexaTiles& );
+    size_t tileIndex( size_t cellIndex, size_t& indexInTile ) const;
+
+    size_t                      _nbCells[3];
+    size_t                      _nbTiles[3];
+    std::vector< Hexahedron** > _tiles;     // NULL for a tile with no Hexahedron's
+    std::vector< size_t >       _usedTiles; // indices of allocated tiles
+  };
+
   // --------------------------------------------------------------------------
   /*!
    * \brief Class representing topology of the hexahedron and creating a mesh
@@ -560,14 +608,14 @@ namespace Cartesian3D
     size_t getSolids( StdMeshers::Cartesian3D::TGeomID ids[] );
     bool isCutByInternalFace( IsInternalFlag & maxFlag );
     void addEdges(SMESH_MesherHelper&         helper,
-                  std::vector< Hexahedron* >& intersectedHex,
+                  HexaTiles&                  intersectedHex,
                   const TEdge2faceIDsMap&     edge2faceIDsMap);
     gp_Pnt findIntPoint( double u1, double proj1, double u2, double proj2,
                          double proj, BRepAdaptor_Curve& curve,
                          const gp_XYZ& axis, const gp_XYZ& origin );
     int  getEntity( const StdMeshers::Cartesian3D::E_IntersectPoint* ip, int* facets, int& sub );
     bool addIntersection( const StdMeshers::Cartesian3D::E_IntersectPoint* ip,
-                          std::vector< Hexahedron* >&  hexes,
+                          HexaTiles&                   hexes,
                           int ijk[], int dIJK[] );
     bool isQuadOnFace( const size_t iQuad );
     bool findChain( _Node* n1, _Node* n2, _Face& quad, std::vector<_Node*>& chainNodes );
@@ -598,11 +646,11 @@ namespace Cartesian3D
                       const TEdge2faceIDsMap& edge2faceIDsMap );
     void getVolumes( std::vector< const SMDS_MeshElement* > & volumes );
     void getBoundaryElems( std::vector< const SMDS_MeshElement* > & boundaryVolumes );
-    void removeExcessSideDivision(const std::vector< Hexahedron* >& allHexa);
-    void removeExcessNodes(std::vector< Hexahedron* >& allHexa);
+    void removeExcessSideDivision(const HexaTiles& allHexa);
+    void removeExcessNodes(HexaTiles& allHexa);
     void preventVolumesOverlapping();
     StdMeshers::Cartesian3D::TGeomID getAnyFace() const;
-    void cutByExtendedInternal( std::vector< Hexahedron* >& hexes,
+    void cutByExtendedInternal( HexaTiles&                  hexes,
                                 const TColStd_MapOfInteger& intEdgeIDs );
     gp_Pnt mostDistantInternalPnt( int hexIndex, const gp_Pnt& p1, const gp_Pnt& p2 );
     bool isOutPoint( _Link& link, int iP, SMESH_MesherHelper& helper, const Solid* solid ) const;
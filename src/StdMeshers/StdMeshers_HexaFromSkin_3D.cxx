@@ -958,6 +958,7 @@ StdMeshers_HexaFromSkin_3D::StdMeshers_HexaFromSkin_3D(int hypId, SMESH_Gen* gen
   :SMESH_3D_Algo(hypId, gen)
 {
   _name = "HexaFromSkin_3D";
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
 }
 
 StdMeshers_HexaFromSkin_3D::~StdMeshers_HexaFromSkin_3D()
@@ -80,6 +80,7 @@ StdMeshers_Hexa_3D::StdMeshers_Hexa_3D(int hypId, SMESH_Gen * gen)
   _name = "Hexa_3D";
   _shapeType = (1 << TopAbs_SHELL) | (1 << TopAbs_SOLID);       // 1 bit /shape type
   _requireShape = false;
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
   _compatibleHypothesis.push_back("ViscousLayers");
   _compatibleHypothesis.push_back("BlockRenumber");
   _quadAlgo = new StdMeshers_Quadrangle_2D( gen->GetANewId(), _gen );
@@ -107,6 +107,7 @@ StdMeshers_Import_1D2D::StdMeshers_Import_1D2D(int hypId, SMESH_Gen * gen)
   _compatibleHypothesis.push_back("ImportSource2D");
   _requireDiscreteBoundary = false;
   _supportSubmeshes = true;
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
 }
 
 //=============================================================================
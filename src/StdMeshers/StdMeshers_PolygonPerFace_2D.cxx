@@ -53,6 +53,7 @@ StdMeshers_PolygonPerFace_2D::StdMeshers_PolygonPerFace_2D(int        hypId,
   :SMESH_2D_Algo(hypId, gen)
 {
   _name = "PolygonPerFace_2D";
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
 }
 
 //=======================================================================
@@ -386,6 +386,7 @@ StdMeshers_PolyhedronPerSolid_3D::StdMeshers_PolyhedronPerSolid_3D(int        hy
   _name = "PolyhedronPerSolid_3D";
   _requireDiscreteBoundary = false;
   _supportSubmeshes = true;
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
   _compatibleHypothesis.push_back("ViscousLayers");
   _neededLowerHyps[0] = _neededLowerHyps[1] = _neededLowerHyps[2] = true;
 }
@@ -737,6 +737,7 @@ StdMeshers_Prism_3D::StdMeshers_Prism_3D(int hypId, SMESH_Gen* gen)
   _onlyUnaryInput          = false; // mesh all SOLIDs at once
   _requireDiscreteBoundary = false; // mesh FACEs and EDGEs by myself
   _supportSubmeshes        = true;  // "source" FACE must be meshed by other algo
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
   _neededLowerHyps[ 1 ]    = true;  // suppress warning on hiding a global 1D algo
   _neededLowerHyps[ 2 ]    = true;  // suppress warning on hiding a global 2D algo
 
@@ -114,6 +114,7 @@ StdMeshers_Projection_2D::StdMeshers_Projection_2D(int hypId, SMESH_Gen* gen)
   :SMESH_2D_Algo(hypId, gen)
 {
   _name = "Projection_2D";
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
   _compatibleHypothesis.push_back("ProjectionSource2D");
   _sourceHypo = 0;
 }
@@ -69,6 +69,7 @@ StdMeshers_Projection_3D::StdMeshers_Projection_3D(int hypId, SMESH_Gen* gen)
 {
   _name = "Projection_3D";
   _shapeType = (1 << TopAbs_SHELL) | (1 << TopAbs_SOLID);  // 1 bit per shape type
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
 
   _compatibleHypothesis.push_back("ProjectionSource3D");
   _sourceHypo = 0;
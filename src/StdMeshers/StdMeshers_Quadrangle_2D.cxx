@@ -95,6 +95,7 @@ StdMeshers_Quadrangle_2D::StdMeshers_Quadrangle_2D (int hypId,
 {
   _name = "Quadrangle_2D";
   _shapeType = (1 << TopAbs_FACE);
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
   _compatibleHypothesis.push_back("QuadrangleParams");
   _compatibleHypothesis.push_back("QuadranglePreference");
   _compatibleHypothesis.push_back("TrianglePreference");
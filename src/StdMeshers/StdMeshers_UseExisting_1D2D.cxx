@@ -95,6 +95,7 @@ StdMeshers_UseExisting_2D::StdMeshers_UseExisting_2D
   _name = "UseExisting_2D";
   _shapeType = (1 << TopAbs_FACE); // 1 bit per shape type
   _requireShape = false;
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
 }
 
 //=======================================================================
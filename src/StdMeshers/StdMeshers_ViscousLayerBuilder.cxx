@@ -45,6 +45,7 @@ StdMeshers_ViscousLayerBuilder::StdMeshers_ViscousLayerBuilder(int        hypId,
   : SMESH_2D_Algo(hypId, gen)
 {
   _name = "StdMeshers_ViscousLayerBuilder";
+  _requireLowerDimMeshFile = false; // lower dim mesh file not read
   _hyp    = new StdMeshers_ViscousLayers2D( hypId, gen );  
 }
 
@@ -0,0 +1,288 @@
+// Copyright (C) 2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMDS_BulkCreationTest.cxx (unit test)
+// Purpose   : Check that nodes and elements created by arrays are same as
+//             ones created one by one
+
+// std
+#include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// smesh
+#include "SMDS_Mesh.hxx"
+#include "SMDS_MeshNode.hxx"
+#include "SMDS_UnstructuredGrid.hxx"
+#include "SMESHDS_Mesh.hxx"
+
+// vtk
+#include <vtkCellType.h>
+
+const int theNb = 10; // nb of hexahedra along each axis
+
+/*!
+  * \brief Return ID of a node of a structured grid of nodes
+  */
+smIdType nodeID( int i, int j, int k )
+{
+  return 1 + i + ( theNb + 1 ) * ( j + ( theNb + 1 ) * k );
+}
+
+/*!
+  * \brief Fill arrays defining a grid of hexahedra
+  */
+void makeGrid( std::vector<double>& coords, std::vector<smIdType>& hexaNodes )
+{
+  for ( int k = 0; k <= theNb; ++k )
+    for ( int j = 0; j <= theNb; ++j )
+      for ( int i = 0; i <= theNb; ++i )
+      {
+        coords.push_back( i );
+        coords.push_back( j );
+        coords.push_back( k );
+      }
+  for ( int k = 0; k < theNb; ++k )
+    for ( int j = 0; j < theNb; ++j )
+      for ( int i = 0; i < theNb; ++i )
+      {
+        smIdType nodes[8] = { nodeID( i, j,   k   ), nodeID( i+1, j,   k   ),
+                              nodeID( i+1, j+1, k ), nodeID( i,   j+1, k   ),
+                              nodeID( i, j,   k+1 ), nodeID( i+1, j,   k+1 ),
+                              nodeID( i+1, j+1, k+1 ), nodeID( i, j+1, k+1 ) };
+        hexaNodes.insert( hexaNodes.end(), nodes, nodes + 8 );
+      }
+}
+
+/*!
+  * \brief Check that the VTK grid has a cell per element and a cell of an element
+  *        has its type and nodes
+  */
+void checkGrid( SMDS_Mesh* mesh, const SMDS_MeshElement* elem, int vtkType, const char* test )
+{
+  if ( mesh->GetGrid()->GetNumberOfCells() != mesh->NbElements() )
+    throw std::runtime_error( std::string("wrong number of VTK cells in ") + test );
+
+  if ( mesh->GetGrid()->GetCellType( elem->GetVtkID() ) != vtkType )
+    throw std::runtime_error( std::string("wrong VTK cell type in ") + test );
+
+  vtkIdType npts = 0;
+  vtkIdType const *pts = nullptr;
+  mesh->GetGrid()->GetCellPoints( elem->GetVtkID(), npts, pts );
+  if ( npts != elem->NbNodes() )
+    throw std::runtime_error( std::string("wrong number of VTK cell points in ") + test );
+  for ( int iN = 0; iN < npts; ++iN )
+    if ( pts[ iN ] != elem->GetNode( iN )->GetVtkID() )
+      throw std::runtime_error( std::string("wrong VTK cell points in ") + test );
+}
+
+/*!
+  * \brief Create a grid of hexahedra by arrays
+  */
+std::unique_ptr<SMESHDS_Mesh> makeMeshAtOnce( std::vector<const SMDS_MeshElement*>& newHexa )
+{
+  std::vector<double>   coords;
+  std::vector<smIdType> hexaNodes;
+  makeGrid( coords, hexaNodes );
+  const smIdType nbNodes = coords.size() / 3;
+  const smIdType nbHexa  = hexaNodes.size() / 8;
+
+  std::unique_ptr<SMESHDS_Mesh> mesh( new SMESHDS_Mesh( 1, true ));
+  if ( mesh->AddNodesWithID( nbNodes, coords.data() ) != nbNodes )
+    throw std::runtime_error("AddNodesWithID() failed in makeMeshAtOnce()\n");
+  if ( mesh->AddElementsWithID( SMDSEntity_Hexa, nbHexa, hexaNodes.data(), 0, &newHexa ) != nbHexa ||
+       (smIdType) newHexa.size() != nbHexa )
+    throw std::runtime_error("AddElementsWithID() failed in makeMeshAtOnce()\n");
+  return mesh;
+}
+
+bool testBulkCreation()
+{
+  std::vector<double>   coords;
+  std::vector<smIdType> hexaNodes;
+  makeGrid( coords, hexaNodes );
+  const smIdType nbNodes = coords.size() / 3;
+  const smIdType nbHexa  = hexaNodes.size() / 8;
+
+  // mesh created one by one
+
+  std::unique_ptr<SMESHDS_Mesh> mesh1( new SMESHDS_Mesh( 0, true ));
+  for ( smIdType i = 0; i < nbNodes; ++i )
+    mesh1->AddNodeWithID( coords[3*i], coords[3*i+1], coords[3*i+2], i + 1 );
+  for ( smIdType i = 0; i < nbHexa; ++i )
+  {
+    const smIdType* n = & hexaNodes[ 8 * i ];
+    mesh1->AddVolumeWithID( n[0], n[1], n[2], n[3], n[4], n[5], n[6], n[7], i + 1 );
+  }
+
+  // mesh created at once
+
+  std::vector<const SMDS_MeshElement*> newHexa;
+  std::unique_ptr<SMESHDS_Mesh> mesh2 = makeMeshAtOnce( newHexa );
+
+  // compare
+
+  if ( mesh1->NbNodes() != mesh2->NbNodes() ||
+       mesh1->NbVolumes() != mesh2->NbVolumes() ||
+       mesh2->GetMeshInfo().NbEntities( SMDSEntity_Hexa ) != nbHexa )
+    throw std::runtime_error("wrong number of entities in testBulkCreation()\n");
+
+  for ( smIdType i = 1; i <= nbHexa; ++i )
+  {
+    const SMDS_MeshElement* h1 = mesh1->FindElement( i );
+    const SMDS_MeshElement* h2 = mesh2->FindElement( i );
+    if ( !h2 || h2->GetEntityType() != SMDSEntity_Hexa || h2 != newHexa[ i - 1 ])
+      throw std::runtime_error("missing hexahedron in testBulkCreation()\n");
+    for ( int iN = 0; iN < 8; ++iN )
+      if ( h1->GetNode( iN )->GetID() != h2->GetNode( iN )->GetID() )
+        throw std::runtime_error("wrong order of nodes in testBulkCreation()\n");
+  }
+  checkGrid( mesh2.get(), newHexa.front(), VTK_HEXAHEDRON, "testBulkCreation()\n" );
+  checkGrid( mesh2.get(), newHexa.back(),  VTK_HEXAHEDRON, "testBulkCreation()\n" );
+
+  smIdType nbInverse = 0;
+  SMDS_NodeIteratorPtr nIt = mesh2->nodesIterator();
+  while ( nIt->more() )
+    nbInverse += nIt->next()->NbInverseElements();
+  if ( nbInverse != 8 * nbHexa )
+    throw std::runtime_error("wrong inverse connectivity in testBulkCreation()\n");
+
+  return true;
+}
+
+bool testUsedIDs()
+{
+  std::vector<const SMDS_MeshElement*> newHexa;
+  std::unique_ptr<SMESHDS_Mesh> mesh = makeMeshAtOnce( newHexa );
+  const smIdType nbHexa = newHexa.size();
+
+  // creation stops at an element with a used ID
+
+  smIdType hexaNodes[24] = { 1, 2, 13, 12, 122, 123, 134, 133,
+                             1, 2, 13, 12, 122, 123, 134, 133,
+                             1, 2, 13, 12, 122, 123, 134, 133 };
+  smIdType ids[3] = { nbHexa + 1, 1, nbHexa + 2 };
+  std::vector<const SMDS_MeshElement*> added;
+  if ( mesh->AddElementsWithID( SMDSEntity_Hexa, 3, hexaNodes, ids, &added ) != 1 ||
+       mesh->NbVolumes() != nbHexa + 1 ||
+       added.size() != 1 )
+    throw std::runtime_error("wrong creation of elements with used IDs in testUsedIDs()\n");
+  checkGrid( mesh.get(), added[0], VTK_HEXAHEDRON, "testUsedIDs()\n" );
+
+  return true;
+}
+
+bool testMixedElements()
+{
+  std::vector<const SMDS_MeshElement*> newHexa;
+  std::unique_ptr<SMESHDS_Mesh> mesh = makeMeshAtOnce( newHexa );
+
+  // a triangle and a quadrangle
+
+  SMDSAbs_EntityType types[2]     = { SMDSEntity_Triangle, SMDSEntity_Quadrangle };
+  smIdType           offsets[3]   = { 0, 3, 7 };
+  smIdType           faceNodes[7] = { 1, 2, 13,  1, 2, 13, 12 };
+  std::vector<const SMDS_MeshElement*> added;
+  if ( mesh->AddElementsWithID( 2, types, offsets, faceNodes, 0, &added ) != 2 ||
+       mesh->NbFaces() != 2 ||
+       mesh->GetMeshInfo().NbTriangles() != 1 ||
+       mesh->GetMeshInfo().NbQuadrangles() != 1 ||
+       added.size() != 2 )
+    throw std::runtime_error("wrong creation of mixed elements in testMixedElements()\n");
+  checkGrid( mesh.get(), added[0], VTK_TRIANGLE, "testMixedElements()\n" );
+  checkGrid( mesh.get(), added[1], VTK_QUAD,     "testMixedElements()\n" );
+
+  // elements added one by one after bulk ones go to the grid end
+  const SMDS_MeshElement* edge = mesh->AddEdge( mesh->FindNode( 1 ), mesh->FindNode( 2 ));
+  checkGrid( mesh.get(), edge, VTK_LINE, "testMixedElements()\n" );
+
+  return true;
+}
+
+bool testMemoryBudget()
+{
+  std::vector<const SMDS_MeshElement*> newHexa;
+  std::unique_ptr<SMESHDS_Mesh> mesh = makeMeshAtOnce( newHexa );
+  const smIdType nbNodes = mesh->NbNodes();
+  const smIdType nbHexa  = newHexa.size();
+  const smIdType nbBig   = 200000;
+  const size_t   mByte   = 1024 * 1024;
+
+  // arrays reserved for a big batch exceed the budget, so creation fails at
+  // allocation of a new chunk of elements after filling the current one
+
+  mesh->SetMemoryBudget( mesh->GetMemoryUsage() / mByte + 1 );
+  std::vector<double> coords( 3 * nbBig, 0. );
+  std::vector<const SMDS_MeshNode*> addedNodes;
+  bool isThrown = false;
+  try {
+    mesh->AddNodesWithID( nbBig, coords.data(), 0, &addedNodes );
+  }
+  catch ( std::bad_alloc& ) {
+    isThrown = true;
+  }
+  if ( !isThrown || addedNodes.empty() || (smIdType) addedNodes.size() >= nbBig )
+    throw std::runtime_error("memory budget not exceeded by nodes in testMemoryBudget()\n");
+
+  smIdType nbIterated = 0;
+  SMDS_NodeIteratorPtr nIt = mesh->nodesIterator();
+  while ( nIt->more() && nIt->next() )
+    ++nbIterated;
+  if ( mesh->NbNodes() != nbNodes + (smIdType) addedNodes.size() ||
+       mesh->NbNodes() != nbIterated )
+    throw std::runtime_error("wrong number of nodes after an exception in testMemoryBudget()\n");
+
+  mesh->SetMemoryBudget( mesh->GetMemoryUsage() / mByte + 1 );
+  std::vector<smIdType> hexaNodes;
+  for ( smIdType i = 0; i < nbBig; ++i )
+    for ( int iN = 0; iN < 8; ++iN )
+      hexaNodes.push_back( newHexa[0]->GetNode( iN )->GetID() );
+  std::vector<const SMDS_MeshElement*> added;
+  isThrown = false;
+  try {
+    mesh->AddElementsWithID( SMDSEntity_Hexa, nbBig, hexaNodes.data(), 0, &added );
+  }
+  catch ( std::bad_alloc& ) {
+    isThrown = true;
+  }
+  if ( !isThrown || added.empty() || (smIdType) added.size() >= nbBig )
+    throw std::runtime_error("memory budget not exceeded by elements in testMemoryBudget()\n");
+
+  nbIterated = 0;
+  SMDS_ElemIteratorPtr eIt = mesh->elementsIterator( SMDSAbs_Volume );
+  while ( eIt->more() && eIt->next() )
+    ++nbIterated;
+  if ( mesh->NbVolumes() != nbHexa + (smIdType) added.size() ||
+       mesh->NbVolumes() != nbIterated ||
+       mesh->GetMeshInfo().NbEntities( SMDSEntity_Hexa ) != nbIterated )
+    throw std::runtime_error("wrong number of elements after an exception in testMemoryBudget()\n");
+  checkGrid( mesh.get(), added.back(), VTK_HEXAHEDRON, "testMemoryBudget()\n" );
+
+  return true;
+}
+
+int main()
+{
+  if ( !testBulkCreation() || !testUsedIDs() || !testMixedElements() || !testMemoryBudget() )
+    return 1;
+  else
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMDS_GridHolesTest.cxx (unit test)
+// Purpose   : Check that SMDS_Mesh::HasGridHoles() detects removed nodes and
+//             elements which are still present in the VTK grid
+
+// std
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+// smesh
+#include "SMDS_Mesh.hxx"
+#include "SMDS_MeshNode.hxx"
+
+bool testGridHoles()
+{
+  std::unique_ptr<SMDS_Mesh> mesh( new SMDS_Mesh );
+
+  // additions do not make holes
+
+  const SMDS_MeshNode* n1 = mesh->AddNode( 0, 0, 0 );
+  const SMDS_MeshNode* n2 = mesh->AddNode( 1, 0, 0 );
+  const SMDS_MeshNode* n3 = mesh->AddNode( 0, 1, 0 );
+  const SMDS_MeshNode* n4 = mesh->AddNode( 1, 1, 0 );
+  mesh->AddFace( n1, n2, n3 );
+  const SMDS_MeshElement* f2 = mesh->AddFace( n2, n4, n3 );
+  if ( mesh->HasGridHoles() )
+    throw std::runtime_error("holes after additions in testGridHoles()\n");
+
+  // moving a node does not make holes
+
+  const_cast< SMDS_MeshNode* >( n4 )->setXYZ( 2, 2, 0 );
+  if ( mesh->HasGridHoles() )
+    throw std::runtime_error("holes after moving a node in testGridHoles()\n");
+
+  // removal of the last element leaves an empty cell in the grid
+
+  mesh->RemoveElement( f2, /*removenodes=*/false );
+  if ( !mesh->HasGridHoles() )
+    throw std::runtime_error("removed element not detected in testGridHoles()\n");
+
+  mesh->Modified();
+  mesh->CompactMesh();
+  if ( mesh->HasGridHoles() )
+    throw std::runtime_error("holes after CompactMesh() in testGridHoles()\n");
+
+  // removal of a node leaves a point in the grid
+
+  mesh->RemoveNode( n4 );
+  if ( !mesh->HasGridHoles() )
+    throw std::runtime_error("removed node not detected in testGridHoles()\n");
+
+  mesh->Modified();
+  mesh->CompactMesh();
+  if ( mesh->HasGridHoles() )
+    throw std::runtime_error("holes after CompactMesh() in testGridHoles()\n");
+
+  // a node with an ID far from others
+
+  mesh->AddNodeWithID( 0, 0, 1, 10 );
+  if ( !mesh->HasGridHoles() )
+    throw std::runtime_error("hole in node IDs not detected in testGridHoles()\n");
+
+  return true;
+}
+
+int main()
+{
+  if ( !testGridHoles() )
+    return 1;
+  else
+    return 0;
+}
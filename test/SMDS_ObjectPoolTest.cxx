@@ -0,0 +1,141 @@
+// Copyright (C) 2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMDS_ObjectPoolTest.cxx (unit test)
+// Purpose   : Check ObjectPool by interleaved creation and removal of objects
+
+// std
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+// smesh
+#include "ObjectPool.hxx"
+
+struct TObject
+{
+  int myValue;
+  TObject(): myValue( -1 ) {}
+};
+
+typedef ObjectPool< TObject >         TPool;
+typedef ObjectPoolIterator< TObject > TPoolIterator;
+
+/*!
+  * \brief Check that objects given by an iterator are used ones
+  */
+void checkIterator( const TPool& pool, const std::set< TObject* >& usedObjects )
+{
+  size_t nbFound = 0;
+  TPoolIterator it( pool );
+  while ( it.more() )
+  {
+    const TObject* o = it.next();
+    if ( !usedObjects.count( const_cast< TObject* >( o )))
+      throw std::runtime_error("iterator returns a free object in checkIterator()\n");
+    ++nbFound;
+  }
+  if ( nbFound != usedObjects.size() || nbFound != pool.nbElements() )
+    throw std::runtime_error("wrong number of objects in checkIterator()\n");
+}
+
+bool testObjectPool()
+{
+  const int chunkSize = 100;
+  TPool pool( chunkSize );
+  std::set< TObject* > usedObjects;
+
+  // fill 10 chunks
+  std::vector< TObject* > objects;
+  for ( int i = 0; i < 10 * chunkSize; ++i )
+  {
+    objects.push_back( pool.getNew() );
+    objects.back()->myValue = i;
+    usedObjects.insert( objects.back() );
+  }
+  if ( pool.nbElements() != objects.size() || pool.size() != objects.size() )
+    throw std::runtime_error("wrong pool size in testObjectPool()\n");
+  checkIterator( pool, usedObjects );
+
+  // free every 3rd object; the first free slot must be reused first
+  for ( size_t i = 0; i < objects.size(); i += 3 )
+  {
+    pool.destroy( objects[i] );
+    usedObjects.erase( objects[i] );
+  }
+  checkIterator( pool, usedObjects );
+  for ( size_t i = 0; i < objects.size(); i += 3 )
+  {
+    TObject* o = pool.getNew();
+    if ( o != objects[i] || o->myValue != (int) i )
+      throw std::runtime_error("a free slot is not reused in testObjectPool()\n");
+    usedObjects.insert( o );
+  }
+  if ( pool.size() != objects.size() )
+    throw std::runtime_error("unexpected allocation in testObjectPool()\n");
+
+  // free whole chunks; they are released but one and allocated again on demand
+  for ( size_t i = 2 * chunkSize; i < 8 * chunkSize; ++i )
+  {
+    pool.destroy( objects[i] );
+    usedObjects.erase( objects[i] );
+  }
+  checkIterator( pool, usedObjects );
+  if ( pool.at( 5 * chunkSize ) || !pool.at( 9 * chunkSize ))
+    throw std::runtime_error("wrong at() in testObjectPool()\n");
+
+  for ( size_t i = 2 * chunkSize; i < 8 * chunkSize; ++i )
+  {
+    TObject* o = pool.getNew();
+    o->myValue = i;
+    objects[i] = o;
+    usedObjects.insert( o );
+  }
+  for ( size_t i = 0; i < objects.size(); ++i )
+    if ( pool.at( i ) != objects[i] || objects[i]->myValue != (int) i )
+      throw std::runtime_error("wrong object order in testObjectPool()\n");
+  checkIterator( pool, usedObjects );
+
+  // interleaved add/remove cycles
+  for ( int iCycle = 0; iCycle < 100000; ++iCycle )
+  {
+    size_t i = ( iCycle * 7919 ) % objects.size();
+    pool.destroy( objects[i] );
+    usedObjects.erase( objects[i] );
+    objects[i] = pool.getNew();
+    usedObjects.insert( objects[i] );
+  }
+  checkIterator( pool, usedObjects );
+  if ( pool.size() != objects.size() )
+    throw std::runtime_error("unexpected allocation in add/remove cycles in testObjectPool()\n");
+
+  pool.clear();
+  if ( pool.nbElements() != 0 || pool.size() != 0 || TPoolIterator( pool ).more() )
+    throw std::runtime_error("clear() failed in testObjectPool()\n");
+
+  return true;
+}
+
+int main()
+{
+  if ( !testObjectPool() )
+    return 1;
+  else
+    return 0;
+}
@@ -0,0 +1,151 @@
+// Copyright (C) 2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMESH_ElementBufferTest.cxx (unit test)
+// Purpose   : Stress SMESH_ElementBuffer by several threads meshing disjoint
+//             strips of a plane into one mesh
+
+// std
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// smesh
+#include "SMESH_ElementBuffer.hxx"
+#include "SMESH_Mesh.hxx"
+#include "SMESH_TypeDefs.hxx"
+#include "SMESHDS_Mesh.hxx"
+#include "SMDS_MeshNode.hxx"
+
+/*!
+  * \brief Mock mesh locked by a mutex as SMESH_ParallelMesh is
+  */
+struct SMESH_Mesh_Test: public SMESH_Mesh
+{
+  SMESH_Mesh_Test() {
+    _isShapeToMesh = (_id = 0);
+    _meshDS  = new SMESHDS_Mesh( _id, true );
+  }
+  void Lock() override { _mutex.lock(); }
+  void Unlock() override { _mutex.unlock(); }
+
+  std::recursive_mutex _mutex;
+};
+
+const int theNbX = 200;  // nb of quadrangles along X in a strip
+const int theNbY = 50;   // nb of quadrangles along Y in a strip
+
+/*!
+  * \brief Mesh a strip [ 0, theNbX ] x [ iStrip * theNbY, ( iStrip + 1 ) * theNbY ]
+  *        Nodes of bottom and top sides are given, they are shared with other strips
+  */
+void meshStrip( SMESH_Mesh&                               mesh,
+                int                                       iStrip,
+                const std::vector<const SMDS_MeshNode*> & bottomNodes,
+                const std::vector<const SMDS_MeshNode*> & topNodes )
+{
+  SMESH_ElementBuffer buffer;
+  buffer.Reserve(( theNbX + 1 ) * ( theNbY + 1 ), theNbX * theNbY );
+
+  std::vector< int > prevRow( theNbX + 1 ), row( theNbX + 1 );
+  for ( int i = 0; i <= theNbX; ++i )
+    prevRow[i] = buffer.AddNode( bottomNodes[i] );
+
+  for ( int j = 1; j <= theNbY; ++j )
+  {
+    for ( int i = 0; i <= theNbX; ++i )
+      if ( j == theNbY )
+        row[i] = buffer.AddNode( topNodes[i] );
+      else
+        row[i] = buffer.AddNode( i, iStrip * theNbY + j, 0 );
+
+    for ( int i = 0; i < theNbX; ++i )
+      buffer.AddFace( prevRow[i], prevRow[i+1], row[i+1], row[i] );
+
+    // commit by several batches to interleave with other threads
+    if ( j % 10 == 0 || j == theNbY )
+      if ( !buffer.Commit( mesh ))
+        throw std::runtime_error("Commit() failed in meshStrip()\n");
+
+    prevRow.swap( row );
+  }
+}
+
+bool testConcurrentCommit()
+{
+  const int nbThreads = std::max( 2, (int) std::thread::hardware_concurrency() );
+
+  std::unique_ptr<SMESH_Mesh> mesh( new SMESH_Mesh_Test() );
+  SMESHDS_Mesh* meshDS = mesh->GetMeshDS();
+
+  // nodes shared by strips
+  std::vector< std::vector<const SMDS_MeshNode*> > sharedRows( nbThreads + 1 );
+  for ( int iRow = 0; iRow <= nbThreads; ++iRow )
+    for ( int i = 0; i <= theNbX; ++i )
+      sharedRows[ iRow ].push_back( meshDS->AddNode( i, iRow * theNbY, 0 ));
+
+  std::vector< std::thread > threads;
+  for ( int iT = 0; iT < nbThreads; ++iT )
+    threads.push_back( std::thread( meshStrip, std::ref( *mesh ), iT,
+                                    std::cref( sharedRows[ iT ] ),
+                                    std::cref( sharedRows[ iT + 1 ] )));
+  for ( std::thread& t : threads )
+    t.join();
+
+  const smIdType nbNodes = ( theNbX + 1 ) * ( nbThreads * theNbY + 1 );
+  const smIdType nbFaces = theNbX * theNbY * nbThreads;
+  if ( meshDS->NbNodes() != nbNodes )
+    throw std::runtime_error("wrong number of nodes in testConcurrentCommit()\n");
+  if ( meshDS->NbFaces() != nbFaces )
+    throw std::runtime_error("wrong number of faces in testConcurrentCommit()\n");
+
+  // check connectivity: each face must be a unit square
+  SMDS_FaceIteratorPtr fIt = meshDS->facesIterator();
+  while ( fIt->more() )
+  {
+    const SMDS_MeshElement* f = fIt->next();
+    if ( f->NbNodes() != 4 )
+      throw std::runtime_error("wrong face in testConcurrentCommit()\n");
+    SMESH_TNodeXYZ p0( f->GetNode(0) ), p2( f->GetNode(2) );
+    if ( std::abs( p2.X() - p0.X() - 1. ) > 1e-12 ||
+         std::abs( p2.Y() - p0.Y() - 1. ) > 1e-12 )
+      throw std::runtime_error("wrong face nodes in testConcurrentCommit()\n");
+  }
+
+  // check inverse connectivity
+  smIdType nbInverse = 0;
+  SMDS_NodeIteratorPtr nIt = meshDS->nodesIterator();
+  while ( nIt->more() )
+    nbInverse += nIt->next()->NbInverseElements();
+  if ( nbInverse != 4 * nbFaces )
+    throw std::runtime_error("wrong inverse connectivity in testConcurrentCommit()\n");
+
+  return true;
+}
+
+int main()
+{
+  if ( !testConcurrentCommit() )
+    return 1;
+  else
+    return 0;
+}
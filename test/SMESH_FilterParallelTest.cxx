@@ -0,0 +1,195 @@
+// Copyright (C) 2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMESH_FilterParallelTest.cxx (unit test)
+// Purpose   : Check that Controls::Filter::GetElementsId() finds the same elements
+//             in the same order as a serial check by the predicate, and print times
+//             of the filter for several kinds of predicates on faces and polyhedra
+
+// std
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// smesh
+#include "SMDS_Mesh.hxx"
+#include "SMDS_MeshNode.hxx"
+#include "SMESH_ControlsDef.hxx"
+
+using namespace SMESH::Controls;
+
+namespace
+{
+  // a grid of quadrangles with a triangle instead of each 7-th quadrangle
+  void makeMesh( SMDS_Mesh& mesh, int nbSeg )
+  {
+    std::vector< const SMDS_MeshNode* > nodes(( nbSeg + 1 ) * ( nbSeg + 1 ));
+    for ( int j = 0; j <= nbSeg; ++j )
+      for ( int i = 0; i <= nbSeg; ++i )
+        nodes[ j * ( nbSeg + 1 ) + i ] = mesh.AddNode( i + 0.1 * ( j % 3 ), j, 0 );
+
+    for ( int j = 0; j < nbSeg; ++j )
+      for ( int i = 0; i < nbSeg; ++i )
+      {
+        const SMDS_MeshNode* n1 = nodes[ j * ( nbSeg + 1 ) + i ];
+        const SMDS_MeshNode* n2 = nodes[ j * ( nbSeg + 1 ) + i + 1 ];
+        const SMDS_MeshNode* n3 = nodes[ ( j + 1 ) * ( nbSeg + 1 ) + i + 1 ];
+        const SMDS_MeshNode* n4 = nodes[ ( j + 1 ) * ( nbSeg + 1 ) + i ];
+        if (( j * nbSeg + i ) % 7 )
+          mesh.AddFace( n1, n2, n3, n4 );
+        else
+          mesh.AddFace( n1, n2, n3 );
+      }
+  }
+
+  // a layer of hexahedral polyhedra of different heights;
+  // each 3-rd polyhedron has faces oriented inside
+  void makePolyhedra( SMDS_Mesh& mesh, int nbSeg )
+  {
+    std::vector< const SMDS_MeshNode* > nodes( 2 * ( nbSeg + 1 ) * ( nbSeg + 1 ));
+    for ( int k = 0; k < 2; ++k )
+      for ( int j = 0; j <= nbSeg; ++j )
+        for ( int i = 0; i <= nbSeg; ++i )
+          nodes[ ( k * ( nbSeg + 1 ) + j ) * ( nbSeg + 1 ) + i ] =
+            mesh.AddNode( i, j, k * ( 1 + 0.1 * (( i + j ) % 5 )));
+
+    const int faceNodes[6][4] = { { 0, 3, 2, 1 }, { 4, 5, 6, 7 },
+                                  { 0, 1, 5, 4 }, { 1, 2, 6, 5 },
+                                  { 2, 3, 7, 6 }, { 3, 0, 4, 7 } };
+    std::vector< const SMDS_MeshNode* > polyNodes;
+    std::vector< int > quantities( 6, 4 );
+    for ( int j = 0; j < nbSeg; ++j )
+      for ( int i = 0; i < nbSeg; ++i )
+      {
+        const SMDS_MeshNode* hexNodes[8];
+        for ( int k = 0; k < 2; ++k )
+        {
+          const int i0 = ( k * ( nbSeg + 1 ) + j ) * ( nbSeg + 1 ) + i;
+          hexNodes[ 4 * k + 0 ] = nodes[ i0 ];
+          hexNodes[ 4 * k + 1 ] = nodes[ i0 + 1 ];
+          hexNodes[ 4 * k + 2 ] = nodes[ i0 + nbSeg + 2 ];
+          hexNodes[ 4 * k + 3 ] = nodes[ i0 + nbSeg + 1 ];
+        }
+        const bool isReversed = ( j * nbSeg + i ) % 3 == 0;
+        polyNodes.clear();
+        for ( int iF = 0; iF < 6; ++iF )
+          for ( int iN = 0; iN < 4; ++iN )
+            polyNodes.push_back( hexNodes[ faceNodes[ iF ][ isReversed ? 3 - iN : iN ]]);
+        mesh.AddPolyhedralVolume( polyNodes, quantities );
+      }
+  }
+
+  // check a predicate by a filter and element by element
+  void checkPredicate( const SMDS_Mesh& mesh, PredicatePtr predicate, const std::string& name )
+  {
+    predicate->SetMesh( &mesh );
+    Filter::TIdSequence expected;
+    SMDS_ElemIteratorPtr elemIt = mesh.elementsIterator( predicate->GetType() );
+    while ( elemIt->more() )
+    {
+      const SMDS_MeshElement* elem = elemIt->next();
+      if ( predicate->IsSatisfy( elem->GetID() ))
+        expected.push_back( elem->GetID() );
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    Filter::TIdSequence found;
+    Filter::GetElementsId( &mesh, predicate, found );
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+
+    std::cout << name << ": " << found.size() << " elements in " << time.count() << " s" << std::endl;
+
+    if ( found != expected )
+      throw std::runtime_error("wrong result of " + name + " in testFilterParallel()\n");
+  }
+}
+
+bool testFilterParallel()
+{
+  std::unique_ptr<SMDS_Mesh> mesh( new SMDS_Mesh );
+  makeMesh( *mesh, 400 );
+
+  // element type
+
+  ElemGeomType* geomType = new ElemGeomType();
+  geomType->SetType( SMDSAbs_Face );
+  geomType->SetGeomType( SMDSGeom_QUADRANGLE );
+  PredicatePtr isQuad( geomType );
+  checkPredicate( *mesh, isQuad, "ElemGeomType" );
+
+  // topology
+
+  checkPredicate( *mesh, PredicatePtr( new FreeEdges() ), "FreeEdges" );
+
+  // range of IDs
+
+  RangeOfIds* range = new RangeOfIds();
+  range->SetType( SMDSAbs_Face );
+  range->SetRangeStr( "10-20000,30000,50000-" );
+  PredicatePtr inRange( range );
+  checkPredicate( *mesh, inRange, "RangeOfIds" );
+
+  // numerical functor
+
+  LessThan* lessThan = new LessThan();
+  lessThan->SetNumFunctor( NumericalFunctorPtr( new AspectRatio() ));
+  lessThan->SetMargin( 1.05 );
+  PredicatePtr goodQuality( lessThan );
+  checkPredicate( *mesh, goodQuality, "AspectRatio < 1.05" );
+
+  // logical combination
+
+  LogicalAND* andPredicate = new LogicalAND();
+  andPredicate->SetPredicate1( isQuad );
+  LogicalNOT* notPredicate = new LogicalNOT();
+  notPredicate->SetPredicate( goodQuality );
+  andPredicate->SetPredicate2( PredicatePtr( notPredicate ));
+  checkPredicate( *mesh, PredicatePtr( andPredicate ), "ElemGeomType AND NOT AspectRatio" );
+
+  return true;
+}
+
+bool testFilterParallelPolyhedra()
+{
+  std::unique_ptr<SMDS_Mesh> mesh( new SMDS_Mesh );
+  makePolyhedra( *mesh, 120 );
+
+  // numerical functor computed by SMDS_VolumeTool
+
+  MoreThan* moreThan = new MoreThan();
+  moreThan->SetNumFunctor( NumericalFunctorPtr( new Volume() ));
+  moreThan->SetMargin( 1.15 );
+  checkPredicate( *mesh, PredicatePtr( moreThan ), "Volume > 1.15" );
+
+  // orientation
+
+  checkPredicate( *mesh, PredicatePtr( new BadOrientedVolume() ), "BadOrientedVolume" );
+
+  return true;
+}
+
+int main()
+{
+  if ( !testFilterParallel() || !testFilterParallelPolyhedra() )
+    return 1;
+  else
+    return 0;
+}
@@ -0,0 +1,178 @@
+// Copyright (C) 2025  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+// File      : SMESH_MEDPartialReadTest.cxx (unit test)
+// Purpose   : Check that DriverMED_R_SMESHDS_Mesh reads only elements of groups
+//             given by SetGroupsToRead() and their nodes, and print times of
+//             reading of the whole mesh and of a group
+
+// std
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// boost
+#include <boost/filesystem.hpp>
+
+// smesh
+#include "DriverMED_R_SMESHDS_Mesh.h"
+#include "DriverMED_W_SMESHDS_Mesh.h"
+#include "SMDS_MeshNode.hxx"
+#include "SMESHDS_Group.hxx"
+#include "SMESHDS_Mesh.hxx"
+
+namespace fs = boost::filesystem;
+
+namespace
+{
+  // a grid of quadrangles with segments on the bottom side;
+  // quadrangles of the left half are in "Left" group, segments are in "Bottom" group
+  void makeMesh( SMESHDS_Mesh& mesh, int nbSeg, SMESHDS_Group& left, SMESHDS_Group& bottom )
+  {
+    std::vector< const SMDS_MeshNode* > nodes(( nbSeg + 1 ) * ( nbSeg + 1 ));
+    for ( int j = 0; j <= nbSeg; ++j )
+      for ( int i = 0; i <= nbSeg; ++i )
+        nodes[ j * ( nbSeg + 1 ) + i ] = mesh.AddNode( i, j, 0 );
+
+    for ( int j = 0; j < nbSeg; ++j )
+      for ( int i = 0; i < nbSeg; ++i )
+      {
+        const SMDS_MeshElement* quad = mesh.AddFace( nodes[ j       * ( nbSeg + 1 ) + i     ],
+                                                     nodes[ j       * ( nbSeg + 1 ) + i + 1 ],
+                                                     nodes[ ( j + 1 ) * ( nbSeg + 1 ) + i + 1 ],
+                                                     nodes[ ( j + 1 ) * ( nbSeg + 1 ) + i     ]);
+        if ( 2 * i < nbSeg )
+          left.Add( quad );
+      }
+
+    for ( int i = 0; i < nbSeg; ++i )
+      bottom.Add( mesh.AddEdge( nodes[ i ], nodes[ i + 1 ]));
+  }
+
+  // read a mesh from a MED file, return the reading time and sizes of groups
+  double readMesh( const std::string&            file,
+                   SMESHDS_Mesh&                 mesh,
+                   const std::set<std::string>&  groups,
+                   std::map< std::string, int >& groupSizes )
+  {
+    auto start = std::chrono::steady_clock::now();
+
+    DriverMED_R_SMESHDS_Mesh reader;
+    reader.SetFile( file );
+    reader.SetMesh( &mesh );
+    reader.SetMeshName( "Mesh" );
+    reader.SetGroupsToRead( groups );
+    if ( reader.Perform() != Driver_Mesh::DRS_OK )
+      throw std::runtime_error("failed reading in testMEDPartialRead()\n");
+
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+
+    for ( const TNameAndType& name2type : reader.GetGroupNamesAndTypes() )
+    {
+      SMESHDS_Group group( 0, &mesh, name2type.second );
+      group.SetStoreName( name2type.first.c_str() );
+      reader.GetGroup( &group );
+      groupSizes[ name2type.first ] = (int) group.Extent();
+    }
+    return time.count();
+  }
+}
+
+bool testMEDPartialRead()
+{
+  const int nbSeg = 400;
+
+  std::unique_ptr< SMESHDS_Mesh > mesh( new SMESHDS_Mesh( 0, true ));
+  SMESHDS_Group left  ( 1, mesh.get(), SMDSAbs_Face );
+  SMESHDS_Group bottom( 2, mesh.get(), SMDSAbs_Edge );
+  left.SetStoreName  ( "Left" );
+  bottom.SetStoreName( "Bottom" );
+  makeMesh( *mesh, nbSeg, left, bottom );
+
+  fs::path file = fs::temp_directory_path() / fs::unique_path( "%%%%-%%%%-%%%%.med" );
+
+  DriverMED_W_SMESHDS_Mesh writer;
+  writer.SetFile( file.string() );
+  writer.SetMesh( mesh.get() );
+  writer.SetMeshName( "Mesh" );
+  writer.AddGroup( &left );
+  writer.AddGroup( &bottom );
+  if ( writer.Perform() != Driver_Mesh::DRS_OK )
+    throw std::runtime_error("failed writing in testMEDPartialRead()\n");
+
+  // whole mesh
+
+  std::map< std::string, int > groupSizes;
+  std::unique_ptr< SMESHDS_Mesh > wholeMesh( new SMESHDS_Mesh( 1, true ));
+  double wholeTime = readMesh( file.string(), *wholeMesh, std::set<std::string>(), groupSizes );
+  if ( wholeMesh->NbNodes() != mesh->NbNodes() ||
+       wholeMesh->NbFaces() != mesh->NbFaces() ||
+       wholeMesh->NbEdges() != mesh->NbEdges() ||
+       groupSizes[ "Left" ] != left.Extent() )
+    throw std::runtime_error("wrong whole mesh in testMEDPartialRead()\n");
+
+  // one group
+
+  std::unique_ptr< SMESHDS_Mesh > leftMesh( new SMESHDS_Mesh( 2, true ));
+  groupSizes.clear();
+  double leftTime = readMesh( file.string(), *leftMesh, { "Left" }, groupSizes );
+  if ( leftMesh->NbNodes() != ( nbSeg / 2 + 1 ) * ( nbSeg + 1 ) ||
+       leftMesh->NbFaces() != left.Extent() ||
+       leftMesh->NbEdges() != 0 ||
+       groupSizes[ "Left" ] != left.Extent() ||
+       groupSizes[ "Bottom" ] != 0 )
+    throw std::runtime_error("wrong mesh of a group in testMEDPartialRead()\n");
+
+  // node IDs are kept
+  SMDS_NodeIteratorPtr nIt = leftMesh->nodesIterator();
+  while ( nIt->more() )
+  {
+    const SMDS_MeshNode* node = nIt->next();
+    const SMDS_MeshNode* node0 = mesh->FindNode( node->GetID() );
+    if ( !node0 || node0->X() != node->X() || node0->Y() != node->Y() )
+      throw std::runtime_error("wrong node of a group in testMEDPartialRead()\n");
+  }
+
+  // two groups
+
+  std::unique_ptr< SMESHDS_Mesh > twoMesh( new SMESHDS_Mesh( 3, true ));
+  groupSizes.clear();
+  readMesh( file.string(), *twoMesh, { "Left", "Bottom" }, groupSizes );
+  if ( twoMesh->NbFaces() != left.Extent() ||
+       twoMesh->NbEdges() != bottom.Extent() ||
+       groupSizes[ "Bottom" ] != bottom.Extent() )
+    throw std::runtime_error("wrong mesh of two groups in testMEDPartialRead()\n");
+
+  std::cout << "read: whole mesh " << wholeTime << " s, a half " << leftTime << " s" << std::endl;
+
+  fs::remove( file );
+  return true;
+}
+
+int main()
+{
+  if ( !testMEDPartialRead() )
+    return 1;
+  else
+    return 0;
+}
@@ -0,0 +1,54 @@
+# -*- coding: utf-8 -*-
+
+# Check that search of elements by points, projection of points and
+# classification of points give same results for a batch of points
+# and for points one by one
+
+import random
+import salome
+
+salome.salome_init_without_session()
+
+import SMESH
+from salome.smesh import smeshBuilder
+
+smesh = smeshBuilder.New()
+
+# a grid of hexahedra with boundary faces
+nb = 4
+mesh = smesh.Mesh()
+nodes = {}
+for k in range( nb + 1 ):
+  for j in range( nb + 1 ):
+    for i in range( nb + 1 ):
+      nodes[ i,j,k ] = mesh.AddNode( i, j, k )
+for k in range( nb ):
+  for j in range( nb ):
+    for i in range( nb ):
+      mesh.AddVolume([ nodes[ i,j,k   ], nodes[ i+1,j,k   ], nodes[ i+1,j+1,k   ], nodes[ i,j+1,k   ],
+                       nodes[ i,j,k+1 ], nodes[ i+1,j,k+1 ], nodes[ i+1,j+1,k+1 ], nodes[ i,j+1,k+1 ]])
+mesh.Make2DMeshFrom3D()
+
+random.seed( 1 )
+points = [ ( random.uniform( -1, nb + 1 ),
+             random.uniform( -1, nb + 1 ),
+             random.uniform( -1, nb + 1 )) for i in range( 500 ) ]
+
+ids = mesh.FindElementsByPoints( points, SMESH.VOLUME )
+for p, id in zip( points, ids ):
+  found = mesh.FindElementsByPoint( p[0], p[1], p[2], SMESH.VOLUME )
+  if ( id == 0 ) != ( not found ) or ( found and id not in found ):
+    raise RuntimeError( "Wrong element %s found by point %s" % ( id, p ))
+
+states = mesh.GetPointStates( points )
+for p, state in zip( points, states ):
+  if state != mesh.GetPointState( p[0], p[1], p[2] ):
+    raise RuntimeError( "Wrong state %s of point %s" % ( state, p ))
+
+ids, projections = mesh.ProjectPoints( points, SMESH.FACE )
+for p, id, proj in zip( points, ids, projections ):
+  id1, proj1 = mesh.ProjectPoint( p[0], p[1], p[2], SMESH.FACE )
+  dist  = sum(( a - b ) ** 2 for a, b in zip( p, proj  ))
+  dist1 = sum(( a - b ) ** 2 for a, b in zip( p, proj1 ))
+  if id < 0 or abs( dist - dist1 ) > 1e-10:
+    raise RuntimeError( "Wrong projection %s of point %s" % ( proj, p ))
@@ -0,0 +1,91 @@
+# -*- coding: utf-8 -*-
+
+# Check bulk export of node coordinates and element connectivity
+# against per-element queries and compare their speed.
+# Set nbSeg to 171 to fetch a mesh of 5M hexahedra.
+
+import sys, time
+import salome
+
+salome.salome_init_without_session()
+
+import SMESH
+from salome.geom import geomBuilder
+from salome.smesh import smeshBuilder
+
+geompy = geomBuilder.New()
+smesh = smeshBuilder.New()
+
+nbSeg = 20
+if len( sys.argv ) > 1:
+  nbSeg = int( sys.argv[1] )
+
+box = geompy.MakeBoxDXDYDZ( 10, 10, 10 )
+mesh = smesh.Mesh( box )
+mesh.Segment().NumberOfSegments( nbSeg )
+mesh.Quadrangle()
+mesh.Hexahedron()
+assert mesh.Compute()
+
+# add a polyhedron
+n = [ mesh.AddNode( 20 + x, y, z ) for x, y, z in [ (0,0,0), (1,0,0), (0,1,0), (0,0,1) ]]
+poly = mesh.AddPolyhedralVolume([ n[0],n[2],n[1], n[0],n[1],n[3], n[1],n[2],n[3], n[0],n[3],n[2] ],
+                                [ 3,3,3,3 ])
+assert poly > 0
+
+# whole mesh nodes
+
+t0 = time.time()
+coords, nodeIDs = mesh.GetNodesXYZ()
+tBulk = time.time() - t0
+assert len( nodeIDs ) == mesh.NbNodes()
+assert len( coords ) == 3 * len( nodeIDs )
+
+nbCheck = min( len( nodeIDs ), 10000 )
+t0 = time.time()
+for i in range( nbCheck ):
+  assert mesh.GetNodeXYZ( nodeIDs[i] ) == coords[ 3*i : 3*i+3 ]
+tOne = ( time.time() - t0 ) * len( nodeIDs ) / nbCheck
+print( "%s nodes: bulk %.3fs, node by node (estimated) %.3fs" % ( len( nodeIDs ), tBulk, tOne ))
+
+# whole mesh elements
+
+t0 = time.time()
+conn = mesh.GetElementsConnectivity()
+tBulk = time.time() - t0
+assert len( conn.elemIDs ) == mesh.NbElements()
+assert len( conn.offsets ) == len( conn.elemIDs ) + 1
+assert conn.offsets[-1] == len( conn.nodeIDs )
+
+nbCheck = min( len( conn.elemIDs ), 10000 )
+t0 = time.time()
+for i in range( nbCheck ):
+  elemID = conn.elemIDs[i]
+  assert mesh.GetElemNodes( elemID ) == list( conn.nodeIDs[ conn.offsets[i] : conn.offsets[i+1] ])
+  assert mesh.GetElementGeomType( elemID )._v == conn.entityTypes[i]
+tOne = ( time.time() - t0 ) * len( conn.elemIDs ) / nbCheck
+print( "%s elements: bulk %.3fs, element by element (estimated) %.3fs" %
+       ( len( conn.elemIDs ), tBulk, tOne ))
+
+# polyhedron is given face by face
+
+conn = mesh.GetElementsConnectivity( mesh, SMESH.VOLUME )
+assert list( conn.polyQuantities ) == [ 3,3,3,3 ]
+assert conn.elemIDs[-1] == poly
+assert conn.offsets[-1] - conn.offsets[-2] == 12
+
+# mesh part
+
+faces = mesh.MakeGroupByIds( "faces", SMESH.FACE, mesh.GetElementsByType( SMESH.FACE )[:10] )
+conn = mesh.GetElementsConnectivity( faces )
+assert list( conn.elemIDs ) == list( faces.GetIDs() )
+assert list( conn.entityTypes ) == [ SMESH.Entity_Quadrangle._v ] * 10
+
+coords, nodeIDs = mesh.GetNodesXYZ( faces )
+assert set( nodeIDs ) == set( conn.nodeIDs )
+for i, nID in enumerate( nodeIDs ):
+  assert mesh.GetNodeXYZ( nID ) == coords[ 3*i : 3*i+3 ]
+
+# no edges in the group of faces
+conn = mesh.GetElementsConnectivity( faces, SMESH.EDGE )
+assert len( conn.elemIDs ) == 0
@@ -0,0 +1,76 @@
+# -*- coding: utf-8 -*-
+
+# Check that edition operations taking lists of IDs give same results
+# whatever the order of IDs and duplicated IDs, as elements are
+# always treated in the order of their IDs
+
+import random, time
+import salome
+
+salome.salome_init_without_session()
+
+import SMESH
+from salome.smesh import smeshBuilder
+
+smesh = smeshBuilder.New()
+
+nb = 10
+
+def makeMesh():
+  """ a grid of hexahedra with a layer of quadrangles in the middle """
+  mesh = smesh.Mesh()
+  nodes = {}
+  for k in range( nb + 1 ):
+    for j in range( nb + 1 ):
+      for i in range( nb + 1 ):
+        nodes[ i,j,k ] = mesh.AddNode( i, j, k )
+  lowVolumes = []
+  for k in range( nb ):
+    for j in range( nb ):
+      for i in range( nb ):
+        v = mesh.AddVolume([ nodes[ i,j,k   ], nodes[ i+1,j,k   ], nodes[ i+1,j+1,k   ], nodes[ i,j+1,k   ],
+                             nodes[ i,j,k+1 ], nodes[ i+1,j,k+1 ], nodes[ i+1,j+1,k+1 ], nodes[ i,j+1,k+1 ]])
+        if k < nb // 2:
+          lowVolumes.append( v )
+  faces = []
+  k = nb // 2
+  for j in range( nb ):
+    for i in range( nb ):
+      faces.append( mesh.AddFace([ nodes[ i,j,k ], nodes[ i+1,j,k ], nodes[ i+1,j+1,k ], nodes[ i,j+1,k ]]))
+  return mesh, faces, lowVolumes
+
+def shuffled( ids ):
+  ids = ids + ids[ : len( ids ) // 3 ] # add duplicates
+  random.shuffle( ids )
+  return ids
+
+def checkSame( mesh1, mesh2, operation ):
+  if mesh1.NbNodes() != mesh2.NbNodes() or mesh1.NbElements() != mesh2.NbElements():
+    raise RuntimeError( "%s: different number of entities" % operation )
+  for id in mesh1.GetElementsId():
+    if mesh1.GetElemNodes( id ) != mesh2.GetElemNodes( id ):
+      raise RuntimeError( "%s: different nodes of element %s" % ( operation, id ))
+
+random.seed( 1 )
+
+# DoubleNodeElem()
+mesh1, faces1, volumes1 = makeMesh()
+mesh2, faces2, volumes2 = makeMesh()
+t0 = time.time()
+if not mesh1.DoubleNodeElem( faces1, [], volumes1 ):
+  raise RuntimeError( "DoubleNodeElem() failed" )
+t1 = time.time()
+if not mesh2.DoubleNodeElem( shuffled( faces2 ), [], shuffled( volumes2 )):
+  raise RuntimeError( "DoubleNodeElem() failed" )
+t2 = time.time()
+print( "DoubleNodeElem(): sorted IDs %.3f s, shuffled IDs %.3f s" % ( t1 - t0, t2 - t1 ))
+checkSame( mesh1, mesh2, "DoubleNodeElem()" )
+
+# DoubleElements()
+mesh1, faces1, volumes1 = makeMesh()
+mesh2, faces2, volumes2 = makeMesh()
+mesh1.DoubleElements( volumes1 )
+mesh2.DoubleElements( shuffled( volumes2 ))
+checkSame( mesh1, mesh2, "DoubleElements()" )
+if mesh1.NbVolumes() != nb**3 + len( volumes1 ):
+  raise RuntimeError( "DoubleElements(): wrong number of volumes %s" % mesh1.NbVolumes() )
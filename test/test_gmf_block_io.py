@@ -0,0 +1,84 @@
+# -*- coding: utf-8 -*-
+
+# Check that a mesh exported to ASCII and binary GMF files and imported back
+# is the same, and print times of export and import.
+# Pass a number of segments as argument to use a bigger mesh.
+
+import sys, os, time, tempfile, shutil
+import salome
+
+salome.salome_init_without_session()
+
+import SMESH
+from salome.geom import geomBuilder
+from salome.smesh import smeshBuilder
+
+geompy = geomBuilder.New()
+smesh = smeshBuilder.New()
+
+nbSeg = 10
+if len( sys.argv ) > 1:
+  nbSeg = int( sys.argv[1] )
+
+box = geompy.MakeBoxDXDYDZ( 10, 20, 30 )
+mesh = smesh.Mesh( box, "box" )
+mesh.Segment().NumberOfSegments( nbSeg )
+mesh.Quadrangle()
+mesh.Hexahedron()
+assert mesh.Compute()
+mesh.SplitVolumesIntoTetra( mesh, smesh.Hex_6Tet )
+mesh.MakeBoundaryElements( SMESH.BND_1DFROM3D )
+
+tmpDir = tempfile.mkdtemp()
+
+for ext in ( ".meshb", ".mesh" ):
+  gmfFile = os.path.join( tmpDir, "box" + ext )
+
+  t0 = time.time()
+  mesh.ExportGMF( gmfFile )
+  tExport = time.time() - t0
+
+  t0 = time.time()
+  gmfMesh, error = smesh.CreateMeshesFromGMF( gmfFile )
+  tImport = time.time() - t0
+  assert not error.comment, error.comment
+
+  assert gmfMesh.NbNodes()  == mesh.NbNodes()
+  assert gmfMesh.NbEdges()  == mesh.NbEdges()
+  assert gmfMesh.NbFaces()  == mesh.NbFaces()
+  assert gmfMesh.NbTetras() == mesh.NbTetras()
+
+  # nodes are written and read in the same order
+  for nID in range( 1, mesh.NbNodes() + 1, max( 1, mesh.NbNodes() // 100 )):
+    xyz1 = mesh.GetNodeXYZ( mesh.GetNodesId()[ nID - 1 ])
+    xyz2 = gmfMesh.GetNodeXYZ( nID )
+    assert max( abs( c1 - c2 ) for c1, c2 in zip( xyz1, xyz2 )) < 1e-6
+
+  # min and max volumes are kept
+  vols1 = [ mesh.GetVolume( v ) for v in mesh.GetElementsByType( SMESH.VOLUME )]
+  vols2 = [ gmfMesh.GetVolume( v ) for v in gmfMesh.GetElementsByType( SMESH.VOLUME )]
+  assert abs( min( vols1 ) - min( vols2 )) < 1e-6
+  assert abs( max( vols1 ) - max( vols2 )) < 1e-6
+
+  print( "%s: %s nodes, %s elements, export %.3fs, import %.3fs" %
+         ( ext, gmfMesh.NbNodes(), gmfMesh.NbElements(), tExport, tImport ))
+  gmfMesh.Clear()
+
+# a truncated file is reported and elements read before the end are kept
+gmfFile = os.path.join( tmpDir, "box.mesh" )
+mesh.ExportGMF( gmfFile )
+with open( gmfFile ) as f:
+  lines = f.readlines()
+iKwd = [ l.strip() for l in lines ].index( "Tetrahedra" )
+nbTetra = int( lines[ iKwd + 1 ])
+nbKept = nbTetra // 2
+truncFile = os.path.join( tmpDir, "truncated.mesh" )
+with open( truncFile, "w" ) as f:
+  f.writelines( lines[ : iKwd + 2 + nbKept ])
+
+truncMesh, error = smesh.CreateMeshesFromGMF( truncFile )
+assert "Truncated" in error.comment, error.comment
+assert truncMesh.NbNodes()  == mesh.NbNodes()
+assert truncMesh.NbTetras() == nbKept, ( truncMesh.NbTetras(), nbKept )
+
+shutil.rmtree( tmpDir, ignore_errors = True )
@@ -0,0 +1,80 @@
+# -*- coding: utf-8 -*-
+
+# Check that meshes not modified since the previous save are stored
+# correctly when the study is saved again, and compare times of the saves.
+# Pass a number of segments as argument to save bigger meshes.
+
+import sys, os, time, tempfile, shutil
+import salome
+
+salome.salome_init_without_session()
+
+import SMESH
+from salome.geom import geomBuilder
+from salome.smesh import smeshBuilder
+
+geompy = geomBuilder.New()
+smesh = smeshBuilder.New()
+
+nbSeg = 10
+if len( sys.argv ) > 1:
+  nbSeg = int( sys.argv[1] )
+
+meshes = []
+for i in range( 5 ):
+  box = geompy.MakeBoxDXDYDZ( 10, 10, 10 + i )
+  geompy.addToStudy( box, "Box_%s" % i )
+  mesh = smesh.Mesh( box, "Mesh_%s" % i )
+  mesh.Segment().NumberOfSegments( nbSeg + i )
+  mesh.Quadrangle()
+  mesh.Hexahedron()
+  assert mesh.Compute()
+  mesh.MakeGroup( "Face_%s" % i, SMESH.FACE, SMESH.FT_BelongToGenSurface, "=", geompy.SubShapeAllSorted( box, geompy.ShapeType["FACE"] )[0] )
+  meshes.append( mesh )
+
+tmpDir = tempfile.mkdtemp()
+studyFile = os.path.join( tmpDir, "study.hdf" )
+medFile   = os.path.join( tmpDir, "study_SMESH_Mesh.med" )
+
+def save():
+  t0 = time.time()
+  assert salome.myStudy.SaveAs( studyFile, True, False ) # multi-file
+  return time.time() - t0
+
+def check():
+  medMeshes, status = smesh.CreateMeshesFromMED( medFile )
+  assert status == SMESH.DRS_OK
+  assert len( medMeshes ) == len( meshes )
+  for medMesh, mesh in zip( sorted( medMeshes, key = lambda m: m.NbNodes() ), meshes ):
+    assert medMesh.NbNodes()   == mesh.NbNodes()
+    assert medMesh.NbVolumes() == mesh.NbVolumes()
+    assert medMesh.NbGroups()  == mesh.NbGroups()
+    medMesh.Clear()
+
+tFirst = save()
+check()
+
+# modify one mesh and one group of another mesh
+meshes[0].RemoveElements( meshes[0].GetElementsByType( SMESH.VOLUME )[:1] )
+meshes[0].RemoveOrphanNodes()
+meshes[1].GetGroups()[0].Remove( meshes[1].GetGroups()[0].GetIDs()[:1] )
+
+tNext = save()
+check()
+
+tSame = save()
+check()
+
+# move a node, which changes neither numbers of entities nor groups
+nodeID = meshes[2].GetNodesId()[0]
+xyz = meshes[2].GetNodeXYZ( nodeID )
+assert meshes[2].MoveNode( nodeID, xyz[0] + 0.5, xyz[1], xyz[2] )
+save()
+check()
+medMeshes, status = smesh.CreateMeshesFromMED( medFile )
+medMesh = [ m for m in medMeshes if m.GetName() == meshes[2].GetName() ][0]
+assert medMesh.GetNodeXYZ( nodeID ) == meshes[2].GetNodeXYZ( nodeID )
+
+print( "save: first %.3fs, after modification %.3fs, without modification %.3fs" % ( tFirst, tNext, tSame ))
+
+shutil.rmtree( tmpDir, ignore_errors = True )
@@ -0,0 +1,65 @@
+# -*- coding: utf-8 -*-
+
+# Check that only elements of given groups and their nodes are read
+# from a MED file if names of groups are passed to CreateMeshesFromMED()
+
+import os, tempfile, shutil
+import salome
+
+salome.salome_init_without_session()
+
+import SMESH
+from salome.geom import geomBuilder
+from salome.smesh import smeshBuilder
+
+geompy = geomBuilder.New()
+smesh = smeshBuilder.New()
+
+box = geompy.MakeBoxDXDYDZ( 10, 20, 30 )
+topFace    = geompy.GetFaceNearPoint( box, geompy.MakeVertex( 5, 10, 30 ))
+bottomFace = geompy.GetFaceNearPoint( box, geompy.MakeVertex( 5, 10, 0 ))
+
+mesh = smesh.Mesh( box, "box" )
+mesh.Segment().NumberOfSegments( 5 )
+mesh.Quadrangle()
+mesh.Hexahedron()
+assert mesh.Compute()
+
+top    = mesh.GroupOnGeom( topFace,    "top",    SMESH.FACE )
+bottom = mesh.GroupOnGeom( bottomFace, "bottom", SMESH.FACE )
+solid  = mesh.GroupOnGeom( box,        "solid",  SMESH.VOLUME )
+
+tmpDir = tempfile.mkdtemp()
+medFile = os.path.join( tmpDir, "box.med" )
+mesh.ExportMED( medFile )
+
+# all elements are read if no group is given
+
+meshes, status = smesh.CreateMeshesFromMED( medFile )
+assert status == SMESH.DRS_OK, status
+assert meshes[0].NbNodes()   == mesh.NbNodes()
+assert meshes[0].NbFaces()   == mesh.NbFaces()
+assert meshes[0].NbVolumes() == mesh.NbVolumes()
+assert len( meshes[0].GetGroups() ) == 3
+
+# faces of two groups
+
+meshes, status = smesh.CreateMeshesFromMED( medFile, [ "top", "bottom" ])
+assert status == SMESH.DRS_OK, status
+faceMesh = meshes[0]
+assert faceMesh.NbFaces()   == top.Size() + bottom.Size()
+assert faceMesh.NbVolumes() == 0
+assert faceMesh.NbNodes()   == len( top.GetNodeIDs() ) + len( bottom.GetNodeIDs() )
+assert sorted( g.GetName() for g in faceMesh.GetGroups() ) == [ "bottom", "top" ]
+
+# volumes of one group
+
+meshes, status = smesh.CreateMeshesFromMED( medFile, "solid" )
+assert status == SMESH.DRS_OK, status
+volMesh = meshes[0]
+assert volMesh.NbVolumes() == mesh.NbVolumes()
+assert volMesh.NbFaces()   == 0
+assert volMesh.NbNodes()   == mesh.NbNodes()
+assert [ g.GetName() for g in volMesh.GetGroups() ] == [ "solid" ]
+
+shutil.rmtree( tmpDir )
@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+
+# Compute a parallel mesh of boxes of very different sizes twice and check that
+# the second compute, which uses compute times learned at the first one, gives
+# the same mesh. Estimated and real compute times of sub-meshes and times of
+# compute stages are written to a file defined by SMESH_COMPUTE_STATS
+# environment variable. Then compare the time of the ordered compute of solids,
+# including the time of estimation, with the time of the compute in the order
+# of sub-meshes, which is done if SMESH_COMPUTE_NO_ORDER is set.
+# At last check that the mesh of lower dimension is exported to a MED file
+# for remote NETGEN algorithms only and not for algorithms of StdMeshers.
+
+import os, time, tempfile
+import salome
+
+salome.salome_init_without_session()
+
+from salome.geom import geomBuilder
+from salome.smesh import smeshBuilder
+
+geompy = geomBuilder.New()
+smesh = smeshBuilder.New()
+
+statFile = os.path.join( tempfile.mkdtemp(), "compute_stats.txt" )
+os.environ["SMESH_COMPUTE_STATS"] = statFile
+
+# a big box and several small ones
+boxes = [ geompy.MakeBoxDXDYDZ( 100, 100, 100 ) ]
+for i in range( 7 ):
+  boxes.append( geompy.MakeBox( 120 + 20 * i, 0, 0, 130 + 20 * i, 10, 10 ))
+assembly = geompy.MakeCompound( boxes )
+geompy.addToStudy( assembly, "assembly" )
+
+par_mesh = smesh.ParallelMesh( assembly, name="par_mesh" )
+params = smesh.CreateHypothesisByAverageLength( 'NETGEN_Parameters', 'NETGENEngine', 5., 0 )
+par_mesh.AddGlobalHypothesis( params )
+par_mesh.SetParallelismMethod( smeshBuilder.MULTITHREAD )
+par_mesh.GetParallelismSettings().SetNbThreads( 4 )
+
+def compute():
+  t0 = time.time()
+  assert par_mesh.Compute()
+  return time.time() - t0
+
+tFirst = compute()
+nbTetras = par_mesh.NbTetras()
+assert nbTetras > 0
+
+par_mesh.Clear()
+tSecond = compute()
+assert par_mesh.NbTetras() == nbTetras
+
+def readStats():
+  """ return lines of statFile and times of estimation and makespan of the last
+  compute of solids, which is the last one in statFile """
+  with open( statFile ) as f:
+    lines = f.readlines()
+  estimation = [ float( l.split()[-1] ) for l in lines if l.startswith( "# estimation_time" )]
+  makespan   = [ float( l.split()[-1] ) for l in lines if l.startswith( "# makespan" )]
+  return lines, estimation[-1], makespan[-1]
+
+lines, tEstimation, tOrdered = readStats()
+assert len([ l for l in lines if l.startswith( "# makespan" )]) >= 2
+assert len([ l for l in lines if l.startswith( "# stage_times" )]) == 2
+assert len([ l for l in lines if not l.startswith( "#" )]) >= 2 * len( boxes )
+
+# compute in the order of sub-meshes
+os.environ["SMESH_COMPUTE_NO_ORDER"] = "1"
+par_mesh.Clear()
+tNoOrder = compute()
+assert par_mesh.NbTetras() == nbTetras
+del os.environ["SMESH_COMPUTE_NO_ORDER"]
+
+lines, tNoEstimation, tNotOrdered = readStats()
+assert tNoEstimation < 1e-3 # no estimation
+
+print( "compute: first %.3fs, with learned times %.3fs, not ordered %.3fs" % ( tFirst, tSecond, tNoOrder ))
+print( "compute of solids: ordered %.3fs (estimation %.3fs), not ordered %.3fs" %
+       ( tOrdered + tEstimation, tEstimation, tNotOrdered ))
+
+def lastExportTime():
+  """ return time of export of the lower dimension mesh at the last compute """
+  with open( statFile ) as f:
+    stageTimes = [ l.split() for l in f.readlines() if l.startswith( "# stage_times" )]
+  return float( stageTimes[-1][3] )
+
+assert lastExportTime() > 0. # NETGEN_3D_Remote reads the file
+
+# hexahedral parallel mesh
+hexa_mesh = smesh.ParallelMesh( assembly, name="hexa_mesh" )
+hexa_mesh.GetMesh().SetParallelismDimension( 3 )
+hexa_mesh.Segment().NumberOfSegments( 3 )
+hexa_mesh.Quadrangle()
+hexa_mesh.Hexahedron()
+hexa_mesh.SetParallelismMethod( smeshBuilder.MULTITHREAD )
+hexa_mesh.GetParallelismSettings().SetNbThreads( 1 ) # Hexa_3D adds elements to the mesh in memory
+assert hexa_mesh.Compute()
+assert hexa_mesh.NbHexas() == 27 * len( boxes )
+assert lastExportTime() == 0. # no file is written
+
+os.remove( statFile )
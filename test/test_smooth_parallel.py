@@ -0,0 +1,70 @@
+# -*- coding: utf-8 -*-
+
+# Check parallel smoothing: the result must not depend on the number of
+# threads and quality of elements must be improved
+
+import random, time
+import salome
+
+salome.salome_init_without_session()
+
+import SMESH
+from salome.smesh import smeshBuilder
+
+smesh = smeshBuilder.New()
+
+nb = 200
+
+def makeMesh():
+  """ a planar grid of quadrangles with randomly shifted internal nodes """
+  random.seed( 1 )
+  mesh = smesh.Mesh()
+  nodes = {}
+  for j in range( nb + 1 ):
+    for i in range( nb + 1 ):
+      x, y = i, j
+      if 0 < i < nb and 0 < j < nb:
+        x += random.uniform( -0.3, 0.3 )
+        y += random.uniform( -0.3, 0.3 )
+      nodes[ i,j ] = mesh.AddNode( x, y, 0 )
+  for j in range( nb ):
+    for i in range( nb ):
+      mesh.AddFace([ nodes[ i,j ], nodes[ i+1,j ], nodes[ i+1,j+1 ], nodes[ i,j+1 ]])
+  return mesh
+
+def maxAspectRatio( mesh ):
+  return mesh.GetMinMax( SMESH.FT_AspectRatio )[1]
+
+def coordinates( mesh ):
+  return [ mesh.GetNodeXYZ( n ) for n in mesh.GetNodesId() ]
+
+nbIter = 20
+results = {}
+for method in [ SMESH.SMESH_MeshEditor.LAPLACIAN_SMOOTH, SMESH.SMESH_MeshEditor.CENTROIDAL_SMOOTH ]:
+
+  # sequential (Gauss-Seidel) smoothing for timing reference
+  mesh = makeMesh()
+  ar0 = maxAspectRatio( mesh )
+  t0 = time.time()
+  mesh.SmoothObject( mesh, [], nbIter, 1., method )
+  tRef = time.time() - t0
+
+  for nbThreads in [ 2, 4 ]:
+    mesh = makeMesh()
+    t0 = time.time()
+    isDone = mesh.SmoothParallel( mesh, [], nbIter, 1., method, False, nbThreads )
+    t = time.time() - t0
+    assert isDone
+    ar = maxAspectRatio( mesh )
+    assert ar < ar0, "quality not improved: %s >= %s" % ( ar, ar0 )
+    results[ nbThreads ] = coordinates( mesh )
+    print( "%s: sequential %.3fs, %s threads %.3fs, speed-up %.2f" %
+           ( method, tRef, nbThreads, t, tRef / max( t, 1e-6 )))
+
+  # result must not depend on the number of threads
+  assert results[ 2 ] == results[ 4 ]
+
+  # convergence by max displacement: a large tolerance stops smoothing early
+  mesh = makeMesh()
+  mesh.SmoothParallel( mesh, [], nbIter, 1., method, False, 2, 1. )
+  assert coordinates( mesh ) != results[ 2 ]